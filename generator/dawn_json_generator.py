@@ -164,6 +164,9 @@ class StructureType(Record, Type):
         Type.__init__(self, name, json_data)
         self.chained = json_data.get("chained", False)
         self.extensible = json_data.get("extensible", False)
+        # Structures that are part of the keys of the caches of dawn_native get a packed version
+        # without padding, see dawn_native/CacheKeys.h
+        self.cache_key = json_data.get("cache key", False)
         # Chained structs inherit from wgpu::ChainedStruct which has nextInChain so setting
         # both extensible and chained would result in two nextInChain members.
         assert(not (self.extensible and self.chained))
@@ -442,6 +445,48 @@ def annotated(typ, arg):
     name = as_varName(arg.name)
     return decorate(name, typ, arg)
 
+def compute_borrowed_structures(structures):
+    # Structures that hold objects, directly or through other structures, get a version that uses
+    # borrowed handles in webgpu_cpp.h. Arrays of objects are left alone: they point to objects
+    # that are already referenced elsewhere so using them doesn't reference the objects.
+    borrowed = set()
+    changed = True
+    while changed:
+        changed = False
+        for struct in structures:
+            name = struct.name.canonical_case()
+            if name in borrowed:
+                continue
+            for member in struct.members:
+                if has_borrowed_version(member.type, member.annotation, borrowed):
+                    borrowed.add(name)
+                    changed = True
+                    break
+    return borrowed
+
+def has_borrowed_version(typ, annotation, borrowed_structures):
+    if typ.category == 'object':
+        return annotation == 'value'
+    if typ.category == 'structure':
+        return typ.name.canonical_case() in borrowed_structures
+    return False
+
+def has_borrowed_overload(method, borrowed_structures):
+    # Objects passed by value are already taken by const reference so only the methods taking
+    # structures that hold objects need an overload.
+    for arg in method.arguments:
+        if arg.type.category == 'structure' and \
+           has_borrowed_version(arg.type, arg.annotation, borrowed_structures):
+            return True
+    return False
+
+def as_borrowed_cppType(typ, annotation, borrowed_structures):
+    if not has_borrowed_version(typ, annotation, borrowed_structures):
+        return as_cppType(typ.name)
+    if typ.category == 'object':
+        return 'Borrowed<' + as_cppType(typ.name) + '>'
+    return 'Borrowed' + as_cppType(typ.name)
+
 def as_cEnum(type_name, value_name):
     assert(not type_name.native and not value_name.native)
     return 'WGPU' + type_name.CamelCase() + '_' + value_name.CamelCase()
@@ -486,6 +531,42 @@ def as_frontendType(typ):
     else:
         return as_cType(typ.name)
 
+# Returns how a member of a "cache key" structure is packed in 32-bit words: 'skip' for the label,
+# 'word' for enums, bitmasks and 32-bit integers, 'bool', 'float', 'uint64' (two words) or
+# 'structure' for a nested cache key structure.
+def as_cacheKeyKind(member):
+    typ = member.type
+    if member.annotation != 'value':
+        # Labels are only used for debugging and don't make objects different.
+        assert(member.name.canonical_case() == 'label')
+        return 'skip'
+    if typ.category in ['bitmask', 'enum']:
+        return 'word'
+    if typ.category == 'structure':
+        assert(typ.cache_key)
+        return 'structure'
+    assert(typ.category == 'native')
+    native_kinds = {
+        'uint32_t': 'word',
+        'int32_t': 'word',
+        'bool': 'bool',
+        'float': 'float',
+        'uint64_t': 'uint64',
+    }
+    return native_kinds[typ.name.concatcase()]
+
+def cache_key_word_count(typ):
+    count = 0
+    for member in typ.members:
+        kind = as_cacheKeyKind(member)
+        if kind == 'structure':
+            count += cache_key_word_count(member.type)
+        elif kind == 'uint64':
+            count += 2
+        elif kind != 'skip':
+            count += 1
+    return count
+
 def as_wireType(typ):
     if typ.category == 'object':
         return typ.name.CamelCase() + '*'
@@ -514,7 +595,7 @@ class MultiGeneratorFromDawnJSON(Generator):
         return 'Generates code for various target from Dawn.json.'
 
     def add_commandline_arguments(self, parser):
-        allowed_targets = ['dawn_headers', 'dawncpp_headers', 'dawncpp', 'dawn_proc', 'mock_webgpu', 'dawn_wire', "dawn_native_utils"]
+        allowed_targets = ['dawn_headers', 'dawncpp_headers', 'dawncpp', 'dawn_proc', 'mock_webgpu', 'dawn_wire', "dawn_native_utils", "dawn_native_direct_proc"]
 
         parser.add_argument('--dawn-json', required=True, type=str, help ='The DAWN JSON definition to use.')
         parser.add_argument('--wire-json', default=None, type=str, help='The DAWN WIRE JSON definition to use.')
@@ -562,14 +643,21 @@ class MultiGeneratorFromDawnJSON(Generator):
             renders.append(FileRender('webgpu.h', 'src/include/dawn/webgpu.h', [base_params, api_params]))
             renders.append(FileRender('dawn_proc_table.h', 'src/include/dawn/dawn_proc_table.h', [base_params, api_params]))
 
+        borrowed_structures = compute_borrowed_structures(api_params['by_category']['structure'])
+        cpp_params = {
+            'has_borrowed_version': lambda typ: has_borrowed_version(typ, 'value', borrowed_structures),
+            'has_borrowed_overload': lambda method: has_borrowed_overload(method, borrowed_structures),
+            'as_annotated_borrowed_cppType': lambda arg: annotated(as_borrowed_cppType(arg.type, arg.annotation, borrowed_structures), arg),
+        }
+
         if 'dawncpp_headers' in targets:
-            renders.append(FileRender('webgpu_cpp.h', 'src/include/dawn/webgpu_cpp.h', [base_params, api_params]))
+            renders.append(FileRender('webgpu_cpp.h', 'src/include/dawn/webgpu_cpp.h', [base_params, api_params, cpp_params]))
 
         if 'dawn_proc' in targets:
             renders.append(FileRender('dawn_proc.c', 'src/dawn/dawn_proc.c', [base_params, api_params]))
 
         if 'dawncpp' in targets:
-            renders.append(FileRender('webgpu_cpp.cpp', 'src/dawn/webgpu_cpp.cpp', [base_params, api_params]))
+            renders.append(FileRender('webgpu_cpp.cpp', 'src/dawn/webgpu_cpp.cpp', [base_params, api_params, cpp_params]))
 
         if 'emscripten_bits' in targets:
             renders.append(FileRender('webgpu_struct_info.json', 'src/dawn/webgpu_struct_info.json', [base_params, api_params]))
@@ -592,16 +680,24 @@ class MultiGeneratorFromDawnJSON(Generator):
                 api_params,
                 {
                     'as_frontendType': lambda typ: as_frontendType(typ), # TODO as_frontendType and friends take a Type and not a Name :(
-                    'as_annotated_frontendType': lambda arg: annotated(as_frontendType(arg.type), arg)
+                    'as_annotated_frontendType': lambda arg: annotated(as_frontendType(arg.type), arg),
+                    'as_cacheKeyKind': as_cacheKeyKind,
+                    'cache_key_word_count': cache_key_word_count,
                 }
             ]
 
+            renders.append(FileRender('dawn_native/CacheKeys.h', 'src/dawn_native/CacheKeys_autogen.h', frontend_params))
+            renders.append(FileRender('dawn_native/CacheKeys.cpp', 'src/dawn_native/CacheKeys_autogen.cpp', frontend_params))
             renders.append(FileRender('dawn_native/ValidationUtils.h', 'src/dawn_native/ValidationUtils_autogen.h', frontend_params))
             renders.append(FileRender('dawn_native/ValidationUtils.cpp', 'src/dawn_native/ValidationUtils_autogen.cpp', frontend_params))
             renders.append(FileRender('dawn_native/wgpu_structs.h', 'src/dawn_native/wgpu_structs_autogen.h', frontend_params))
             renders.append(FileRender('dawn_native/wgpu_structs.cpp', 'src/dawn_native/wgpu_structs_autogen.cpp', frontend_params))
+            renders.append(FileRender('dawn_native/NativeProcs.h', 'src/dawn_native/NativeProcs_autogen.h', frontend_params))
             renders.append(FileRender('dawn_native/ProcTable.cpp', 'src/dawn_native/ProcTable.cpp', frontend_params))
 
+        if 'dawn_native_direct_proc' in targets:
+            renders.append(FileRender('dawn_native/webgpu_dawn_native_proc.cpp', 'src/dawn_native/webgpu_dawn_native_proc.cpp', [base_params, api_params]))
+
         if 'dawn_wire' in targets:
             additional_params = compute_wire_params(api_params, wire_json)
 
@@ -0,0 +1,58 @@
+//* Copyright 2020 The Dawn Authors
+//*
+//* Licensed under the Apache License, Version 2.0 (the "License");
+//* you may not use this file except in compliance with the License.
+//* You may obtain a copy of the License at
+//*
+//*     http://www.apache.org/licenses/LICENSE-2.0
+//*
+//* Unless required by applicable law or agreed to in writing, software
+//* distributed under the License is distributed on an "AS IS" BASIS,
+//* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//* See the License for the specific language governing permissions and
+//* limitations under the License.
+
+#include "dawn_native/CacheKeys_autogen.h"
+
+#include <cstring>
+
+namespace dawn_native {
+
+    namespace {
+
+        uint32_t PackFloat(float value) {
+            // -0.0 and 0.0 compare equal so they must have the same key.
+            if (value == 0.0f) {
+                value = 0.0f;
+            }
+            uint32_t bits;
+            static_assert(sizeof(bits) == sizeof(value), "");
+            memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+    }  // anonymous namespace
+
+    {% for type in by_category["structure"] if type.cache_key %}
+        {% set CppType = as_cppType(type.name) %}
+        void PackCacheKey({{CppType}}CacheKey* key, const {{CppType}}& value) {
+            {% for member in type.members %}
+                {% set kind = as_cacheKeyKind(member) %}
+                {% set memberName = as_varName(member.name) %}
+                {% if kind == "structure" %}
+                    PackCacheKey(&key->{{memberName}}, value.{{memberName}});
+                {% elif kind == "uint64" %}
+                    key->{{memberName}}[0] = static_cast<uint32_t>(value.{{memberName}});
+                    key->{{memberName}}[1] = static_cast<uint32_t>(value.{{memberName}} >> 32);
+                {% elif kind == "bool" %}
+                    key->{{memberName}} = value.{{memberName}} ? 1u : 0u;
+                {% elif kind == "float" %}
+                    key->{{memberName}} = PackFloat(value.{{memberName}});
+                {% elif kind == "word" %}
+                    key->{{memberName}} = static_cast<uint32_t>(value.{{memberName}});
+                {% endif %}
+            {% endfor %}
+        }
+
+    {% endfor %}
+}  // namespace dawn_native
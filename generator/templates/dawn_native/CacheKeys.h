@@ -0,0 +1,51 @@
+//* Copyright 2020 The Dawn Authors
+//*
+//* Licensed under the Apache License, Version 2.0 (the "License");
+//* you may not use this file except in compliance with the License.
+//* You may obtain a copy of the License at
+//*
+//*     http://www.apache.org/licenses/LICENSE-2.0
+//*
+//* Unless required by applicable law or agreed to in writing, software
+//* distributed under the License is distributed on an "AS IS" BASIS,
+//* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//* See the License for the specific language governing permissions and
+//* limitations under the License.
+
+#ifndef DAWNNATIVE_CACHEKEYS_AUTOGEN_H_
+#define DAWNNATIVE_CACHEKEYS_AUTOGEN_H_
+
+#include "dawn_native/dawn_platform.h"
+
+#include <cstdint>
+
+namespace dawn_native {
+
+    // Packed versions of the structures marked as "cache key" in dawn.json. They only contain
+    // 32-bit words so that they don't have padding and can be hashed and compared as bytes.
+    // Enums, bitmasks and bools are stored as one word, floats as their bits with -0.0 stored as
+    // 0.0, and 64-bit integers as two words. Labels aren't part of the keys.
+    {% for type in by_category["structure"] if type.cache_key %}
+        {% set CppType = as_cppType(type.name) %}
+        struct {{CppType}}CacheKey {
+            {% for member in type.members %}
+                {% set kind = as_cacheKeyKind(member) %}
+                {% set memberName = as_varName(member.name) %}
+                {% if kind == "structure" %}
+                    {{as_cppType(member.type.name)}}CacheKey {{memberName}};
+                {% elif kind == "uint64" %}
+                    uint32_t {{memberName}}[2];
+                {% elif kind != "skip" %}
+                    uint32_t {{memberName}};
+                {% endif %}
+            {% endfor %}
+        };
+        static_assert(sizeof({{CppType}}CacheKey) == {{cache_key_word_count(type)}} * sizeof(uint32_t),
+                      "{{CppType}}CacheKey must not have padding");
+
+        void PackCacheKey({{CppType}}CacheKey* key, const {{CppType}}& value);
+
+    {% endfor %}
+}  // namespace dawn_native
+
+#endif  // DAWNNATIVE_CACHEKEYS_AUTOGEN_H_
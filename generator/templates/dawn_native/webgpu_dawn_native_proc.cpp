@@ -0,0 +1,51 @@
+//* Copyright 2020 The Dawn Authors
+//*
+//* Licensed under the Apache License, Version 2.0 (the "License");
+//* you may not use this file except in compliance with the License.
+//* You may obtain a copy of the License at
+//*
+//*     http://www.apache.org/licenses/LICENSE-2.0
+//*
+//* Unless required by applicable law or agreed to in writing, software
+//* distributed under the License is distributed on an "AS IS" BASIS,
+//* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//* See the License for the specific language governing permissions and
+//* limitations under the License.
+
+//* Direct dispatch version of dawn_proc.c: the webgpu.h entry points call the frontend through
+//* the inline thunks of NativeProcs_autogen.h instead of through a DawnProcTable. It is meant for
+//* in-process users that link against dawn_native statically and never use the wire, and must
+//* not be linked together with libdawn_proc.
+
+#include "dawn_native/NativeProcs_autogen.h"
+
+extern "C" {
+
+WGPUInstance wgpuCreateInstance(WGPUInstanceDescriptor const * descriptor) {
+    return dawn_native::NativeCreateInstance(descriptor);
+}
+
+WGPUProc wgpuGetProcAddress(WGPUDevice device, const char* procName) {
+    return dawn_native::NativeGetProcAddress(device, procName);
+}
+
+{% for type in by_category["object"] %}
+    {% for method in c_methods(type) %}
+        {{as_cType(method.return_type.name)}} {{as_cMethod(type.name, method.name)}}(
+            {{-as_cType(type.name)}} {{as_varName(type.name)}}
+            {%- for arg in method.arguments -%}
+                , {{as_annotated_cType(arg)}}
+            {%- endfor -%}
+        ) {
+            {% if method.return_type.name.canonical_case() != "void" %}return {% endif %}
+            dawn_native::Native{{as_MethodSuffix(type.name, method.name)}}({{as_varName(type.name)}}
+                {%- for arg in method.arguments -%}
+                    , {{as_varName(arg.name)}}
+                {%- endfor -%}
+            );
+        }
+    {% endfor %}
+
+{% endfor %}
+
+}  // extern "C"
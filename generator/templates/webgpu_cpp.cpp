@@ -68,6 +68,22 @@ namespace wgpu {
                     "offsetof mismatch for {{CppType}}::{{memberName}}");
         {% endfor %}
 
+        {% if has_borrowed_version(type) %}
+            {% set BorrowedType = "Borrowed" + CppType %}
+            static_assert(sizeof({{BorrowedType}}) == sizeof({{CType}}), "sizeof mismatch for {{BorrowedType}}");
+            static_assert(alignof({{BorrowedType}}) == alignof({{CType}}), "alignof mismatch for {{BorrowedType}}");
+
+            {% if type.extensible %}
+                static_assert(offsetof({{BorrowedType}}, nextInChain) == offsetof({{CType}}, nextInChain),
+                        "offsetof mismatch for {{BorrowedType}}::nextInChain");
+            {% endif %}
+            {% for member in type.members %}
+                {% set memberName = member.name.camelCase() %}
+                static_assert(offsetof({{BorrowedType}}, {{memberName}}) == offsetof({{CType}}, {{memberName}}),
+                        "offsetof mismatch for {{BorrowedType}}::{{memberName}}");
+            {% endfor %}
+
+        {% endif %}
     {% endfor %}
 
     {% for type in by_category["object"] %}
@@ -77,13 +93,15 @@ namespace wgpu {
         static_assert(sizeof({{CppType}}) == sizeof({{CType}}), "sizeof mismatch for {{CppType}}");
         static_assert(alignof({{CppType}}) == alignof({{CType}}), "alignof mismatch for {{CppType}}");
 
-        {% macro render_cpp_method_declaration(type, method) %}
+        {% macro render_cpp_method_declaration(type, method, borrowed=False) %}
             {% set CppType = as_cppType(type.name) %}
             {{as_cppType(method.return_type.name)}} {{CppType}}::{{method.name.CamelCase()}}(
                 {%- for arg in method.arguments -%}
                     {%- if not loop.first %}, {% endif -%}
                     {%- if arg.type.category == "object" and arg.annotation == "value" -%}
                         {{as_cppType(arg.type.name)}} const& {{as_varName(arg.name)}}
+                    {%- elif borrowed -%}
+                        {{as_annotated_borrowed_cppType(arg)}}
                     {%- else -%}
                         {{as_annotated_cppType(arg)}}
                     {%- endif -%}
@@ -111,8 +129,8 @@ namespace wgpu {
             )
         {%- endmacro %}
 
-        {% for method in type.methods %}
-            {{render_cpp_method_declaration(type, method)}} {
+        {% macro render_cpp_method_body(type, method) %}
+            {
                 {% if method.return_type.name.concatcase() == "void" %}
                     {{render_cpp_to_c_method_call(type, method)}};
                 {% else %}
@@ -120,6 +138,13 @@ namespace wgpu {
                     return {{convert_cType_to_cppType(method.return_type, 'value', 'result') | indent(8)}};
                 {% endif %}
             }
+        {%- endmacro %}
+
+        {% for method in type.methods %}
+            {{render_cpp_method_declaration(type, method)}} {{render_cpp_method_body(type, method)}}
+            {% if has_borrowed_overload(method) %}
+                {{render_cpp_method_declaration(type, method, True)}} {{render_cpp_method_body(type, method)}}
+            {% endif %}
         {% endfor %}
         void {{CppType}}::WGPUReference({{CType}} handle) {
             if (handle != nullptr) {
@@ -18,6 +18,8 @@
 #include "dawn/webgpu.h"
 #include "dawn/EnumClassBitmasks.h"
 
+#include <utility>
+
 namespace wgpu {
 
     static constexpr uint64_t kWholeSize = WGPU_WHOLE_SIZE;
@@ -59,6 +61,9 @@ namespace wgpu {
 
     {% for type in by_category["structure"] %}
         struct {{as_cppType(type.name)}};
+        {% if has_borrowed_version(type) %}
+            struct Borrowed{{as_cppType(type.name)}};
+        {% endif %}
     {% endfor %}
 
     template<typename Derived, typename CType>
@@ -85,11 +90,13 @@ namespace wgpu {
             return static_cast<Derived&>(*this);
         }
 
-        ObjectBase(ObjectBase&& other) {
+        // Moves are noexcept so that containers of objects move them instead of copying them, which
+        // would reference and release each object.
+        ObjectBase(ObjectBase&& other) noexcept {
             mHandle = other.mHandle;
             other.mHandle = 0;
         }
-        Derived& operator=(ObjectBase&& other) {
+        Derived& operator=(ObjectBase&& other) noexcept {
             if (&other != this) {
                 if (mHandle) Derived::WGPURelease(mHandle);
                 mHandle = other.mHandle;
@@ -136,6 +143,39 @@ namespace wgpu {
         CType mHandle = nullptr;
     };
 
+    // Non-owning view of an object: it doesn't reference the object and must not outlive it. It
+    // has the layout of the C handle, so the Borrowed* versions of the structures holding objects
+    // can be filled and passed to the API without any reference counting.
+    template<typename T>
+    class Borrowed {
+      public:
+        using CType = decltype(std::declval<T const&>().Get());
+
+        Borrowed() = default;
+        Borrowed(std::nullptr_t) {}
+        Borrowed(T const& object) : mHandle(object.Get()) {
+        }
+        // Borrowing a temporary would leave a dangling handle.
+        Borrowed(T&& object) = delete;
+
+        bool operator==(std::nullptr_t) const {
+            return mHandle == nullptr;
+        }
+        bool operator!=(std::nullptr_t) const {
+            return mHandle != nullptr;
+        }
+
+        explicit operator bool() const {
+            return mHandle != nullptr;
+        }
+        CType Get() const {
+            return mHandle;
+        }
+
+      private:
+        CType mHandle = nullptr;
+    };
+
 {% macro render_cpp_default_value(member) -%}
     {%- if member.annotation in ["*", "const*", "const*const*"] and member.optional -%}
         {{" "}}= nullptr
@@ -148,17 +188,23 @@ namespace wgpu {
     {%- endif -%}
 {%- endmacro %}
 
-{% macro render_cpp_method_declaration(type, method) %}
+//* The overloads taking borrowed handles don't have default values, that would make calls
+//* using the default values ambiguous.
+{% macro render_cpp_method_declaration(type, method, borrowed=False) %}
     {% set CppType = as_cppType(type.name) %}
     {{as_cppType(method.return_type.name)}} {{method.name.CamelCase()}}(
         {%- for arg in method.arguments -%}
             {%- if not loop.first %}, {% endif -%}
             {%- if arg.type.category == "object" and arg.annotation == "value" -%}
                 {{as_cppType(arg.type.name)}} const& {{as_varName(arg.name)}}
+            {%- elif borrowed -%}
+                {{as_annotated_borrowed_cppType(arg)}}
             {%- else -%}
                 {{as_annotated_cppType(arg)}}
             {%- endif -%}
-            {{render_cpp_default_value(arg)}}
+            {%- if not borrowed -%}
+                {{render_cpp_default_value(arg)}}
+            {%- endif -%}
         {%- endfor -%}
     ) const
 {%- endmacro %}
@@ -173,6 +219,9 @@ namespace wgpu {
 
             {% for method in type.methods %}
                 {{render_cpp_method_declaration(type, method)}};
+                {% if has_borrowed_overload(method) %}
+                    {{render_cpp_method_declaration(type, method, True)}};
+                {% endif %}
             {% endfor %}
 
           private:
@@ -208,6 +257,25 @@ namespace wgpu {
             {% endfor %}
         };
 
+        //* Same structure with borrowed handles instead of references to the objects.
+        {% if has_borrowed_version(type) %}
+            {% if type.chained %}
+                struct Borrowed{{as_cppType(type.name)}} : ChainedStruct {
+                    Borrowed{{as_cppType(type.name)}}() {
+                        sType = SType::{{type.name.CamelCase()}};
+                    }
+            {% else %}
+                struct Borrowed{{as_cppType(type.name)}} {
+            {% endif %}
+                {% if type.extensible %}
+                    ChainedStruct const * nextInChain = nullptr;
+                {% endif %}
+                {% for member in type.members %}
+                    {{as_annotated_borrowed_cppType(member)}}{{render_cpp_default_value(member)}};
+                {% endfor %}
+            };
+
+        {% endif %}
     {% endfor %}
 
 }  // namespace wgpu
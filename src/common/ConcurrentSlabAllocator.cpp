@@ -0,0 +1,183 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/ConcurrentSlabAllocator.h"
+
+#include "common/Assert.h"
+#include "common/Compiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+// Depot
+
+class ConcurrentSlabAllocatorImpl::Depot : public SlabAllocatorImpl {
+  public:
+    Depot(Index blocksPerSlab, uint32_t objectSize, uint32_t objectAlignment)
+        : SlabAllocatorImpl(blocksPerSlab, objectSize, objectAlignment) {
+    }
+
+    // Moves |kMagazineBatchSize| new blocks to the magazine.
+    void Refill(Magazine* magazine);
+
+    // Moves the |count| last blocks of the magazine back to the depot.
+    void Drain(Magazine* magazine, uint32_t count);
+
+    // Set when the ConcurrentSlabAllocator owning the depot is destroyed. Threads that still
+    // hold a magazine for this depot will return its blocks and drop it lazily.
+    void SetOrphaned() {
+        mOrphaned.store(true, std::memory_order_release);
+    }
+    bool IsOrphaned() const {
+        return mOrphaned.load(std::memory_order_acquire);
+    }
+
+  private:
+    std::mutex mMutex;
+    std::atomic<bool> mOrphaned{false};
+};
+
+// Magazine
+
+struct ConcurrentSlabAllocatorImpl::Magazine {
+    explicit Magazine(std::shared_ptr<Depot> depot) : depot(std::move(depot)) {
+    }
+    ~Magazine() {
+        depot->Drain(this, count);
+    }
+
+    std::shared_ptr<Depot> depot;
+    uint32_t count = 0;
+    void* blocks[kMagazineCapacity];
+};
+
+void ConcurrentSlabAllocatorImpl::Depot::Refill(Magazine* magazine) {
+    ASSERT(magazine->count + kMagazineBatchSize <= kMagazineCapacity);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    for (uint32_t i = 0; i < kMagazineBatchSize; ++i) {
+        magazine->blocks[magazine->count++] = SlabAllocatorImpl::Allocate();
+    }
+}
+
+void ConcurrentSlabAllocatorImpl::Depot::Drain(Magazine* magazine, uint32_t count) {
+    ASSERT(count <= magazine->count);
+    if (count == 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    for (uint32_t i = 0; i < count; ++i) {
+        SlabAllocatorImpl::Deallocate(magazine->blocks[--magazine->count]);
+    }
+}
+
+// ThreadCache
+
+struct ConcurrentSlabAllocatorImpl::ThreadCache {
+    // Removes and drains the magazine at |index|.
+    void Remove(size_t index) {
+        if (lastMagazine == magazines[index].get()) {
+            lastDepot = nullptr;
+            lastMagazine = nullptr;
+        }
+        magazines.erase(magazines.begin() + index);
+    }
+
+    // The magazine that was used last, which is the one used by the fast path. Depots are kept
+    // alive by the magazines referencing them so |lastDepot| can't alias a new depot.
+    const Depot* lastDepot = nullptr;
+    Magazine* lastMagazine = nullptr;
+
+    std::vector<std::unique_ptr<Magazine>> magazines;
+};
+
+thread_local ConcurrentSlabAllocatorImpl::ThreadCache ConcurrentSlabAllocatorImpl::sThreadCache;
+
+// ConcurrentSlabAllocatorImpl
+
+ConcurrentSlabAllocatorImpl::ConcurrentSlabAllocatorImpl(SlabAllocatorImpl::Index blocksPerSlab,
+                                                         uint32_t objectSize,
+                                                         uint32_t objectAlignment)
+    : mDepot(std::make_shared<Depot>(blocksPerSlab, objectSize, objectAlignment)) {
+}
+
+ConcurrentSlabAllocatorImpl::~ConcurrentSlabAllocatorImpl() {
+    FlushThreadCache();
+    mDepot->SetOrphaned();
+}
+
+void* ConcurrentSlabAllocatorImpl::Allocate() {
+    Magazine* magazine = GetMagazine();
+    if (magazine->count == 0) {
+        mDepot->Refill(magazine);
+    }
+    return magazine->blocks[--magazine->count];
+}
+
+void ConcurrentSlabAllocatorImpl::Deallocate(void* ptr) {
+    Magazine* magazine = GetMagazine();
+    if (magazine->count == kMagazineCapacity) {
+        mDepot->Drain(magazine, kMagazineBatchSize);
+    }
+    magazine->blocks[magazine->count++] = ptr;
+}
+
+void ConcurrentSlabAllocatorImpl::FlushThreadCache() {
+    ThreadCache& cache = sThreadCache;
+    for (size_t i = 0; i < cache.magazines.size(); ++i) {
+        if (cache.magazines[i]->depot == mDepot) {
+            cache.Remove(i);
+            return;
+        }
+    }
+}
+
+ConcurrentSlabAllocatorImpl::Magazine* ConcurrentSlabAllocatorImpl::GetMagazine() {
+    ThreadCache& cache = sThreadCache;
+    if (DAWN_LIKELY(cache.lastDepot == mDepot.get())) {
+        return cache.lastMagazine;
+    }
+    return GetMagazineSlow();
+}
+
+ConcurrentSlabAllocatorImpl::Magazine* ConcurrentSlabAllocatorImpl::GetMagazineSlow() {
+    ThreadCache& cache = sThreadCache;
+
+    Magazine* magazine = nullptr;
+    for (size_t i = 0; i < cache.magazines.size();) {
+        Depot* depot = cache.magazines[i]->depot.get();
+        if (depot == mDepot.get()) {
+            magazine = cache.magazines[i].get();
+            ++i;
+        } else if (depot->IsOrphaned()) {
+            // Opportunistically return blocks of allocators that have been destroyed so their
+            // depot can be freed.
+            cache.Remove(i);
+        } else {
+            ++i;
+        }
+    }
+
+    if (magazine == nullptr) {
+        cache.magazines.push_back(std::make_unique<Magazine>(mDepot));
+        magazine = cache.magazines.back().get();
+    }
+
+    cache.lastDepot = mDepot.get();
+    cache.lastMagazine = magazine;
+    return magazine;
+}
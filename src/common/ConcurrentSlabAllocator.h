@@ -0,0 +1,99 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef COMMON_CONCURRENTSLABALLOCATOR_H_
+#define COMMON_CONCURRENTSLABALLOCATOR_H_
+
+#include "common/SlabAllocator.h"
+
+#include <cstdint>
+#include <memory>
+
+// The ConcurrentSlabAllocator is a variant of the SlabAllocator that may be used to allocate and
+// deallocate objects from multiple threads at the same time. Objects may be deallocated on a
+// different thread than the one they were allocated on.
+//
+// Internally, the memory is owned by a single SlabAllocatorImpl called the "depot" which is
+// protected by a mutex. Each thread using the allocator gets a "magazine": a small fixed-size stack
+// of free blocks that is only ever touched by that thread. Allocation pops a block from the
+// thread's magazine and deallocation pushes one on it, without any locking or atomic operations.
+// Only when a magazine runs empty (resp. full) does the thread lock the depot, and it then
+// transfers a whole batch of blocks at once from (resp. to) the depot. This amortizes the cost of
+// the lock over |kMagazineBatchSize| operations.
+//
+// Magazines are kept in a thread_local cache that holds a reference to the depot of each allocator
+// the thread used. This means the depot stays alive until all threads have returned their cached
+// blocks: either when the thread exits, or when the thread notices the allocator is gone the next
+// time it looks up a magazine for a different allocator. As with the SlabAllocator, all objects
+// must have been deallocated before the allocator is destroyed.
+class ConcurrentSlabAllocatorImpl {
+  public:
+    // The number of blocks a magazine can hold.
+    static constexpr uint32_t kMagazineCapacity = 64;
+    // The number of blocks transferred between a magazine and the depot at once.
+    static constexpr uint32_t kMagazineBatchSize = kMagazineCapacity / 2;
+
+    ConcurrentSlabAllocatorImpl(const ConcurrentSlabAllocatorImpl&) = delete;
+    ConcurrentSlabAllocatorImpl& operator=(const ConcurrentSlabAllocatorImpl&) = delete;
+
+    // Returns all the blocks cached by the calling thread for this allocator to the depot.
+    void FlushThreadCache();
+
+  protected:
+    ConcurrentSlabAllocatorImpl(SlabAllocatorImpl::Index blocksPerSlab,
+                                uint32_t objectSize,
+                                uint32_t objectAlignment);
+    ~ConcurrentSlabAllocatorImpl();
+
+    // Allocate a new block of memory.
+    void* Allocate();
+
+    // Deallocate a block of memory.
+    void Deallocate(void* ptr);
+
+  private:
+    class Depot;
+    struct Magazine;
+    struct ThreadCache;
+
+    // Returns the calling thread's magazine for this allocator, creating it if needed.
+    Magazine* GetMagazine();
+    Magazine* GetMagazineSlow();
+
+    static thread_local ThreadCache sThreadCache;
+
+    std::shared_ptr<Depot> mDepot;
+};
+
+template <typename T>
+class ConcurrentSlabAllocator : public ConcurrentSlabAllocatorImpl {
+  public:
+    ConcurrentSlabAllocator(size_t totalObjectBytes,
+                            uint32_t objectSize = sizeof(T),
+                            uint32_t objectAlignment = alignof(T))
+        : ConcurrentSlabAllocatorImpl(totalObjectBytes / objectSize, objectSize, objectAlignment) {
+    }
+
+    template <typename... Args>
+    T* Allocate(Args&&... args) {
+        void* ptr = ConcurrentSlabAllocatorImpl::Allocate();
+        return new (ptr) T(std::forward<Args>(args)...);
+    }
+
+    void Deallocate(T* object) {
+        ConcurrentSlabAllocatorImpl::Deallocate(object);
+    }
+};
+
+#endif  // COMMON_CONCURRENTSLABALLOCATOR_H_
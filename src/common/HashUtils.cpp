@@ -0,0 +1,54 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/HashUtils.h"
+
+#include <cstring>
+
+uint64_t HashBytes(const void* data, size_t size) {
+    constexpr uint64_t kMultiplier = 0xc6a4a7935bd1e995ull;
+    constexpr uint32_t kShift = 47;
+
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    uint64_t hash = size * kMultiplier;
+
+    // Read the words with memcpy because |data| doesn't have to be 8-byte aligned.
+    const uint8_t* wordsEnd = bytes + (size & ~size_t(7));
+    for (; bytes != wordsEnd; bytes += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, bytes, sizeof(uint64_t));
+
+        word *= kMultiplier;
+        word ^= word >> kShift;
+        word *= kMultiplier;
+
+        hash ^= word;
+        hash *= kMultiplier;
+    }
+
+    size_t tailSize = size & 7;
+    if (tailSize != 0) {
+        uint64_t tail = 0;
+        for (size_t i = 0; i < tailSize; ++i) {
+            tail |= uint64_t(bytes[i]) << (8 * i);
+        }
+        hash ^= tail;
+        hash *= kMultiplier;
+    }
+
+    hash ^= hash >> kShift;
+    hash *= kMultiplier;
+    hash ^= hash >> kShift;
+    return hash;
+}
@@ -18,6 +18,8 @@
 #include "common/Platform.h"
 
 #include <bitset>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 
 // Wrapper around std::hash to make it a templated function instead of a functor. It is marginally
@@ -53,6 +55,11 @@ void HashCombine(size_t* hash, const T& value, const Args&... args) {
     HashCombine(hash, args...);
 }
 
+// Hashes |size| contiguous bytes in a single pass with a 64-bit multiplicative hash (the mixing
+// of MurmurHash64A). It is faster than combining the hashes of the fields of packed structures,
+// and mixes better than std::hash which is the identity for integers on most platforms.
+uint64_t HashBytes(const void* data, size_t size);
+
 // Workaround a bug between clang++ and libstdlibc++ by defining our own hashing for bitsets.
 // When _GLIBCXX_DEBUG is enabled libstdc++ wraps containers into debug containers. For bitset this
 // means what is normally std::bitset is defined as std::__cxx1988::bitset and is replaced by the
@@ -50,6 +50,9 @@ SlabAllocatorImpl::SentinelSlab::~SentinelSlab() {
     while (slab != nullptr) {
         Slab* next = slab->next;
         ASSERT(slab->blocksInUse == 0);
+        // The slab is placement-allocated inside |allocation| so it must be destroyed before the
+        // allocation is freed.
+        std::unique_ptr<char[]> allocation = std::move(slab->allocation);
         slab->~Slab();
         slab = next;
     }
@@ -14,6 +14,7 @@
 
 #include "dawn_native/Adapter.h"
 
+#include "dawn_native/Device.h"
 #include "dawn_native/Instance.h"
 
 namespace dawn_native {
@@ -84,6 +85,7 @@ namespace dawn_native {
         // TODO(cwallez@chromium.org): This will eventually have validation that the device
         // descriptor is valid and is a subset what's allowed on this adapter.
         DAWN_TRY_ASSIGN(*result, CreateDeviceImpl(descriptor));
+        (*result)->StartBackgroundTicker();
         return {};
     }
 
@@ -29,6 +29,7 @@ namespace dawn_native {
             mColorFormats[i] = descriptor->colorFormats[i];
         }
         mDepthStencilFormat = descriptor->depthStencilFormat;
+        ComputeHash();
     }
 
     AttachmentStateBlueprint::AttachmentStateBlueprint(const RenderPipelineDescriptor* descriptor)
@@ -40,6 +41,7 @@ namespace dawn_native {
         if (descriptor->depthStencilState != nullptr) {
             mDepthStencilFormat = descriptor->depthStencilState->format;
         }
+        ComputeHash();
     }
 
     AttachmentStateBlueprint::AttachmentStateBlueprint(const RenderPassDescriptor* descriptor) {
@@ -63,28 +65,29 @@ namespace dawn_native {
             }
         }
         ASSERT(mSampleCount > 0);
+        ComputeHash();
     }
 
     AttachmentStateBlueprint::AttachmentStateBlueprint(const AttachmentStateBlueprint& rhs) =
         default;
 
-    size_t AttachmentStateBlueprint::HashFunc::operator()(
-        const AttachmentStateBlueprint* attachmentState) const {
-        size_t hash = 0;
-
+    void AttachmentStateBlueprint::ComputeHash() {
         // Hash color formats
-        HashCombine(&hash, attachmentState->mColorAttachmentsSet);
-        for (uint32_t i : IterateBitSet(attachmentState->mColorAttachmentsSet)) {
-            HashCombine(&hash, attachmentState->mColorFormats[i]);
+        HashCombine(&mHash, mColorAttachmentsSet);
+        for (uint32_t i : IterateBitSet(mColorAttachmentsSet)) {
+            HashCombine(&mHash, mColorFormats[i]);
         }
 
         // Hash depth stencil attachment
-        HashCombine(&hash, attachmentState->mDepthStencilFormat);
+        HashCombine(&mHash, mDepthStencilFormat);
 
         // Hash sample count
-        HashCombine(&hash, attachmentState->mSampleCount);
+        HashCombine(&mHash, mSampleCount);
+    }
 
-        return hash;
+    size_t AttachmentStateBlueprint::HashFunc::operator()(
+        const AttachmentStateBlueprint* attachmentState) const {
+        return attachmentState->mHash;
     }
 
     bool AttachmentStateBlueprint::EqualityFunc::operator()(
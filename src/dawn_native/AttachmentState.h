@@ -54,6 +54,14 @@ namespace dawn_native {
         // Default (texture format Undefined) indicates there is no depth stencil attachment.
         wgpu::TextureFormat mDepthStencilFormat = wgpu::TextureFormat::Undefined;
         uint32_t mSampleCount = 0;
+
+      private:
+        // Called by the constructors once the state is known. A blueprint is built on every
+        // BeginRenderPass so it is hashed directly from its fixed-size members instead of
+        // recording a CacheKey.
+        void ComputeHash();
+
+        size_t mHash = 0;
     };
 
     class AttachmentState : public AttachmentStateBlueprint, public CachedObject {
@@ -0,0 +1,67 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn_native/BackgroundTicker.h"
+
+#include "dawn_native/Device.h"
+
+namespace dawn_native {
+
+    constexpr std::chrono::milliseconds BackgroundTicker::kTickPeriod;
+
+    BackgroundTicker::BackgroundTicker(DeviceBase* device)
+        : mDevice(device), mThread(&BackgroundTicker::ThreadMain, this) {
+    }
+
+    BackgroundTicker::~BackgroundTicker() {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStopRequested = true;
+        }
+        mStopCondition.notify_one();
+        mThread.join();
+    }
+
+    void BackgroundTicker::ThreadMain() {
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                bool stopRequested =
+                    mStopCondition.wait_for(lock, kTickPeriod, [this]() { return mStopRequested; });
+                if (stopRequested) {
+                    return;
+                }
+                mIsTicking = true;
+            }
+
+            mDevice->TickFromBackgroundThread();
+
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mIsTicking = false;
+                mFinishedTickCount++;
+            }
+            mTickFinishedCondition.notify_all();
+        }
+    }
+
+    void BackgroundTicker::WaitForTicksForTesting(uint32_t count) {
+        std::unique_lock<std::mutex> lock(mMutex);
+        // The tick in progress may have started before the last API call of the caller.
+        uint64_t targetTickCount = mFinishedTickCount + count + (mIsTicking ? 1 : 0);
+        mTickFinishedCondition.wait(lock,
+                                    [&]() { return mFinishedTickCount >= targetTickCount; });
+    }
+
+}  // namespace dawn_native
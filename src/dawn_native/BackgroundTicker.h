@@ -0,0 +1,65 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_BACKGROUNDTICKER_H_
+#define DAWNNATIVE_BACKGROUNDTICKER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace dawn_native {
+
+    class DeviceBase;
+
+    // Runs a thread that periodically ticks a device when the TickOnBackgroundThread toggle is
+    // enabled, so that completed serials are polled and memory is reclaimed even if the
+    // application doesn't call Device::Tick. See DeviceBase::TickFromBackgroundThread for the
+    // part of the tick done on that thread.
+    class BackgroundTicker {
+      public:
+        static constexpr std::chrono::milliseconds kTickPeriod{2};
+
+        // Starts the thread.
+        BackgroundTicker(DeviceBase* device);
+
+        // Stops the thread and waits for the tick in progress, if any, to finish.
+        ~BackgroundTicker();
+
+        // Blocks until |count| ticks that started after the call have finished. It must be
+        // called without holding the API mutex of the device since the ticks take it.
+        void WaitForTicksForTesting(uint32_t count);
+
+      private:
+        void ThreadMain();
+
+        DeviceBase* mDevice;
+
+        std::mutex mMutex;
+        std::condition_variable mStopCondition;
+        bool mStopRequested = false;
+
+        std::condition_variable mTickFinishedCondition;
+        bool mIsTicking = false;
+        uint64_t mFinishedTickCount = 0;
+
+        // Last so that it is started after all the other members are initialized.
+        std::thread mThread;
+    };
+
+}  // namespace dawn_native
+
+#endif  // DAWNNATIVE_BACKGROUNDTICKER_H_
@@ -15,10 +15,12 @@
 #include "dawn_native/BindGroupLayout.h"
 
 #include "common/BitSetIterator.h"
-#include "common/HashUtils.h"
+#include "dawn_native/CacheKeys_autogen.h"
 #include "dawn_native/Device.h"
 #include "dawn_native/ValidationUtils_autogen.h"
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <set>
 
@@ -174,21 +176,7 @@ namespace dawn_native {
 
     namespace {
 
-        void HashCombineBindingInfo(size_t* hash, const BindingInfo& info) {
-            HashCombine(hash, info.hasDynamicOffset, info.multisampled, info.visibility, info.type,
-                        info.textureComponentType, info.textureDimension,
-                        info.storageTextureFormat);
-        }
-
-        bool operator!=(const BindingInfo& a, const BindingInfo& b) {
-            return a.hasDynamicOffset != b.hasDynamicOffset ||          //
-                   a.multisampled != b.multisampled ||                  //
-                   a.visibility != b.visibility ||                      //
-                   a.type != b.type ||                                  //
-                   a.textureComponentType != b.textureComponentType ||  //
-                   a.textureDimension != b.textureDimension ||          //
-                   a.storageTextureFormat != b.storageTextureFormat;
-        }
+        std::atomic<uint64_t> sNextBindGroupLayoutId(1);
 
         bool SortBindingsCompare(const BindGroupLayoutBinding& a, const BindGroupLayoutBinding& b) {
             if (a.hasDynamicOffset != b.hasDynamicOffset) {
@@ -257,12 +245,18 @@ namespace dawn_native {
 
     BindGroupLayoutBase::BindGroupLayoutBase(DeviceBase* device,
                                              const BindGroupLayoutDescriptor* descriptor)
-        : CachedObject(device), mBindingCount(descriptor->bindingCount) {
+        : CachedObject(device),
+          mBindingCount(descriptor->bindingCount),
+          mUniqueId(sNextBindGroupLayoutId++) {
         std::vector<BindGroupLayoutBinding> sortedBindings(
             descriptor->bindings, descriptor->bindings + descriptor->bindingCount);
 
         std::sort(sortedBindings.begin(), sortedBindings.end(), SortBindingsCompare);
 
+        // The bindings are recorded in the order of their BindingIndex, so the key contains both
+        // the BindingInfos and the map from BindingNumber to BindingIndex.
+        mCacheKey.Record(mBindingCount);
+
         for (BindingIndex i = 0; i < mBindingCount; ++i) {
             const BindGroupLayoutBinding& binding = sortedBindings[i];
             mBindingInfo[i].type = binding.type;
@@ -312,7 +306,14 @@ namespace dawn_native {
 
             const auto& it = mBindingMap.emplace(BindingNumber(binding.binding), i);
             ASSERT(it.second);
+
+            BindGroupLayoutBinding normalizedBinding = binding;
+            normalizedBinding.textureDimension = mBindingInfo[i].textureDimension;
+            BindGroupLayoutBindingCacheKey packed;
+            PackCacheKey(&packed, normalizedBinding);
+            mCacheKey.RecordPacked(packed);
         }
+        mCacheKey.Seal();
         ASSERT(CheckBufferBindingsFirst(mBindingInfo.data(), mBindingCount));
     }
 
@@ -345,27 +346,12 @@ namespace dawn_native {
     }
 
     size_t BindGroupLayoutBase::HashFunc::operator()(const BindGroupLayoutBase* bgl) const {
-        size_t hash = 0;
-        // std::map is sorted by key, so two BGLs constructed in different orders
-        // will still hash the same.
-        for (const auto& it : bgl->mBindingMap) {
-            HashCombine(&hash, it.first, it.second);
-            HashCombineBindingInfo(&hash, bgl->mBindingInfo[it.second]);
-        }
-        return hash;
+        return bgl->mCacheKey.GetHash();
     }
 
     bool BindGroupLayoutBase::EqualityFunc::operator()(const BindGroupLayoutBase* a,
                                                        const BindGroupLayoutBase* b) const {
-        if (a->GetBindingCount() != b->GetBindingCount()) {
-            return false;
-        }
-        for (BindingIndex i = 0; i < a->GetBindingCount(); ++i) {
-            if (a->mBindingInfo[i] != b->mBindingInfo[i]) {
-                return false;
-            }
-        }
-        return a->mBindingMap == b->mBindingMap;
+        return a->mCacheKey == b->mCacheKey;
     }
 
     BindingIndex BindGroupLayoutBase::GetBindingCount() const {
@@ -403,4 +389,9 @@ namespace dawn_native {
         return {bufferData, bindings};
     }
 
+    uint64_t BindGroupLayoutBase::GetUniqueId() const {
+        ASSERT(!IsError());
+        return mUniqueId;
+    }
+
 }  // namespace dawn_native
@@ -19,6 +19,7 @@
 #include "common/Math.h"
 #include "common/SlabAllocator.h"
 #include "dawn_native/BindingInfo.h"
+#include "dawn_native/CacheKey.h"
 #include "dawn_native/CachedObject.h"
 #include "dawn_native/Error.h"
 #include "dawn_native/Forward.h"
@@ -97,6 +98,10 @@ namespace dawn_native {
 
         BindingDataPointers ComputeBindingDataPointers(void* dataStart) const;
 
+        // Unlike the address of the layout, the unique ID isn't reused by another layout once this
+        // one is destroyed, so it can identify the layout in caches that don't keep it alive.
+        uint64_t GetUniqueId() const;
+
       protected:
         template <typename BindGroup>
         SlabAllocator<BindGroup> MakeFrontendBindGroupAllocator(size_t size) {
@@ -119,6 +124,10 @@ namespace dawn_native {
 
         // Map from BindGroupLayoutEntry.binding to packed indices.
         BindingMap mBindingMap;
+
+        uint64_t mUniqueId = 0;
+
+        CacheKey mCacheKey;
     };
 
 }  // namespace dawn_native
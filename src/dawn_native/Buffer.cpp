@@ -18,6 +18,7 @@
 #include "dawn_native/Device.h"
 #include "dawn_native/DynamicUploader.h"
 #include "dawn_native/ErrorData.h"
+#include "dawn_native/SubmitCoalescer.h"
 #include "dawn_native/ValidationUtils_autogen.h"
 
 #include <cstdio>
@@ -209,12 +210,16 @@ namespace dawn_native {
             // for example buffer.Unmap() is called inside the application-provided callback.
             WGPUBufferMapReadCallback callback = mMapReadCallback;
             mMapReadCallback = nullptr;
+            GetDevice()->RemovePendingMapRequest(mMapRequestSerial);
 
             if (GetDevice()->IsLost()) {
-                callback(WGPUBufferMapAsyncStatus_DeviceLost, nullptr, 0, mMapUserdata);
-            } else {
-                callback(status, pointer, dataLength, mMapUserdata);
+                status = WGPUBufferMapAsyncStatus_DeviceLost;
+                pointer = nullptr;
+                dataLength = 0;
             }
+            void* userdata = mMapUserdata;
+            GetDevice()->CallOrDeferCallback(
+                [=]() { callback(status, pointer, dataLength, userdata); });
         }
     }
 
@@ -230,12 +235,16 @@ namespace dawn_native {
             // for example buffer.Unmap() is called inside the application-provided callback.
             WGPUBufferMapWriteCallback callback = mMapWriteCallback;
             mMapWriteCallback = nullptr;
+            GetDevice()->RemovePendingMapRequest(mMapRequestSerial);
 
             if (GetDevice()->IsLost()) {
-                callback(WGPUBufferMapAsyncStatus_DeviceLost, nullptr, 0, mMapUserdata);
-            } else {
-                callback(status, pointer, dataLength, mMapUserdata);
+                status = WGPUBufferMapAsyncStatus_DeviceLost;
+                pointer = nullptr;
+                dataLength = 0;
             }
+            void* userdata = mMapUserdata;
+            GetDevice()->CallOrDeferCallback(
+                [=]() { callback(status, pointer, dataLength, userdata); });
         }
     }
 
@@ -245,6 +254,10 @@ namespace dawn_native {
         }
         ASSERT(!IsError());
 
+        // The write must happen after the coalesced submits that might use the buffer.
+        if (!GetDevice()->GetSubmitCoalescer()->Flush()) {
+            return;
+        }
         if (GetDevice()->ConsumedError(SetSubDataImpl(start, count, data))) {
             return;
         }
@@ -258,6 +271,12 @@ namespace dawn_native {
         }
         ASSERT(!IsError());
 
+        // The mapping must happen after the coalesced submits that might use the buffer.
+        if (!GetDevice()->GetSubmitCoalescer()->Flush()) {
+            callback(WGPUBufferMapAsyncStatus_DeviceLost, nullptr, 0, userdata);
+            return;
+        }
+
         ASSERT(mMapWriteCallback == nullptr);
 
         // TODO(cwallez@chromium.org): what to do on wraparound? Could cause crashes.
@@ -265,6 +284,8 @@ namespace dawn_native {
         mMapReadCallback = callback;
         mMapUserdata = userdata;
         mState = BufferState::Mapped;
+        mMapRequestSerial = GetDevice()->GetPendingCommandSerial();
+        GetDevice()->AddPendingMapRequest(mMapRequestSerial);
 
         if (GetDevice()->ConsumedError(MapReadAsyncImpl(mMapSerial))) {
             return;
@@ -295,6 +316,12 @@ namespace dawn_native {
         }
         ASSERT(!IsError());
 
+        // The mapping must happen after the coalesced submits that might use the buffer.
+        if (!GetDevice()->GetSubmitCoalescer()->Flush()) {
+            callback(WGPUBufferMapAsyncStatus_DeviceLost, nullptr, 0, userdata);
+            return;
+        }
+
         ASSERT(mMapReadCallback == nullptr);
 
         // TODO(cwallez@chromium.org): what to do on wraparound? Could cause crashes.
@@ -302,6 +329,8 @@ namespace dawn_native {
         mMapWriteCallback = callback;
         mMapUserdata = userdata;
         mState = BufferState::Mapped;
+        mMapRequestSerial = GetDevice()->GetPendingCommandSerial();
+        GetDevice()->AddPendingMapRequest(mMapRequestSerial);
 
         if (GetDevice()->ConsumedError(MapWriteAsyncImpl(mMapSerial))) {
             return;
@@ -319,6 +348,11 @@ namespace dawn_native {
         }
         ASSERT(!IsError());
 
+        // Coalesced submits that use the buffer must be given to the backend while it exists.
+        if (!GetDevice()->GetSubmitCoalescer()->Flush()) {
+            return;
+        }
+
         if (mState == BufferState::Mapped) {
             if (mStagingBuffer == nullptr) {
                 Unmap();
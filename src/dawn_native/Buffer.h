@@ -15,6 +15,7 @@
 #ifndef DAWNNATIVE_BUFFER_H_
 #define DAWNNATIVE_BUFFER_H_
 
+#include "common/Serial.h"
 #include "dawn_native/Error.h"
 #include "dawn_native/Forward.h"
 #include "dawn_native/ObjectBase.h"
@@ -108,6 +109,8 @@ namespace dawn_native {
         WGPUBufferMapWriteCallback mMapWriteCallback = nullptr;
         void* mMapUserdata = 0;
         uint32_t mMapSerial = 0;
+        // The command serial at which the pending map request completes at the latest.
+        Serial mMapRequestSerial = 0;
 
         std::unique_ptr<StagingBufferBase> mStagingBuffer;
 
@@ -0,0 +1,79 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn_native/CacheKey.h"
+
+#include "common/HashUtils.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace dawn_native {
+
+    void CacheKey::Record(uint32_t value) {
+        RecordBytes(&value, sizeof(value));
+    }
+
+    void CacheKey::Record(uint64_t value) {
+        RecordBytes(&value, sizeof(value));
+    }
+
+    void CacheKey::Record(const void* object) {
+        RecordBytes(&object, sizeof(object));
+    }
+
+    void CacheKey::Record(const std::string& value) {
+        Record(static_cast<uint32_t>(value.size()));
+        RecordBytes(value.data(), value.size());
+    }
+
+    const uint8_t* CacheKey::GetBytes() const {
+        return mHeapStorage != nullptr ? mHeapStorage.get() : mInlineStorage.data();
+    }
+
+    void CacheKey::RecordBytes(const void* data, size_t size) {
+        ASSERT(!mSealed);
+        if (mSize + size > mCapacity) {
+            size_t newCapacity = std::max(mCapacity * 2, mSize + size);
+            std::unique_ptr<uint8_t[]> newStorage(new uint8_t[newCapacity]);
+            memcpy(newStorage.get(), GetBytes(), mSize);
+            mHeapStorage = std::move(newStorage);
+            mCapacity = newCapacity;
+        }
+
+        uint8_t* bytes = mHeapStorage != nullptr ? mHeapStorage.get() : mInlineStorage.data();
+        memcpy(bytes + mSize, data, size);
+        mSize += size;
+    }
+
+    void CacheKey::Seal() {
+        ASSERT(!mSealed);
+        mHash = static_cast<size_t>(HashBytes(GetBytes(), mSize));
+        mSealed = true;
+    }
+
+    size_t CacheKey::GetHash() const {
+        ASSERT(mSealed);
+        return mHash;
+    }
+
+    bool CacheKey::operator==(const CacheKey& other) const {
+        ASSERT(mSealed && other.mSealed);
+        // Most keys compared by the caches have the same hash so the hash only filters the rare
+        // collisions of the buckets.
+        return mHash == other.mHash && mSize == other.mSize &&
+               memcmp(GetBytes(), other.GetBytes(), mSize) == 0;
+    }
+
+}  // namespace dawn_native
@@ -0,0 +1,93 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_CACHEKEY_H_
+#define DAWNNATIVE_CACHEKEY_H_
+
+#include "common/Assert.h"
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace dawn_native {
+
+    // CacheKey is the state of an object of the caches of the device (not to be confused with
+    // PersistentCacheKey) recorded as contiguous bytes, so that the caches hash it in a single
+    // pass and compare it with memcmp instead of walking the members of the objects. Descriptors
+    // are recorded with the packed structures of CacheKeys_autogen.h that don't have padding.
+    // Objects are recorded by address since the cached objects keep them alive.
+    //
+    // The key is sealed once complete, which computes its hash only once even though the caches
+    // hash objects several times.
+    //
+    // A key is built for every lookup in the caches so the bytes are stored inline. Only the keys
+    // of the largest objects, such as render pipelines with many attachments or vertex
+    // attributes, spill to the heap.
+    class CacheKey {
+      public:
+        CacheKey() = default;
+        CacheKey(const CacheKey& other) = delete;
+        CacheKey& operator=(const CacheKey& other) = delete;
+
+        void Record(uint32_t value);
+        void Record(uint64_t value);
+        void Record(const void* object);
+        // Strings are prefixed with their length so that different sequences of strings can't
+        // produce the same key.
+        void Record(const std::string& value);
+
+        template <typename E, typename = typename std::enable_if<std::is_enum<E>::value>::type>
+        void Record(E value) {
+            Record(static_cast<uint32_t>(value));
+        }
+
+        template <size_t N>
+        void Record(const std::bitset<N>& bits) {
+            static_assert(N <= 64, "");
+            Record(static_cast<uint64_t>(bits.to_ullong()));
+        }
+
+        // Records one of the packed structures of CacheKeys_autogen.h.
+        template <typename Packed>
+        void RecordPacked(const Packed& packed) {
+            static_assert(sizeof(Packed) % sizeof(uint32_t) == 0, "Packed must not have padding");
+            RecordBytes(&packed, sizeof(Packed));
+        }
+
+        void Seal();
+
+        size_t GetHash() const;
+        bool operator==(const CacheKey& other) const;
+
+      private:
+        static constexpr size_t kInlineStorageSize = 256;
+
+        const uint8_t* GetBytes() const;
+        void RecordBytes(const void* data, size_t size);
+
+        std::array<uint8_t, kInlineStorageSize> mInlineStorage;
+        std::unique_ptr<uint8_t[]> mHeapStorage;
+        size_t mSize = 0;
+        size_t mCapacity = kInlineStorageSize;
+        size_t mHash = 0;
+        bool mSealed = false;
+    };
+
+}  // namespace dawn_native
+
+#endif  // DAWNNATIVE_CACHEKEY_H_
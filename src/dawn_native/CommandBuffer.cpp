@@ -22,8 +22,11 @@
 
 namespace dawn_native {
 
-    CommandBufferBase::CommandBufferBase(CommandEncoder* encoder, const CommandBufferDescriptor*)
-        : ObjectBase(encoder->GetDevice()), mResourceUsages(encoder->AcquireResourceUsages()) {
+    CommandBufferBase::CommandBufferBase(CommandEncoder* encoder,
+                                         const CommandBufferDescriptor* descriptor)
+        : ObjectBase(encoder->GetDevice()),
+          mResourceUsages(encoder->AcquireResourceUsages()),
+          mIsReusable(descriptor != nullptr && descriptor->reusable) {
     }
 
     CommandBufferBase::CommandBufferBase(DeviceBase* device, ObjectBase::ErrorTag tag)
@@ -39,6 +42,10 @@ namespace dawn_native {
         return mResourceUsages;
     }
 
+    bool CommandBufferBase::IsReusable() const {
+        return mIsReusable;
+    }
+
     bool IsCompleteSubresourceCopiedTo(const TextureBase* texture,
                                        const Extent3D copySize,
                                        const uint32_t mipLevel) {
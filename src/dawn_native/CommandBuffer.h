@@ -32,10 +32,16 @@ namespace dawn_native {
 
         const CommandBufferResourceUsage& GetResourceUsages() const;
 
+        // Reusable command buffers are meant to be submitted many times. Submits make sure that
+        // replaying their commands gives the same result every time, so backends may cache the
+        // translation of the commands to the backend API between submits.
+        bool IsReusable() const;
+
       private:
         CommandBufferBase(DeviceBase* device, ObjectBase::ErrorTag tag);
 
         CommandBufferResourceUsage mResourceUsages;
+        bool mIsReusable = false;
     };
     bool IsCompleteSubresourceCopiedTo(const TextureBase* texture,
                                        const Extent3D copySize,
@@ -15,7 +15,7 @@
 #include "dawn_native/CommandBufferStateTracker.h"
 
 #include "common/Assert.h"
-#include "common/BitSetIterator.h"
+#include "common/Compiler.h"
 #include "dawn_native/BindGroup.h"
 #include "dawn_native/ComputePipeline.h"
 #include "dawn_native/Forward.h"
@@ -45,9 +45,6 @@ namespace dawn_native {
         1 << VALIDATION_ASPECT_PIPELINE | 1 << VALIDATION_ASPECT_BIND_GROUPS |
         1 << VALIDATION_ASPECT_VERTEX_BUFFERS | 1 << VALIDATION_ASPECT_INDEX_BUFFER;
 
-    static constexpr CommandBufferStateTracker::ValidationAspects kLazyAspects =
-        1 << VALIDATION_ASPECT_BIND_GROUPS | 1 << VALIDATION_ASPECT_VERTEX_BUFFERS;
-
     MaybeError CommandBufferStateTracker::ValidateCanDispatch() {
         return ValidateOperation(kDispatchAspects);
     }
@@ -61,57 +58,11 @@ namespace dawn_native {
     }
 
     MaybeError CommandBufferStateTracker::ValidateOperation(ValidationAspects requiredAspects) {
-        // Fast return-true path if everything is good
         ValidationAspects missingAspects = requiredAspects & ~mAspects;
-        if (missingAspects.none()) {
+        if (DAWN_LIKELY(missingAspects.none())) {
             return {};
         }
-
-        // Generate an error immediately if a non-lazy aspect is missing as computing lazy aspects
-        // requires the pipeline to be set.
-        if ((missingAspects & ~kLazyAspects).any()) {
-            return GenerateAspectError(missingAspects);
-        }
-
-        RecomputeLazyAspects(missingAspects);
-
-        missingAspects = requiredAspects & ~mAspects;
-        if (missingAspects.any()) {
-            return GenerateAspectError(missingAspects);
-        }
-
-        return {};
-    }
-
-    void CommandBufferStateTracker::RecomputeLazyAspects(ValidationAspects aspects) {
-        ASSERT(mAspects[VALIDATION_ASPECT_PIPELINE]);
-        ASSERT((aspects & ~kLazyAspects).none());
-
-        if (aspects[VALIDATION_ASPECT_BIND_GROUPS]) {
-            bool matches = true;
-
-            for (uint32_t i : IterateBitSet(mLastPipelineLayout->GetBindGroupLayoutsMask())) {
-                if (mBindgroups[i] == nullptr ||
-                    mLastPipelineLayout->GetBindGroupLayout(i) != mBindgroups[i]->GetLayout()) {
-                    matches = false;
-                    break;
-                }
-            }
-
-            if (matches) {
-                mAspects.set(VALIDATION_ASPECT_BIND_GROUPS);
-            }
-        }
-
-        if (aspects[VALIDATION_ASPECT_VERTEX_BUFFERS]) {
-            ASSERT(mLastRenderPipeline != nullptr);
-
-            const std::bitset<kMaxVertexBuffers>& requiredVertexBuffers =
-                mLastRenderPipeline->GetVertexBufferSlotsUsed();
-            if ((mVertexBufferSlotsUsed & requiredVertexBuffers) == requiredVertexBuffers) {
-                mAspects.set(VALIDATION_ASPECT_VERTEX_BUFFERS);
-            }
-        }
+        return GenerateAspectError(missingAspects);
     }
 
     MaybeError CommandBufferStateTracker::GenerateAspectError(ValidationAspects aspects) {
@@ -137,16 +88,19 @@ namespace dawn_native {
     }
 
     void CommandBufferStateTracker::SetComputePipeline(ComputePipelineBase* pipeline) {
+        mRequiredVertexBuffers.reset();
         SetPipelineCommon(pipeline);
     }
 
     void CommandBufferStateTracker::SetRenderPipeline(RenderPipelineBase* pipeline) {
-        mLastRenderPipeline = pipeline;
+        mRequiredVertexBuffers = pipeline->GetVertexBufferSlotsUsed();
         SetPipelineCommon(pipeline);
     }
 
     void CommandBufferStateTracker::SetBindGroup(uint32_t index, BindGroupBase* bindgroup) {
         mBindgroups[index] = bindgroup;
+        mCompatibleBindGroups.set(index, IsBindGroupCompatible(index));
+        UpdateBindGroupsAspect();
     }
 
     void CommandBufferStateTracker::SetIndexBuffer() {
@@ -155,15 +109,40 @@ namespace dawn_native {
 
     void CommandBufferStateTracker::SetVertexBuffer(uint32_t slot) {
         mVertexBufferSlotsUsed.set(slot);
+        UpdateVertexBuffersAspect();
     }
 
     void CommandBufferStateTracker::SetPipelineCommon(PipelineBase* pipeline) {
-        mLastPipelineLayout = pipeline->GetLayout();
+        PipelineLayoutBase* layout = pipeline->GetLayout();
+
+        // Pipelines sharing a layout have the same bind group requirements so the compatibility
+        // of the current bind groups only needs to be recomputed when the layout changes.
+        if (layout != mLastPipelineLayout) {
+            mLastPipelineLayout = layout;
+            mRequiredBindGroups = layout->GetBindGroupLayoutsMask();
+            for (uint32_t i = 0; i < kMaxBindGroups; ++i) {
+                mCompatibleBindGroups.set(i, IsBindGroupCompatible(i));
+            }
+        }
 
         mAspects.set(VALIDATION_ASPECT_PIPELINE);
+        UpdateBindGroupsAspect();
+        UpdateVertexBuffersAspect();
+    }
+
+    void CommandBufferStateTracker::UpdateBindGroupsAspect() {
+        mAspects.set(VALIDATION_ASPECT_BIND_GROUPS,
+                     (mRequiredBindGroups & ~mCompatibleBindGroups).none());
+    }
+
+    void CommandBufferStateTracker::UpdateVertexBuffersAspect() {
+        mAspects.set(VALIDATION_ASPECT_VERTEX_BUFFERS,
+                     (mRequiredVertexBuffers & ~mVertexBufferSlotsUsed).none());
+    }
 
-        // Reset lazy aspects so they get recomputed on the next operation.
-        mAspects &= ~kLazyAspects;
+    bool CommandBufferStateTracker::IsBindGroupCompatible(uint32_t index) const {
+        return mRequiredBindGroups[index] && mBindgroups[index] != nullptr &&
+               mLastPipelineLayout->GetBindGroupLayout(index) == mBindgroups[index]->GetLayout();
     }
 
 }  // namespace dawn_native
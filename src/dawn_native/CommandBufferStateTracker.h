@@ -45,18 +45,30 @@ namespace dawn_native {
 
       private:
         MaybeError ValidateOperation(ValidationAspects requiredAspects);
-        void RecomputeLazyAspects(ValidationAspects aspects);
         MaybeError GenerateAspectError(ValidationAspects aspects);
 
         void SetPipelineCommon(PipelineBase* pipeline);
 
+        // The aspects are kept up to date as state is set so that validating a draw or a dispatch
+        // is a single mask comparison. The bind group and vertex buffer aspects are derived from
+        // the masks below.
+        void UpdateBindGroupsAspect();
+        void UpdateVertexBuffersAspect();
+        bool IsBindGroupCompatible(uint32_t index) const;
+
         ValidationAspects mAspects;
 
         std::array<BindGroupBase*, kMaxBindGroups> mBindgroups = {};
         std::bitset<kMaxVertexBuffers> mVertexBufferSlotsUsed;
 
+        // The signature required by the current pipeline, precomputed by the pipeline and its
+        // layout, and the bind groups that currently match it. Bind group layouts are deduplicated
+        // by the device so comparing their pointers is enough to check compatibility.
+        std::bitset<kMaxBindGroups> mRequiredBindGroups;
+        std::bitset<kMaxBindGroups> mCompatibleBindGroups;
+        std::bitset<kMaxVertexBuffers> mRequiredVertexBuffers;
+
         PipelineLayoutBase* mLastPipelineLayout = nullptr;
-        RenderPipelineBase* mLastRenderPipeline = nullptr;
     };
 
 }  // namespace dawn_native
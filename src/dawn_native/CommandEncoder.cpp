@@ -489,6 +489,10 @@ namespace dawn_native {
         : ObjectBase(device), mEncodingContext(device, this) {
     }
 
+    void CommandEncoder::DeleteThis() {
+        GetDevice()->GetCommandEncoderPool()->Free(this);
+    }
+
     CommandBufferResourceUsage CommandEncoder::AcquireResourceUsages() {
         return CommandBufferResourceUsage{mEncodingContext.AcquirePassUsages(),
                                           std::move(mTopLevelBuffers),
@@ -515,7 +519,7 @@ namespace dawn_native {
 
         if (success) {
             ComputePassEncoder* passEncoder =
-                new ComputePassEncoder(device, this, &mEncodingContext);
+                device->GetComputePassEncoderPool()->Allocate(device, this, &mEncodingContext);
             mEncodingContext.EnterPass(passEncoder);
             return passEncoder;
         }
@@ -591,8 +595,8 @@ namespace dawn_native {
             });
 
         if (success) {
-            RenderPassEncoder* passEncoder =
-                new RenderPassEncoder(device, this, &mEncodingContext, std::move(usageTracker));
+            RenderPassEncoder* passEncoder = device->GetRenderPassEncoderPool()->Allocate(
+                device, this, &mEncodingContext, std::move(usageTracker));
             mEncodingContext.EnterPass(passEncoder);
             return passEncoder;
         }
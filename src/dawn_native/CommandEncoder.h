@@ -17,6 +17,7 @@
 
 #include "dawn_native/dawn_platform.h"
 
+#include "common/PlacementAllocated.h"
 #include "dawn_native/EncodingContext.h"
 #include "dawn_native/Error.h"
 #include "dawn_native/ObjectBase.h"
@@ -28,7 +29,8 @@ namespace dawn_native {
 
     struct BeginRenderPassCmd;
 
-    class CommandEncoder final : public ObjectBase {
+    // Allocated from the pool of the device, see DeviceBase::GetCommandEncoderPool.
+    class CommandEncoder final : public ObjectBase, public PlacementAllocated {
       public:
         CommandEncoder(DeviceBase* device, const CommandEncoderDescriptor* descriptor);
 
@@ -61,6 +63,8 @@ namespace dawn_native {
         CommandBufferBase* Finish(const CommandBufferDescriptor* descriptor);
 
       private:
+        void DeleteThis() override;
+
         MaybeError ValidateFinish(CommandIterator* commands,
                                   const PerPassUsages& perPassUsages) const;
 
@@ -112,7 +112,8 @@ namespace dawn_native {
                 }
 
                 default:
-                    return DAWN_VALIDATION_ERROR(disallowedMessage);
+                    return DAWN_MAKE_ERROR_FROM_STRING(InternalErrorType::Validation,
+                                                       disallowedMessage);
             }
 
             return {};
@@ -39,7 +39,12 @@ namespace dawn_native {
     ComputePassEncoder* ComputePassEncoder::MakeError(DeviceBase* device,
                                                       CommandEncoder* commandEncoder,
                                                       EncodingContext* encodingContext) {
-        return new ComputePassEncoder(device, commandEncoder, encodingContext, ObjectBase::kError);
+        return device->GetComputePassEncoderPool()->Allocate(
+            device, commandEncoder, encodingContext, ObjectBase::kError);
+    }
+
+    void ComputePassEncoder::DeleteThis() {
+        GetDevice()->GetComputePassEncoderPool()->Free(this);
     }
 
     void ComputePassEncoder::EndPass() {
@@ -87,6 +92,11 @@ namespace dawn_native {
         mEncodingContext->TryEncode(this, [&](CommandAllocator* allocator) -> MaybeError {
             DAWN_TRY(GetDevice()->ValidateObject(pipeline));
 
+            if (mElideRedundantCommands && mRedundantCommandTracker.SetPipeline(pipeline)) {
+                GetDevice()->IncrementElidedCommandCount();
+                return {};
+            }
+
             SetComputePipelineCmd* cmd =
                 allocator->Allocate<SetComputePipelineCmd>(Command::SetComputePipeline);
             cmd->pipeline = pipeline;
@@ -15,17 +15,24 @@
 #ifndef DAWNNATIVE_COMPUTEPASSENCODER_H_
 #define DAWNNATIVE_COMPUTEPASSENCODER_H_
 
+#include "common/PlacementAllocated.h"
 #include "dawn_native/Error.h"
 #include "dawn_native/ProgrammablePassEncoder.h"
 
 namespace dawn_native {
 
-    class ComputePassEncoder final : public ProgrammablePassEncoder {
+    // Allocated from the pool of the device, see DeviceBase::GetComputePassEncoderPool.
+    class ComputePassEncoder final : public ProgrammablePassEncoder, public PlacementAllocated {
       public:
         ComputePassEncoder(DeviceBase* device,
                            CommandEncoder* commandEncoder,
                            EncodingContext* encodingContext);
 
+        ComputePassEncoder(DeviceBase* device,
+                           CommandEncoder* commandEncoder,
+                           EncodingContext* encodingContext,
+                           ErrorTag errorTag);
+
         static ComputePassEncoder* MakeError(DeviceBase* device,
                                              CommandEncoder* commandEncoder,
                                              EncodingContext* encodingContext);
@@ -36,13 +43,9 @@ namespace dawn_native {
         void DispatchIndirect(BufferBase* indirectBuffer, uint64_t indirectOffset);
         void SetPipeline(ComputePipelineBase* pipeline);
 
-      protected:
-        ComputePassEncoder(DeviceBase* device,
-                           CommandEncoder* commandEncoder,
-                           EncodingContext* encodingContext,
-                           ErrorTag errorTag);
-
       private:
+        void DeleteThis() override;
+
         // For render and compute passes, the encoding context is borrowed from the command encoder.
         // Keep a reference to the encoder to make sure the context isn't freed.
         Ref<CommandEncoder> mCommandEncoder;
@@ -14,7 +14,11 @@
 
 #include "dawn_native/DawnNative.h"
 #include "dawn_native/Device.h"
+#include "dawn_native/DynamicUploader.h"
+#include "dawn_native/Fence.h"
 #include "dawn_native/Instance.h"
+#include "dawn_native/ShaderCompileTracker.h"
+#include "dawn_native/SubmitCoalescer.h"
 #include "dawn_native/Texture.h"
 #include "dawn_platform/DawnPlatform.h"
 
@@ -161,11 +165,124 @@ namespace dawn_native {
         return reinterpret_cast<WGPUInstance>(mImpl);
     }
 
+    bool WaitForFence(WGPUFence fence, uint64_t value, uint64_t timeoutNs) {
+        Fence* fenceBase = reinterpret_cast<Fence*>(fence);
+        ApiScope scope(fenceBase->GetDevice());
+        return fenceBase->Wait(value, timeoutNs);
+    }
+
+    bool WaitForBufferMapping(WGPUDevice device, uint64_t timeoutNs) {
+        DeviceBase* deviceBase = reinterpret_cast<DeviceBase*>(device);
+        ApiScope scope(deviceBase);
+        bool completed = false;
+        if (deviceBase->ConsumedError(deviceBase->WaitForBufferMapping(timeoutNs), &completed)) {
+            return false;
+        }
+        return completed;
+    }
+
+    void ProcessEvents(WGPUDevice device) {
+        DeviceBase* deviceBase = reinterpret_cast<DeviceBase*>(device);
+        ApiScope scope(deviceBase);
+        deviceBase->ProcessEvents();
+    }
+
+    std::vector<WGPUShaderModule> CreateShaderModules(
+        WGPUDevice device,
+        uint32_t count,
+        const WGPUShaderModuleDescriptor* descriptors) {
+        DeviceBase* deviceBase = reinterpret_cast<DeviceBase*>(device);
+        ApiScope scope(deviceBase);
+
+        std::vector<WGPUShaderModule> modules(count);
+        deviceBase->CreateShaderModules(
+            count, reinterpret_cast<const ShaderModuleDescriptor*>(descriptors),
+            reinterpret_cast<ShaderModuleBase**>(modules.data()));
+        return modules;
+    }
+
+    ShaderCompileStatistics GetShaderCompileStatistics(WGPUDevice device) {
+        DeviceBase* deviceBase = reinterpret_cast<DeviceBase*>(device);
+        ApiScope scope(deviceBase);
+        return deviceBase->GetShaderCompileTracker()->GetStatistics();
+    }
+
     size_t GetLazyClearCountForTesting(WGPUDevice device) {
         dawn_native::DeviceBase* deviceBase = reinterpret_cast<dawn_native::DeviceBase*>(device);
         return deviceBase->GetLazyClearCountForTesting();
     }
 
+    size_t GetLazyClearBatchCountForTesting(WGPUDevice device) {
+        dawn_native::DeviceBase* deviceBase = reinterpret_cast<dawn_native::DeviceBase*>(device);
+        return deviceBase->GetLazyClearBatchCountForTesting();
+    }
+
+    size_t GetSpirvValidationCountForTesting(WGPUDevice device) {
+        dawn_native::DeviceBase* deviceBase = reinterpret_cast<dawn_native::DeviceBase*>(device);
+        return deviceBase->GetSpirvValidationCountForTesting();
+    }
+
+    size_t GetElidedCommandCountForTesting(WGPUDevice device) {
+        dawn_native::DeviceBase* deviceBase = reinterpret_cast<dawn_native::DeviceBase*>(device);
+        return deviceBase->GetElidedCommandCount();
+    }
+
+    size_t GetPendingCommandBufferCountForTesting(WGPUDevice device) {
+        dawn_native::DeviceBase* deviceBase = reinterpret_cast<dawn_native::DeviceBase*>(device);
+        return deviceBase->GetSubmitCoalescer()->GetPendingCommandBufferCount();
+    }
+
+    uint64_t GetUsedStagingMemoryForTesting(WGPUDevice device) {
+        dawn_native::DeviceBase* deviceBase = reinterpret_cast<dawn_native::DeviceBase*>(device);
+        std::lock_guard<std::recursive_mutex> lock(*deviceBase->GetApiMutex());
+        return deviceBase->GetDynamicUploader()->GetUsedSize();
+    }
+
+    size_t GetDeferredCallbackCountForTesting(WGPUDevice device) {
+        dawn_native::DeviceBase* deviceBase = reinterpret_cast<dawn_native::DeviceBase*>(device);
+        std::lock_guard<std::recursive_mutex> lock(*deviceBase->GetApiMutex());
+        return deviceBase->GetDeferredCallbackCountForTesting();
+    }
+
+    void WaitForBackgroundTicksForTesting(WGPUDevice device, uint32_t count) {
+        dawn_native::DeviceBase* deviceBase = reinterpret_cast<dawn_native::DeviceBase*>(device);
+        // The API mutex isn't taken since the background ticks need it.
+        deviceBase->WaitForBackgroundTicksForTesting(count);
+    }
+
+    namespace {
+
+        template <typename GetCount>
+        PooledObjectCounts GetPooledObjectCounts(WGPUDevice device, GetCount getCount) {
+            const ObjectPoolCounters* counters =
+                reinterpret_cast<DeviceBase*>(device)->GetObjectPoolCounters();
+
+            PooledObjectCounts counts;
+            counts.bindGroups = getCount(counters, PooledObjectType::BindGroup);
+            counts.commandBuffers = getCount(counters, PooledObjectType::CommandBuffer);
+            counts.commandEncoders = getCount(counters, PooledObjectType::CommandEncoder);
+            counts.computePassEncoders = getCount(counters, PooledObjectType::ComputePassEncoder);
+            counts.renderPassEncoders = getCount(counters, PooledObjectType::RenderPassEncoder);
+            counts.textureViews = getCount(counters, PooledObjectType::TextureView);
+            return counts;
+        }
+
+    }  // anonymous namespace
+
+    PooledObjectCounts GetPooledAllocationCountsForTesting(WGPUDevice device) {
+        return GetPooledObjectCounts(
+            device, [](const ObjectPoolCounters* counters, PooledObjectType type) {
+                return counters->GetAllocationCount(type);
+            });
+    }
+
+    PooledObjectCounts GetPooledLiveObjectCountsForTesting(WGPUDevice device) {
+        return GetPooledObjectCounts(
+            device, [](const ObjectPoolCounters* counters, PooledObjectType type) {
+                return counters->GetLiveCount(type);
+            });
+    }
+
     bool IsTextureSubresourceInitialized(WGPUTexture texture,
                                          uint32_t baseMipLevel,
                                          uint32_t levelCount,
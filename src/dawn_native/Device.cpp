@@ -16,30 +16,44 @@
 
 #include "dawn_native/Adapter.h"
 #include "dawn_native/AttachmentState.h"
+#include "dawn_native/BackgroundTicker.h"
 #include "dawn_native/BindGroup.h"
 #include "dawn_native/BindGroupLayout.h"
 #include "dawn_native/Buffer.h"
 #include "dawn_native/CommandBuffer.h"
 #include "dawn_native/CommandEncoder.h"
+#include "dawn_native/ComputePassEncoder.h"
 #include "dawn_native/ComputePipeline.h"
 #include "dawn_native/DynamicUploader.h"
 #include "dawn_native/ErrorData.h"
+#include "dawn_native/ErrorInjector.h"
 #include "dawn_native/ErrorScope.h"
 #include "dawn_native/ErrorScopeTracker.h"
 #include "dawn_native/Fence.h"
 #include "dawn_native/FenceSignalTracker.h"
 #include "dawn_native/Instance.h"
+#include "dawn_native/PersistentCache.h"
 #include "dawn_native/PipelineLayout.h"
 #include "dawn_native/Queue.h"
 #include "dawn_native/RenderBundleEncoder.h"
+#include "dawn_native/RenderPassEncoder.h"
 #include "dawn_native/RenderPipeline.h"
 #include "dawn_native/Sampler.h"
+#include "dawn_native/ShaderCompileTracker.h"
 #include "dawn_native/ShaderModule.h"
+#include "dawn_native/SubmitCoalescer.h"
 #include "dawn_native/Surface.h"
 #include "dawn_native/SwapChain.h"
 #include "dawn_native/Texture.h"
 #include "dawn_native/ValidationUtils_autogen.h"
-
+#include "dawn_native/WorkerPool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <limits>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace dawn_native {
@@ -52,6 +66,41 @@ namespace dawn_native {
     using ContentLessObjectCache =
         std::unordered_set<Object*, typename Object::HashFunc, typename Object::EqualityFunc>;
 
+    // Remembers the code of released shader modules that passed validation, so that creating them
+    // again doesn't run the SPIR-V validator. The code itself is kept instead of only its hash so
+    // that a hash collision can't make invalid code skip validation. The oldest entries are
+    // evicted when the memo is full.
+    class ValidatedShaderCodeMemo {
+      public:
+        static constexpr size_t kMaxEntries = 64;
+
+        bool Contains(const ShaderModuleContent* content) const {
+            return mEntrySet.count(content) != 0;
+        }
+
+        // Takes the code of |content|, which must not be used anymore.
+        void Add(ShaderModuleContent* content) {
+            if (Contains(content)) {
+                return;
+            }
+
+            if (mEntries.size() == kMaxEntries) {
+                mEntrySet.erase(mEntries.front().get());
+                mEntries.pop_front();
+            }
+
+            mEntries.push_back(std::make_unique<ShaderModuleContent>(std::move(*content)));
+            mEntrySet.insert(mEntries.back().get());
+        }
+
+      private:
+        std::deque<std::unique_ptr<ShaderModuleContent>> mEntries;
+        std::unordered_set<const ShaderModuleContent*,
+                           ShaderModuleContent::HashFunc,
+                           ShaderModuleContent::EqualityFunc>
+            mEntrySet;
+    };
+
     struct DeviceBase::Caches {
         ContentLessObjectCache<AttachmentStateBlueprint> attachmentStates;
         ContentLessObjectCache<BindGroupLayoutBase> bindGroupLayouts;
@@ -59,7 +108,23 @@ namespace dawn_native {
         ContentLessObjectCache<PipelineLayoutBase> pipelineLayouts;
         ContentLessObjectCache<RenderPipelineBase> renderPipelines;
         ContentLessObjectCache<SamplerBase> samplers;
-        ContentLessObjectCache<ShaderModuleBase> shaderModules;
+        ContentLessObjectCache<ShaderModuleContent> shaderModules;
+
+        ValidatedShaderCodeMemo validatedShaderCode;
+    };
+
+    // DeviceBase::ObjectPools
+
+    struct DeviceBase::ObjectPools {
+        ObjectPools(ObjectPoolCounters* counters)
+            : commandEncoders(counters, PooledObjectType::CommandEncoder),
+              computePassEncoders(counters, PooledObjectType::ComputePassEncoder),
+              renderPassEncoders(counters, PooledObjectType::RenderPassEncoder) {
+        }
+
+        ObjectPool<CommandEncoder> commandEncoders;
+        ObjectPool<ComputePassEncoder> computePassEncoders;
+        ObjectPool<RenderPassEncoder> renderPassEncoders;
     };
 
     // DeviceBase
@@ -69,9 +134,13 @@ namespace dawn_native {
           mRootErrorScope(AcquireRef(new ErrorScope())),
           mCurrentErrorScope(mRootErrorScope.Get()) {
         mCaches = std::make_unique<DeviceBase::Caches>();
+        mObjectPools = std::make_unique<DeviceBase::ObjectPools>(&mObjectPoolCounters);
         mErrorScopeTracker = std::make_unique<ErrorScopeTracker>(this);
         mFenceSignalTracker = std::make_unique<FenceSignalTracker>(this);
+        mSubmitCoalescer = std::make_unique<SubmitCoalescer>(this);
         mDynamicUploader = std::make_unique<DynamicUploader>(this);
+        mPersistentCache = std::make_unique<PersistentCache>(this);
+        mShaderCompileTracker = std::make_unique<ShaderCompileTracker>();
         SetDefaultToggles();
 
         if (descriptor != nullptr) {
@@ -93,9 +162,22 @@ namespace dawn_native {
         ASSERT(mCaches->renderPipelines.empty());
         ASSERT(mCaches->samplers.empty());
         ASSERT(mCaches->shaderModules.empty());
+
+        // All the pooled objects must have been released before their pool is destroyed.
+        for (size_t i = 0; i < static_cast<size_t>(PooledObjectType::EnumCount); ++i) {
+            ASSERT(mObjectPoolCounters.GetLiveCount(static_cast<PooledObjectType>(i)) == 0);
+        }
     }
 
     void DeviceBase::BaseDestructor() {
+        // Stop the background tick thread before the backend starts being destroyed, the
+        // callbacks it deferred are still delivered.
+        mBackgroundTicker = nullptr;
+        ProcessDeferredCallbacks();
+
+        // Command buffers that were never submitted to the backend can't complete anymore.
+        mSubmitCoalescer->Discard();
+
         if (mLossStatus != LossStatus::Alive) {
             // if device is already lost, we may still have fences and error scopes to clear since
             // the time the device was lost, clear them now before we destruct the device.
@@ -110,6 +192,12 @@ namespace dawn_native {
     }
 
     void DeviceBase::HandleError(InternalErrorType type, const char* message) {
+        HandleErrorInScope(type, message, mCurrentErrorScope.Get());
+    }
+
+    void DeviceBase::HandleErrorInScope(InternalErrorType type,
+                                        const char* message,
+                                        ErrorScope* scope) {
         // If we receive an internal error, assume the backend can't recover and proceed with
         // device destruction. We first wait for all previous commands to be completed so that
         // backend objects can be freed immediately, before handling the loss.
@@ -127,7 +215,7 @@ namespace dawn_native {
         }
 
         // Still forward device loss and internal errors to the error scopes so they all reject.
-        mCurrentErrorScope->HandleError(ToWGPUErrorType(type), message);
+        scope->HandleError(ToWGPUErrorType(type), message);
     }
 
     void DeviceBase::InjectError(wgpu::ErrorType type, const char* message) {
@@ -147,8 +235,21 @@ namespace dawn_native {
     }
 
     void DeviceBase::ConsumeError(std::unique_ptr<ErrorData> error) {
+        ConsumeErrorInScope(std::move(error), mCurrentErrorScope.Get());
+    }
+
+    void DeviceBase::ConsumeErrorInScope(std::unique_ptr<ErrorData> error, ErrorScope* scope) {
         ASSERT(error != nullptr);
-        HandleError(error->GetType(), error->GetMessage().c_str());
+        ASSERT(scope != nullptr);
+
+        // Validation and out of memory errors don't affect the device, give them to the error
+        // scopes directly so that their message is only formatted if it is observed.
+        InternalErrorType type = error->GetType();
+        if (type == InternalErrorType::Validation || type == InternalErrorType::OutOfMemory) {
+            scope->HandleError(std::move(error));
+            return;
+        }
+        HandleErrorInScope(type, error->GetMessage().c_str(), scope);
     }
 
     void DeviceBase::SetUncapturedErrorCallback(wgpu::ErrorCallback callback, void* userdata) {
@@ -205,6 +306,7 @@ namespace dawn_native {
             return;
         }
 
+        mSubmitCoalescer->Discard();
         Destroy();
         mLossStatus = LossStatus::AlreadyLost;
 
@@ -241,6 +343,26 @@ namespace dawn_native {
         return mFenceSignalTracker.get();
     }
 
+    ObjectPoolCounters* DeviceBase::GetObjectPoolCounters() {
+        return &mObjectPoolCounters;
+    }
+
+    ObjectPool<CommandEncoder>* DeviceBase::GetCommandEncoderPool() {
+        return &mObjectPools->commandEncoders;
+    }
+
+    ObjectPool<ComputePassEncoder>* DeviceBase::GetComputePassEncoderPool() {
+        return &mObjectPools->computePassEncoders;
+    }
+
+    ObjectPool<RenderPassEncoder>* DeviceBase::GetRenderPassEncoderPool() {
+        return &mObjectPools->renderPassEncoders;
+    }
+
+    SubmitCoalescer* DeviceBase::GetSubmitCoalescer() const {
+        return mSubmitCoalescer.get();
+    }
+
     ResultOrError<const Format*> DeviceBase::GetInternalFormat(wgpu::TextureFormat format) const {
         size_t index = ComputeFormatIndex(format);
         if (index >= mFormatTable.size()) {
@@ -296,7 +418,11 @@ namespace dawn_native {
         }
 
         ComputePipelineBase* backendObj;
-        DAWN_TRY_ASSIGN(backendObj, CreateComputePipelineImpl(descriptor));
+        {
+            ScopedShaderCompileTimer timer(this, ShaderCompilePhase::PipelineCreation,
+                                           {descriptor->computeStage.module});
+            DAWN_TRY_ASSIGN(backendObj, CreateComputePipelineImpl(descriptor));
+        }
         backendObj->SetIsCachedReference();
         mCaches->computePipelines.insert(backendObj);
         return backendObj;
@@ -342,7 +468,14 @@ namespace dawn_native {
         }
 
         RenderPipelineBase* backendObj;
-        DAWN_TRY_ASSIGN(backendObj, CreateRenderPipelineImpl(descriptor));
+        {
+            ScopedShaderCompileTimer timer(this, ShaderCompilePhase::PipelineCreation,
+                                           {descriptor->vertexStage.module,
+                                            descriptor->fragmentStage != nullptr
+                                                ? descriptor->fragmentStage->module
+                                                : nullptr});
+            DAWN_TRY_ASSIGN(backendObj, CreateRenderPipelineImpl(descriptor));
+        }
         backendObj->SetIsCachedReference();
         mCaches->renderPipelines.insert(backendObj);
         return backendObj;
@@ -379,25 +512,55 @@ namespace dawn_native {
 
     ResultOrError<ShaderModuleBase*> DeviceBase::GetOrCreateShaderModule(
         const ShaderModuleDescriptor* descriptor) {
-        ShaderModuleBase blueprint(this, descriptor);
+        ShaderModuleContent blueprint(descriptor);
 
+        // Cached modules have the same code as the descriptor, which already passed validation.
         auto iter = mCaches->shaderModules.find(&blueprint);
         if (iter != mCaches->shaderModules.end()) {
-            (*iter)->Reference();
-            return *iter;
+            ShaderModuleBase* module = static_cast<ShaderModuleBase*>(*iter);
+            module->Reference();
+            return module;
         }
 
         ShaderModuleBase* backendObj;
-        DAWN_TRY_ASSIGN(backendObj, CreateShaderModuleImpl(descriptor));
+        DAWN_TRY_ASSIGN(backendObj,
+                        CreateUncachedShaderModule(descriptor, &blueprint,
+                                                   ShaderCodeNeedsValidation(&blueprint)));
         backendObj->SetIsCachedReference();
         mCaches->shaderModules.insert(backendObj);
         return backendObj;
     }
 
+    ResultOrError<ShaderModuleBase*> DeviceBase::CreateUncachedShaderModule(
+        const ShaderModuleDescriptor* descriptor,
+        const ShaderModuleContent* content,
+        bool validateSpirv) {
+        if (validateSpirv) {
+            ScopedShaderCompileTimer timer(this, ShaderCompilePhase::Validation, {content});
+            ++mSpirvValidationCountForTesting;
+            DAWN_TRY(ValidateSpirv(descriptor->code, descriptor->codeSize));
+        }
+        return CreateShaderModuleImpl(descriptor);
+    }
+
+    bool DeviceBase::IsShaderModuleCreationThreadSafe() const {
+        return false;
+    }
+
+    bool DeviceBase::ShaderCodeNeedsValidation(const ShaderModuleContent* content) const {
+        return IsValidationEnabled() && !mCaches->validatedShaderCode.Contains(content);
+    }
+
     void DeviceBase::UncacheShaderModule(ShaderModuleBase* obj) {
         ASSERT(obj->IsCachedReference());
         size_t removedCount = mCaches->shaderModules.erase(obj);
         ASSERT(removedCount == 1);
+
+        // The module is being destroyed so its code can be moved to the memo in case the module
+        // is created again.
+        if (IsValidationEnabled()) {
+            mCaches->validatedShaderCode.Add(obj);
+        }
     }
 
     Ref<AttachmentState> DeviceBase::GetOrCreateAttachmentState(
@@ -521,7 +684,7 @@ namespace dawn_native {
         mDeferredCreateBufferMappedAsyncResults.push_back(deferred_info);
     }
     CommandEncoder* DeviceBase::CreateCommandEncoder(const CommandEncoderDescriptor* descriptor) {
-        return new CommandEncoder(this, descriptor);
+        return GetCommandEncoderPool()->Allocate(this, descriptor);
     }
     ComputePipelineBase* DeviceBase::CreateComputePipeline(
         const ComputePipelineDescriptor* descriptor) {
@@ -622,6 +785,136 @@ namespace dawn_native {
 
     // Other Device API methods
 
+    void DeviceBase::CreateShaderModules(uint32_t count,
+                                         const ShaderModuleDescriptor* descriptors,
+                                         ShaderModuleBase** results) {
+        // The creation of the modules that aren't cached is split in jobs that don't touch the
+        // device and run in parallel on the backends that allow it, with one job per distinct
+        // code. Everything else, including the reporting of errors, is done in the order of the
+        // descriptors so that the results are the same as when creating the modules one by one.
+        struct Job {
+            explicit Job(const ShaderModuleDescriptor* descriptor)
+                : descriptor(descriptor), content(descriptor) {
+            }
+
+            const ShaderModuleDescriptor* descriptor;
+            ShaderModuleContent content;
+            bool validateSpirv = false;
+
+            ShaderModuleBase* module = nullptr;
+            std::unique_ptr<ErrorData> error;
+            bool isCached = false;
+        };
+        constexpr size_t kNoJob = std::numeric_limits<size_t>::max();
+
+        // Reserved so that the contents used as keys of jobIndices don't move.
+        std::vector<Job> jobs;
+        jobs.reserve(count);
+        std::unordered_map<const ShaderModuleContent*, size_t, ShaderModuleContent::HashFunc,
+                           ShaderModuleContent::EqualityFunc>
+            jobIndices;
+
+        std::vector<size_t> descriptorJobs(count, kNoJob);
+        std::vector<std::unique_ptr<ErrorData>> validationErrors(count);
+
+        for (uint32_t i = 0; i < count; ++i) {
+            const ShaderModuleDescriptor* descriptor = &descriptors[i];
+            results[i] = nullptr;
+
+            MaybeError validation = ValidateIsAlive();
+            if (!validation.IsError() && IsValidationEnabled()) {
+                validation = ValidateShaderModuleDescriptor(this, descriptor);
+            }
+            if (validation.IsError()) {
+                validationErrors[i] = validation.AcquireError();
+                continue;
+            }
+
+            ShaderModuleContent blueprint(descriptor);
+            auto cacheIter = mCaches->shaderModules.find(&blueprint);
+            if (cacheIter != mCaches->shaderModules.end()) {
+                results[i] = static_cast<ShaderModuleBase*>(*cacheIter);
+                results[i]->Reference();
+                continue;
+            }
+
+            auto jobIter = jobIndices.find(&blueprint);
+            if (jobIter != jobIndices.end()) {
+                descriptorJobs[i] = jobIter->second;
+                continue;
+            }
+
+            descriptorJobs[i] = jobs.size();
+            jobs.emplace_back(descriptor);
+            jobs.back().validateSpirv = ShaderCodeNeedsValidation(&jobs.back().content);
+            jobIndices[&jobs.back().content] = descriptorJobs[i];
+        }
+
+        auto RunJob = [this, &jobs](size_t index) {
+            Job& job = jobs[index];
+            ResultOrError<ShaderModuleBase*> result =
+                CreateUncachedShaderModule(job.descriptor, &job.content, job.validateSpirv);
+            if (result.IsError()) {
+                job.error = result.AcquireError();
+            } else {
+                job.module = result.AcquireSuccess();
+            }
+        };
+
+        // Errors are injected based on the order of the calls, which must stay deterministic.
+        if (ErrorInjectorEnabled() || !IsShaderModuleCreationThreadSafe()) {
+            for (size_t i = 0; i < jobs.size(); ++i) {
+                RunJob(i);
+            }
+        } else {
+            if (mWorkerPool == nullptr) {
+                mWorkerPool = std::make_unique<WorkerPool>();
+            }
+            mWorkerPool->ParallelFor(jobs.size(), RunJob);
+        }
+
+        // The modules may have been created on the worker threads, which are done with them once
+        // ParallelFor returns. Their refcounts may be non-atomic so they are only referenced and
+        // released on this thread from now on.
+        for (Job& job : jobs) {
+            if (job.module != nullptr) {
+                job.module->SetOwningThreadToCurrent();
+            }
+        }
+
+        for (uint32_t i = 0; i < count; ++i) {
+            if (validationErrors[i] != nullptr) {
+                ConsumeError(std::move(validationErrors[i]));
+                results[i] = ShaderModuleBase::MakeError(this);
+                continue;
+            }
+
+            if (descriptorJobs[i] == kNoJob) {
+                ASSERT(results[i] != nullptr);
+                continue;
+            }
+
+            Job& job = jobs[descriptorJobs[i]];
+            if (job.module != nullptr) {
+                if (job.isCached) {
+                    job.module->Reference();
+                } else {
+                    job.module->SetIsCachedReference();
+                    mCaches->shaderModules.insert(job.module);
+                    job.isCached = true;
+                }
+                results[i] = job.module;
+            } else if (job.error != nullptr) {
+                ConsumeError(std::move(job.error));
+                results[i] = ShaderModuleBase::MakeError(this);
+            } else {
+                // The error of the job was already reported for a previous descriptor with the
+                // same code, create the module again to report its own error.
+                results[i] = CreateShaderModule(&descriptors[i]);
+            }
+        }
+    }
+
     void DeviceBase::Tick() {
         // We need to do the deferred callback even if Device is lost since Buffer Map Async will
         // send callback with device lost status when device is lost.
@@ -634,6 +927,9 @@ namespace dawn_native {
         if (ConsumedError(ValidateIsAlive())) {
             return;
         }
+        if (!mSubmitCoalescer->Flush()) {
+            return;
+        }
         if (ConsumedError(TickImpl())) {
             return;
         }
@@ -642,6 +938,146 @@ namespace dawn_native {
         mFenceSignalTracker->Tick(GetCompletedCommandSerial());
     }
 
+    ResultOrError<bool> DeviceBase::WaitForSerial(Serial serial, uint64_t timeoutNs) {
+        return WaitUntil([]() { return false; }, serial, timeoutNs);
+    }
+
+    ResultOrError<bool> DeviceBase::WaitForBufferMapping(uint64_t timeoutNs) {
+        // Only wait for the requests made before the call, requests made while waiting, for
+        // example in the callbacks, don't extend the wait. They complete at the latest when the
+        // commands pending at the time of the request complete.
+        Serial lastRequestSerial =
+            mPendingMapRequests.empty() ? 0 : mPendingMapRequests.rbegin()->first;
+        return WaitUntil(
+            [this, lastRequestSerial]() {
+                return mPendingMapRequests.empty() ||
+                       mPendingMapRequests.begin()->first > lastRequestSerial;
+            },
+            lastRequestSerial, timeoutNs);
+    }
+
+    ResultOrError<bool> DeviceBase::WaitUntil(const std::function<bool()>& isDone,
+                                              Serial serial,
+                                              uint64_t timeoutNs) {
+        using Clock = std::chrono::steady_clock;
+
+        // Timeouts too large to be represented are treated as infinite.
+        const bool infinite =
+            timeoutNs > static_cast<uint64_t>(std::numeric_limits<int64_t>::max() / 2);
+        const Clock::time_point deadline =
+            Clock::now() + std::chrono::nanoseconds(infinite ? 0 : timeoutNs);
+
+        DAWN_TRY(ValidateIsAlive());
+        mSubmitCoalescer->Flush();
+
+        while (true) {
+            // Ticking submits the pending commands, updates the completed serial and calls the
+            // callbacks that are ready.
+            Tick();
+            DAWN_TRY(ValidateIsAlive());
+            if (isDone() || GetCompletedCommandSerial() >= serial) {
+                return true;
+            }
+
+            uint64_t remainingNs = kWaitTimeoutInfinite;
+            if (!infinite) {
+                Clock::time_point now = Clock::now();
+                if (now >= deadline) {
+                    return false;
+                }
+                remainingNs = static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now).count());
+            }
+
+            // Work that wasn't submitted yet is submitted by the next Tick, so only wait for the
+            // GPU when the target serial is in flight.
+            Serial target = std::min(serial, GetLastSubmittedCommandSerial());
+            if (GetCompletedCommandSerial() >= target) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            bool completed = false;
+            DAWN_TRY_ASSIGN(completed, WaitForCompletionImpl(target, remainingNs));
+            if (!completed) {
+                return false;
+            }
+        }
+    }
+
+    void DeviceBase::StartBackgroundTicker() {
+        ASSERT(mBackgroundTicker == nullptr);
+        if (IsToggleEnabled(Toggle::TickOnBackgroundThread)) {
+            mBackgroundTicker = std::make_unique<BackgroundTicker>(this);
+        }
+    }
+
+    void DeviceBase::TickFromBackgroundThread() {
+        std::lock_guard<std::recursive_mutex> lock(mApiMutex);
+
+        // After an error the device is left alone until the application sees the error.
+        if (mLossStatus != LossStatus::Alive || mDeferredTickError != nullptr) {
+            return;
+        }
+
+        Serial completedSerial = GetCompletedCommandSerial();
+
+        mIsInBackgroundTick = true;
+        MaybeError result = TickImpl();
+        mIsInBackgroundTick = false;
+
+        if (result.IsError()) {
+            mDeferredTickError = result.AcquireError();
+        }
+        if (mDeferredTickError != nullptr || !mDeferredCallbacks.empty() ||
+            GetCompletedCommandSerial() != completedSerial) {
+            mHasPendingEvents = true;
+        }
+    }
+
+    void DeviceBase::ProcessEvents() {
+        mHasPendingEvents = false;
+
+        if (mDeferredTickError != nullptr) {
+            ConsumedError(std::move(mDeferredTickError));
+        }
+        ProcessDeferredCallbacks();
+
+        mErrorScopeTracker->Tick(GetCompletedCommandSerial());
+        mFenceSignalTracker->Tick(GetCompletedCommandSerial());
+    }
+
+    void DeviceBase::ProcessDeferredCallbacks() {
+        // Callbacks can make API calls that defer more callbacks, only call the ones that were
+        // deferred until now.
+        std::vector<std::function<void()>> callbacks = std::move(mDeferredCallbacks);
+        mDeferredCallbacks.clear();
+        for (const std::function<void()>& callback : callbacks) {
+            callback();
+        }
+    }
+
+    size_t DeviceBase::GetDeferredCallbackCountForTesting() const {
+        return mDeferredCallbacks.size();
+    }
+
+    void DeviceBase::WaitForBackgroundTicksForTesting(uint32_t count) {
+        ASSERT(mBackgroundTicker != nullptr);
+        mBackgroundTicker->WaitForTicksForTesting(count);
+    }
+
+    void DeviceBase::AddPendingMapRequest(Serial serial) {
+        mPendingMapRequests[serial]++;
+    }
+
+    void DeviceBase::RemovePendingMapRequest(Serial serial) {
+        auto it = mPendingMapRequests.find(serial);
+        ASSERT(it != mPendingMapRequests.end() && it->second > 0);
+        if (--it->second == 0) {
+            mPendingMapRequests.erase(it);
+        }
+    }
+
     void DeviceBase::Reference() {
         ASSERT(mRefCount != 0);
         mRefCount++;
@@ -700,6 +1136,15 @@ namespace dawn_native {
         return !IsToggleEnabled(Toggle::SkipValidation);
     }
 
+    RefCountMode DeviceBase::GetRefCountMode() const {
+        // The background tick thread references and releases objects too.
+        if (IsToggleEnabled(Toggle::UseNonAtomicRefCounts) &&
+            !IsToggleEnabled(Toggle::TickOnBackgroundThread)) {
+            return RefCountMode::NonAtomic;
+        }
+        return RefCountMode::Atomic;
+    }
+
     size_t DeviceBase::GetLazyClearCountForTesting() {
         return mLazyClearCountForTesting;
     }
@@ -708,6 +1153,26 @@ namespace dawn_native {
         ++mLazyClearCountForTesting;
     }
 
+    size_t DeviceBase::GetLazyClearBatchCountForTesting() {
+        return mLazyClearBatchCountForTesting;
+    }
+
+    void DeviceBase::IncrementLazyClearBatchCountForTesting() {
+        ++mLazyClearBatchCountForTesting;
+    }
+
+    size_t DeviceBase::GetSpirvValidationCountForTesting() const {
+        return mSpirvValidationCountForTesting;
+    }
+
+    size_t DeviceBase::GetElidedCommandCount() const {
+        return mElidedCommandCount;
+    }
+
+    void DeviceBase::IncrementElidedCommandCount() {
+        ++mElidedCommandCount;
+    }
+
     void DeviceBase::SetDefaultToggles() {
         // Sets the default-enabled toggles
         mTogglesSet.SetToggle(Toggle::LazyClearResourceOnFirstUse, true);
@@ -912,8 +1377,25 @@ namespace dawn_native {
         return mDynamicUploader.get();
     }
 
+    PersistentCache* DeviceBase::GetPersistentCache() {
+        return mPersistentCache.get();
+    }
+
+    ShaderCompileTracker* DeviceBase::GetShaderCompileTracker() {
+        return mShaderCompileTracker.get();
+    }
+
     void DeviceBase::SetToggle(Toggle toggle, bool isEnabled) {
         mTogglesSet.SetToggle(toggle, isEnabled);
     }
 
+    // ApiScope
+
+    void ApiScope::Enter(DeviceBase* device) {
+        mLock = std::unique_lock<std::recursive_mutex>(*device->GetApiMutex());
+        if (device->HasPendingEvents()) {
+            device->ProcessEvents();
+        }
+    }
+
 }  // namespace dawn_native
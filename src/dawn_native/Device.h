@@ -21,23 +21,34 @@
 #include "dawn_native/Format.h"
 #include "dawn_native/Forward.h"
 #include "dawn_native/ObjectBase.h"
+#include "dawn_native/ObjectPool.h"
 #include "dawn_native/Toggles.h"
 
 #include "dawn_native/DawnNative.h"
 #include "dawn_native/dawn_platform.h"
 
+#include <atomic>
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 
 namespace dawn_native {
     class AdapterBase;
     class AttachmentState;
     class AttachmentStateBlueprint;
+    class BackgroundTicker;
     class BindGroupLayoutBase;
     class DynamicUploader;
     class ErrorScope;
     class ErrorScopeTracker;
     class FenceSignalTracker;
+    class PersistentCache;
+    class ShaderCompileTracker;
+    class ShaderModuleContent;
+    class SubmitCoalescer;
     class StagingBufferBase;
+    class WorkerPool;
 
     class DeviceBase {
       public:
@@ -45,6 +56,9 @@ namespace dawn_native {
         virtual ~DeviceBase();
 
         void HandleError(InternalErrorType type, const char* message);
+        // Same as ConsumedError but the error is reported to |scope| instead of the current error
+        // scope, for errors of deferred work like coalesced submits.
+        void ConsumeErrorInScope(std::unique_ptr<ErrorData> error, ErrorScope* scope);
 
         bool ConsumedError(MaybeError maybeError) {
             if (DAWN_UNLIKELY(maybeError.IsError())) {
@@ -71,6 +85,15 @@ namespace dawn_native {
 
         ErrorScopeTracker* GetErrorScopeTracker() const;
         FenceSignalTracker* GetFenceSignalTracker() const;
+        SubmitCoalescer* GetSubmitCoalescer() const;
+
+        // The pools of the frontend objects that are created and released many times per frame.
+        // Backends own the pools of their command buffers and texture views, and the bind groups
+        // are allocated from their layout.
+        ObjectPoolCounters* GetObjectPoolCounters();
+        ObjectPool<CommandEncoder>* GetCommandEncoderPool();
+        ObjectPool<ComputePassEncoder>* GetComputePassEncoderPool();
+        ObjectPool<RenderPassEncoder>* GetRenderPassEncoderPool();
 
         // Returns the Format corresponding to the wgpu::TextureFormat or an error if the format
         // isn't a valid wgpu::TextureFormat or isn't supported by this device.
@@ -91,6 +114,56 @@ namespace dawn_native {
         virtual Serial GetPendingCommandSerial() const = 0;
         virtual MaybeError TickImpl() = 0;
 
+        // Blocks until |serial| completes or until |timeoutNs| passes, ticking the device so that
+        // the callbacks that become ready are called. Returns whether the serial completed.
+        // A timeout of kWaitTimeoutInfinite never expires.
+        ResultOrError<bool> WaitForSerial(Serial serial, uint64_t timeoutNs);
+
+        // Same as WaitForSerial but returns as soon as the callbacks of all the buffer map
+        // requests made before the call were called.
+        ResultOrError<bool> WaitForBufferMapping(uint64_t timeoutNs);
+
+        // Tracks the map requests whose callback wasn't called yet, by the command serial at which
+        // they complete at the latest.
+        void AddPendingMapRequest(Serial serial);
+        void RemovePendingMapRequest(Serial serial);
+
+        // Starts the background tick thread if the TickOnBackgroundThread toggle is enabled. Called
+        // once the backend device is fully initialized.
+        void StartBackgroundTicker();
+        bool HasBackgroundTicker() const {
+            return mBackgroundTicker != nullptr;
+        }
+        std::recursive_mutex* GetApiMutex() {
+            return &mApiMutex;
+        }
+
+        // Called periodically by the background tick thread. It polls the completed serial and
+        // reclaims the resources of completed work with TickImpl but never calls user callbacks:
+        // they are deferred until ProcessEvents, along with the fence and error scope callbacks
+        // and the errors produced during the tick.
+        void TickFromBackgroundThread();
+
+        // Delivers the events that became ready on the background tick thread. Called at the
+        // start of API calls when events are pending, and by dawn_native::ProcessEvents.
+        void ProcessEvents();
+        bool HasPendingEvents() const {
+            return mHasPendingEvents;
+        }
+
+        // Calls |callback| now, or defers it until ProcessEvents when called from the background
+        // tick thread so that user callbacks are only called on the application's threads.
+        template <typename F>
+        void CallOrDeferCallback(F&& callback) {
+            if (DAWN_UNLIKELY(mIsInBackgroundTick)) {
+                mDeferredCallbacks.emplace_back(std::forward<F>(callback));
+            } else {
+                callback();
+            }
+        }
+        size_t GetDeferredCallbackCountForTesting() const;
+        void WaitForBackgroundTicksForTesting(uint32_t count);
+
         // Many Dawn objects are completely immutable once created which means that if two
         // creations are given the same arguments, they can return the same object. Reusing
         // objects will help make comparisons between objects by a single pointer comparison.
@@ -157,6 +230,12 @@ namespace dawn_native {
         TextureViewBase* CreateTextureView(TextureBase* texture,
                                            const TextureViewDescriptor* descriptor);
 
+        // Same as calling CreateShaderModule for each descriptor, but the SPIR-V validation,
+        // reflection and translation of modules that aren't cached run in parallel.
+        void CreateShaderModules(uint32_t count,
+                                 const ShaderModuleDescriptor* descriptors,
+                                 ShaderModuleBase** results);
+
         void InjectError(wgpu::ErrorType type, const char* message);
 
         void Tick();
@@ -182,14 +261,22 @@ namespace dawn_native {
                                                    uint64_t size) = 0;
 
         DynamicUploader* GetDynamicUploader() const;
+        PersistentCache* GetPersistentCache();
+        ShaderCompileTracker* GetShaderCompileTracker();
 
         std::vector<const char*> GetEnabledExtensions() const;
         std::vector<const char*> GetTogglesUsed() const;
         bool IsExtensionEnabled(Extension extension) const;
         bool IsToggleEnabled(Toggle toggle) const;
         bool IsValidationEnabled() const;
+        RefCountMode GetRefCountMode() const;
         size_t GetLazyClearCountForTesting();
         void IncrementLazyClearCountForTesting();
+        size_t GetLazyClearBatchCountForTesting();
+        void IncrementLazyClearBatchCountForTesting();
+        size_t GetSpirvValidationCountForTesting() const;
+        size_t GetElidedCommandCount() const;
+        void IncrementElidedCommandCount();
         void LoseForTesting();
         bool IsLost() const;
 
@@ -237,6 +324,11 @@ namespace dawn_native {
             TextureBase* texture,
             const TextureViewDescriptor* descriptor) = 0;
 
+        // Whether CreateShaderModuleImpl may run on several threads at once, without the API
+        // mutex. Backends opt in once their implementation is audited for thread-safety, the
+        // batches of modules are created serially on the others.
+        virtual bool IsShaderModuleCreationThreadSafe() const;
+
         MaybeError CreateBindGroupInternal(BindGroupBase** result,
                                            const BindGroupDescriptor* descriptor);
         MaybeError CreateBindGroupLayoutInternal(BindGroupLayoutBase** result,
@@ -255,6 +347,12 @@ namespace dawn_native {
         MaybeError CreateSamplerInternal(SamplerBase** result, const SamplerDescriptor* descriptor);
         MaybeError CreateShaderModuleInternal(ShaderModuleBase** result,
                                               const ShaderModuleDescriptor* descriptor);
+        // Only touches state private to the module so it can run on worker threads.
+        ResultOrError<ShaderModuleBase*> CreateUncachedShaderModule(
+            const ShaderModuleDescriptor* descriptor,
+            const ShaderModuleContent* content,
+            bool validateSpirv);
+        bool ShaderCodeNeedsValidation(const ShaderModuleContent* content) const;
         MaybeError CreateSwapChainInternal(SwapChainBase** result,
                                            Surface* surface,
                                            const SwapChainDescriptor* descriptor);
@@ -268,6 +366,7 @@ namespace dawn_native {
         void SetDefaultToggles();
 
         void ConsumeError(std::unique_ptr<ErrorData> error);
+        void HandleErrorInScope(InternalErrorType type, const char* message, ErrorScope* scope);
 
         // Destroy is used to clean up and release resources used by device, does not wait for GPU
         // or check errors.
@@ -279,6 +378,18 @@ namespace dawn_native {
         // resources.
         virtual MaybeError WaitForIdleForDestruction() = 0;
 
+        // Blocks until the GPU completes more of the work up to |serial|, which was submitted, or
+        // until |timeoutNs| passes. Returns false if the timeout expired. Backends may return
+        // once an earlier serial completes, the caller waits again until |serial| completes.
+        virtual ResultOrError<bool> WaitForCompletionImpl(Serial serial, uint64_t timeoutNs) = 0;
+
+        // Waits until |serial| completes or |isDone| returns true.
+        ResultOrError<bool> WaitUntil(const std::function<bool()>& isDone,
+                                      Serial serial,
+                                      uint64_t timeoutNs);
+
+        void ProcessDeferredCallbacks();
+
         void HandleLoss(const char* message);
         wgpu::DeviceLostCallback mDeviceLostCallback = nullptr;
         void* mDeviceLostUserdata;
@@ -293,6 +404,12 @@ namespace dawn_native {
         struct Caches;
         std::unique_ptr<Caches> mCaches;
 
+        // Like the caches, the frontend object pools are defined in Device.cpp that has all the
+        // object types.
+        ObjectPoolCounters mObjectPoolCounters;
+        struct ObjectPools;
+        std::unique_ptr<ObjectPools> mObjectPools;
+
         struct DeferredCreateBufferMappedAsync {
             wgpu::BufferCreateMappedCallback callback;
             WGPUBufferMapAsyncStatus status;
@@ -302,18 +419,56 @@ namespace dawn_native {
 
         std::unique_ptr<ErrorScopeTracker> mErrorScopeTracker;
         std::unique_ptr<FenceSignalTracker> mFenceSignalTracker;
+        std::unique_ptr<SubmitCoalescer> mSubmitCoalescer;
+        std::unique_ptr<PersistentCache> mPersistentCache;
+        std::unique_ptr<ShaderCompileTracker> mShaderCompileTracker;
+        // Created with the first batch of shader modules that is created in parallel.
+        std::unique_ptr<WorkerPool> mWorkerPool;
         std::vector<DeferredCreateBufferMappedAsync> mDeferredCreateBufferMappedAsyncResults;
 
+        // Only used when the TickOnBackgroundThread toggle is enabled. All the API calls on the
+        // device and the background ticks are serialized with mApiMutex, which is recursive
+        // because callbacks can make API calls.
+        std::recursive_mutex mApiMutex;
+        std::unique_ptr<BackgroundTicker> mBackgroundTicker;
+        bool mIsInBackgroundTick = false;
+        bool mHasPendingEvents = false;
+        std::vector<std::function<void()>> mDeferredCallbacks;
+        std::unique_ptr<ErrorData> mDeferredTickError;
+
         uint32_t mRefCount = 1;
 
         FormatTable mFormatTable;
 
         TogglesSet mTogglesSet;
         size_t mLazyClearCountForTesting = 0;
+        size_t mLazyClearBatchCountForTesting = 0;
+        // Atomic because batches of shader modules are validated on several threads.
+        std::atomic<size_t> mSpirvValidationCountForTesting{0};
+        size_t mElidedCommandCount = 0;
+        // The number of pending map requests for each serial.
+        std::map<Serial, uint32_t> mPendingMapRequests;
 
         ExtensionsSet mEnabledExtensions;
     };
 
+    // Serializes an API call on a device with its background tick thread, if it has one, and
+    // delivers the events that became ready in the background before the call runs. Devices
+    // without a background tick thread don't lock anything.
+    class ApiScope {
+      public:
+        explicit ApiScope(DeviceBase* device) {
+            if (DAWN_UNLIKELY(device->HasBackgroundTicker())) {
+                Enter(device);
+            }
+        }
+
+      private:
+        void Enter(DeviceBase* device);
+
+        std::unique_lock<std::recursive_mutex> mLock;
+    };
+
 }  // namespace dawn_native
 
 #endif  // DAWNNATIVE_DEVICE_H_
@@ -108,4 +108,16 @@ namespace dawn_native {
         }
         mReleasedStagingBuffers.ClearUpTo(lastCompletedSerial);
     }
+
+    uint64_t DynamicUploader::GetUsedSize() const {
+        uint64_t usedSize = 0;
+        for (const std::unique_ptr<RingBuffer>& ringBuffer : mRingBuffers) {
+            usedSize += ringBuffer->mAllocator.GetUsedSize();
+        }
+        for (const std::unique_ptr<StagingBufferBase>& stagingBuffer :
+             mReleasedStagingBuffers.IterateAll()) {
+            usedSize += stagingBuffer->GetSize();
+        }
+        return usedSize;
+    }
 }  // namespace dawn_native
\ No newline at end of file
@@ -43,6 +43,9 @@ namespace dawn_native {
         ResultOrError<UploadHandle> Allocate(uint64_t allocationSize, Serial serial);
         void Deallocate(Serial lastCompletedSerial);
 
+        // Returns the size of the staging memory that isn't reclaimed yet.
+        uint64_t GetUsedSize() const;
+
       private:
         static constexpr uint64_t kRingBufferSize = 4 * 1024 * 1024;
 
@@ -69,15 +69,26 @@ namespace dawn_native {
     //
     //   - Unimplemented: same as Internal except it puts "unimplemented" in the error message for
     //     more clarity.
-
-#define DAWN_MAKE_ERROR(TYPE, MESSAGE) \
-    ::dawn_native::ErrorData::Create(TYPE, MESSAGE, __FILE__, __func__, __LINE__)
-#define DAWN_VALIDATION_ERROR(MESSAGE) DAWN_MAKE_ERROR(InternalErrorType::Validation, MESSAGE)
-#define DAWN_DEVICE_LOST_ERROR(MESSAGE) DAWN_MAKE_ERROR(InternalErrorType::DeviceLost, MESSAGE)
-#define DAWN_INTERNAL_ERROR(MESSAGE) DAWN_MAKE_ERROR(InternalErrorType::Internal, MESSAGE)
+    //
+    // Messages must be string literals: the errors reference them instead of copying them, and
+    // they are only formatted if the error is observed, for example by an error callback. The
+    // macros paste "" before the message so that anything else fails to compile. Integer
+    // arguments can be added after the literal and replace the "{}" in it:
+    //   return DAWN_VALIDATION_ERROR("Binding {} is out of range", binding);
+    //
+    // Messages built at runtime are copied in the error instead:
+    //   return DAWN_MAKE_ERROR_FROM_STRING(InternalErrorType::Internal, message);
+
+#define DAWN_MAKE_ERROR(TYPE, ...) \
+    ::dawn_native::ErrorData::Create(TYPE, __FILE__, __func__, __LINE__, "" __VA_ARGS__)
+#define DAWN_MAKE_ERROR_FROM_STRING(TYPE, MESSAGE) \
+    ::dawn_native::ErrorData::Create(TYPE, __FILE__, __func__, __LINE__, std::string(MESSAGE))
+#define DAWN_VALIDATION_ERROR(...) DAWN_MAKE_ERROR(InternalErrorType::Validation, __VA_ARGS__)
+#define DAWN_DEVICE_LOST_ERROR(...) DAWN_MAKE_ERROR(InternalErrorType::DeviceLost, __VA_ARGS__)
+#define DAWN_INTERNAL_ERROR(...) DAWN_MAKE_ERROR(InternalErrorType::Internal, __VA_ARGS__)
 #define DAWN_UNIMPLEMENTED_ERROR(MESSAGE) \
-    DAWN_MAKE_ERROR(InternalErrorType::Internal, std::string("Unimplemented: ") + MESSAGE)
-#define DAWN_OUT_OF_MEMORY_ERROR(MESSAGE) DAWN_MAKE_ERROR(InternalErrorType::OutOfMemory, MESSAGE)
+    DAWN_MAKE_ERROR(InternalErrorType::Internal, "Unimplemented: " MESSAGE)
+#define DAWN_OUT_OF_MEMORY_ERROR(...) DAWN_MAKE_ERROR(InternalErrorType::OutOfMemory, __VA_ARGS__)
 
 #define DAWN_CONCAT1(x, y) x##y
 #define DAWN_CONCAT2(x, y) DAWN_CONCAT1(x, y)
@@ -14,32 +14,89 @@
 
 #include "dawn_native/ErrorData.h"
 
+#include "common/Assert.h"
 #include "dawn_native/Error.h"
 #include "dawn_native/dawn_platform.h"
 
 namespace dawn_native {
 
+    namespace {
+
+        // Errors are usually consumed right after being created so a few cached ErrorData are
+        // enough to avoid allocations for streams of errors. The cache is per-thread so it
+        // doesn't need to be synchronized.
+        constexpr size_t kMaxCachedErrors = 4;
+
+        struct ErrorDataCache {
+            ~ErrorDataCache();
+
+            std::array<void*, kMaxCachedErrors> entries;
+            size_t count = 0;
+        };
+
+        thread_local ErrorDataCache tErrorDataCache;
+        // ErrorData can be deleted after the cache is destroyed at thread exit, for example when
+        // destroying thread_local objects holding errors.
+        thread_local bool tErrorDataCacheDestroyed = false;
+
+        ErrorDataCache::~ErrorDataCache() {
+            for (size_t i = 0; i < count; ++i) {
+                ::operator delete(entries[i]);
+            }
+            count = 0;
+            tErrorDataCacheDestroyed = true;
+        }
+
+    }  // anonymous namespace
+
+    constexpr size_t ErrorData::kMaxArgumentCount;
+    constexpr size_t ErrorData::kMaxBacktraceSize;
+
     std::unique_ptr<ErrorData> ErrorData::Create(InternalErrorType type,
-                                                 std::string message,
                                                  const char* file,
                                                  const char* function,
-                                                 int line) {
-        std::unique_ptr<ErrorData> error = std::make_unique<ErrorData>(type, message);
+                                                 int line,
+                                                 std::string message) {
+        std::unique_ptr<ErrorData> error = std::make_unique<ErrorData>(type, std::move(message));
         error->AppendBacktrace(file, function, line);
         return error;
     }
 
+    ErrorData::ErrorData(InternalErrorType type, const char* staticMessage)
+        : mType(type), mStaticMessage(staticMessage) {
+    }
+
     ErrorData::ErrorData(InternalErrorType type, std::string message)
         : mType(type), mMessage(std::move(message)) {
     }
 
+    // static
+    void* ErrorData::operator new(size_t size) {
+        ASSERT(size == sizeof(ErrorData));
+        if (!tErrorDataCacheDestroyed && tErrorDataCache.count > 0) {
+            return tErrorDataCache.entries[--tErrorDataCache.count];
+        }
+        return ::operator new(size);
+    }
+
+    // static
+    void ErrorData::operator delete(void* pointer) {
+        if (!tErrorDataCacheDestroyed && tErrorDataCache.count < kMaxCachedErrors) {
+            tErrorDataCache.entries[tErrorDataCache.count++] = pointer;
+            return;
+        }
+        ::operator delete(pointer);
+    }
+
     void ErrorData::AppendBacktrace(const char* file, const char* function, int line) {
-        BacktraceRecord record;
+        if (mBacktraceSize == kMaxBacktraceSize) {
+            return;
+        }
+
+        BacktraceRecord& record = mBacktrace[mBacktraceSize++];
         record.file = file;
         record.function = function;
         record.line = line;
-
-        mBacktrace.push_back(std::move(record));
     }
 
     InternalErrorType ErrorData::GetType() const {
@@ -47,11 +104,28 @@ namespace dawn_native {
     }
 
     const std::string& ErrorData::GetMessage() const {
+        if (mStaticMessage == nullptr) {
+            return mMessage;
+        }
+
+        // Format the message the first time it is needed, replacing each "{}" by an argument.
+        size_t argumentIndex = 0;
+        for (const char* c = mStaticMessage; *c != '\0'; ++c) {
+            if (c[0] == '{' && c[1] == '}' && argumentIndex < mArgumentCount) {
+                mMessage += std::to_string(mArguments[argumentIndex++]);
+                ++c;
+            } else {
+                mMessage += *c;
+            }
+        }
+        ASSERT(argumentIndex == mArgumentCount);
+
+        mStaticMessage = nullptr;
         return mMessage;
     }
 
-    const std::vector<ErrorData::BacktraceRecord>& ErrorData::GetBacktrace() const {
-        return mBacktrace;
+    std::vector<ErrorData::BacktraceRecord> ErrorData::GetBacktrace() const {
+        return {mBacktrace.begin(), mBacktrace.begin() + mBacktraceSize};
     }
 
 }  // namespace dawn_native
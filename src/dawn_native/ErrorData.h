@@ -17,6 +17,8 @@
 
 #include "common/Compiler.h"
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -33,15 +35,49 @@ namespace dawn {
 namespace dawn_native {
     enum class InternalErrorType : uint32_t;
 
+    // Errors are produced at a high rate by applications that probe for support by making invalid
+    // calls inside error scopes, so creating, propagating and dropping them doesn't allocate:
+    //  - The message of an error created from a string literal isn't copied. Up to
+    //    kMaxArgumentCount integer arguments can be given with the literal, they replace the "{}"
+    //    in the message when it is formatted, the first time GetMessage() is called.
+    //  - The backtrace is recorded in a fixed size array, the outermost records are dropped.
+    //  - ErrorData objects are recycled through a small per-thread cache.
     class DAWN_NO_DISCARD ErrorData {
       public:
+        static constexpr size_t kMaxArgumentCount = 4;
+        static constexpr size_t kMaxBacktraceSize = 16;
+
+        // |message| must be a string literal, it is referenced and formatted lazily. Any char
+        // array binds to this overload so it must only be called by DAWN_MAKE_ERROR, which makes
+        // sure that the message is a literal.
+        template <size_t N, typename... Arguments>
+        static DAWN_NO_DISCARD std::unique_ptr<ErrorData> Create(InternalErrorType type,
+                                                                 const char* file,
+                                                                 const char* function,
+                                                                 int line,
+                                                                 const char (&message)[N],
+                                                                 Arguments... arguments) {
+            static_assert(sizeof...(Arguments) <= kMaxArgumentCount, "Too many error arguments");
+            std::unique_ptr<ErrorData> error = std::make_unique<ErrorData>(type, message);
+            error->mArgumentCount = sizeof...(Arguments);
+            error->mArguments = {{static_cast<uint64_t>(arguments)...}};
+            error->AppendBacktrace(file, function, line);
+            return error;
+        }
+
+        // Messages built at runtime are copied, see DAWN_MAKE_ERROR_FROM_STRING.
         static DAWN_NO_DISCARD std::unique_ptr<ErrorData> Create(InternalErrorType type,
-                                                                 std::string message,
                                                                  const char* file,
                                                                  const char* function,
-                                                                 int line);
+                                                                 int line,
+                                                                 std::string message);
+
+        ErrorData(InternalErrorType type, const char* staticMessage);
         ErrorData(InternalErrorType type, std::string message);
 
+        static void* operator new(size_t size);
+        static void operator delete(void* pointer);
+
         struct BacktraceRecord {
             const char* file;
             const char* function;
@@ -51,12 +87,20 @@ namespace dawn_native {
 
         InternalErrorType GetType() const;
         const std::string& GetMessage() const;
-        const std::vector<BacktraceRecord>& GetBacktrace() const;
+        std::vector<BacktraceRecord> GetBacktrace() const;
 
       private:
         InternalErrorType mType;
-        std::string mMessage;
-        std::vector<BacktraceRecord> mBacktrace;
+
+        // Either the message is static, and formatted into mMessage when first needed, or it was
+        // copied into mMessage at creation.
+        mutable const char* mStaticMessage = nullptr;
+        std::array<uint64_t, kMaxArgumentCount> mArguments;
+        size_t mArgumentCount = 0;
+        mutable std::string mMessage;
+
+        std::array<BacktraceRecord, kMaxBacktraceSize> mBacktrace;
+        size_t mBacktraceSize = 0;
     };
 
 }  // namespace dawn_native
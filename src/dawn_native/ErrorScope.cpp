@@ -15,6 +15,7 @@
 #include "dawn_native/ErrorScope.h"
 
 #include "common/Assert.h"
+#include "dawn_native/Error.h"
 
 namespace dawn_native {
 
@@ -29,7 +30,9 @@ namespace dawn_native {
         if (mCallback == nullptr || IsRoot()) {
             return;
         }
-        mCallback(static_cast<WGPUErrorType>(mErrorType), mErrorMessage.c_str(), mUserdata);
+        const char* message =
+            mError != nullptr ? mError->GetMessage().c_str() : mErrorMessage.c_str();
+        mCallback(static_cast<WGPUErrorType>(mErrorType), message, mUserdata);
     }
 
     void ErrorScope::SetCallback(wgpu::ErrorCallback callback, void* userdata) {
@@ -46,11 +49,20 @@ namespace dawn_native {
     }
 
     void ErrorScope::HandleError(wgpu::ErrorType type, const char* message) {
-        HandleErrorImpl(this, type, message);
+        HandleErrorImpl(this, type, message, nullptr);
+    }
+
+    void ErrorScope::HandleError(std::unique_ptr<ErrorData> error) {
+        wgpu::ErrorType type = ToWGPUErrorType(error->GetType());
+        ASSERT(type == wgpu::ErrorType::Validation || type == wgpu::ErrorType::OutOfMemory);
+        HandleErrorImpl(this, type, nullptr, std::move(error));
     }
 
     // static
-    void ErrorScope::HandleErrorImpl(ErrorScope* scope, wgpu::ErrorType type, const char* message) {
+    void ErrorScope::HandleErrorImpl(ErrorScope* scope,
+                                     wgpu::ErrorType type,
+                                     const char* message,
+                                     std::unique_ptr<ErrorData> error) {
         ErrorScope* currentScope = scope;
         for (; !currentScope->IsRoot(); currentScope = currentScope->GetParent()) {
             ASSERT(currentScope != nullptr);
@@ -86,10 +98,17 @@ namespace dawn_native {
                     return;
             }
 
-            // Record the error if the scope doesn't have one yet.
+            // Record the error if the scope doesn't have one yet. Errors that aren't the first of
+            // their scope are dropped without being formatted.
             if (currentScope->mErrorType == wgpu::ErrorType::NoError) {
                 currentScope->mErrorType = type;
-                currentScope->mErrorMessage = message;
+                if (error != nullptr) {
+                    // Only errors consumed by a single scope are passed as ErrorData.
+                    ASSERT(consumed);
+                    currentScope->mError = std::move(error);
+                } else {
+                    currentScope->mErrorMessage = message;
+                }
             }
 
             if (consumed) {
@@ -100,6 +119,9 @@ namespace dawn_native {
         // The root error scope captures all uncaptured errors.
         ASSERT(currentScope->IsRoot());
         if (currentScope->mCallback) {
+            if (error != nullptr) {
+                message = error->GetMessage().c_str();
+            }
             currentScope->mCallback(static_cast<WGPUErrorType>(type), message,
                                     currentScope->mUserdata);
         }
@@ -109,6 +131,7 @@ namespace dawn_native {
         if (!IsRoot()) {
             mErrorType = wgpu::ErrorType::Unknown;
             mErrorMessage = "Error scope destroyed";
+            mError = nullptr;
         }
     }
 
@@ -17,8 +17,10 @@
 
 #include "dawn_native/dawn_platform.h"
 
+#include "dawn_native/ErrorData.h"
 #include "dawn_native/RefCounted.h"
 
+#include <memory>
 #include <string>
 
 namespace dawn_native {
@@ -46,11 +48,19 @@ namespace dawn_native {
 
         void HandleError(wgpu::ErrorType type, const char* message);
 
+        // Same as HandleError for validation and out of memory errors, which are only captured by
+        // a single scope, but the message of |error| is only formatted if a callback observes it.
+        void HandleError(std::unique_ptr<ErrorData> error);
+
         void Destroy();
 
       private:
         bool IsRoot() const;
-        static void HandleErrorImpl(ErrorScope* scope, wgpu::ErrorType type, const char* message);
+        // Records either |message| or |error|, whose message is only formatted if needed.
+        static void HandleErrorImpl(ErrorScope* scope,
+                                    wgpu::ErrorType type,
+                                    const char* message,
+                                    std::unique_ptr<ErrorData> error);
 
         wgpu::ErrorFilter mErrorFilter = wgpu::ErrorFilter::None;
         Ref<ErrorScope> mParent = nullptr;
@@ -59,7 +69,9 @@ namespace dawn_native {
         void* mUserdata = nullptr;
 
         wgpu::ErrorType mErrorType = wgpu::ErrorType::NoError;
+        // The message of the recorded error, either as a string or in the error itself.
         std::string mErrorMessage = "";
+        std::unique_ptr<ErrorData> mError;
     };
 
 }  // namespace dawn_native
@@ -16,6 +16,7 @@
 
 #include "common/Assert.h"
 #include "dawn_native/Device.h"
+#include "dawn_native/FenceSignalTracker.h"
 #include "dawn_native/Queue.h"
 #include "dawn_native/ValidationUtils_autogen.h"
 
@@ -84,6 +85,26 @@ namespace dawn_native {
         mRequests.Enqueue(std::move(request), value);
     }
 
+    bool Fence::Wait(uint64_t value, uint64_t timeoutNs) {
+        DeviceBase* device = GetDevice();
+        if (device->ConsumedError(ValidateWait(value))) {
+            return false;
+        }
+        ASSERT(!IsError());
+
+        if (value <= mCompletedValue) {
+            return true;
+        }
+
+        Serial serial = device->GetFenceSignalTracker()->GetSerialForValue(this, value);
+        bool completed = false;
+        if (device->ConsumedError(device->WaitForSerial(serial, timeoutNs), &completed)) {
+            return false;
+        }
+        ASSERT(!completed || value <= mCompletedValue);
+        return completed;
+    }
+
     uint64_t Fence::GetSignaledValue() const {
         ASSERT(!IsError());
         return mSignalValue;
@@ -132,4 +153,15 @@ namespace dawn_native {
         return {};
     }
 
+    MaybeError Fence::ValidateWait(uint64_t value) const {
+        DAWN_TRY(GetDevice()->ValidateIsAlive());
+        DAWN_TRY(GetDevice()->ValidateObject(this));
+
+        // Waiting for a value that wasn't signaled yet would never complete.
+        if (value > mSignalValue) {
+            return DAWN_VALIDATION_ERROR("Value greater than fence signaled value");
+        }
+        return {};
+    }
+
 }  // namespace dawn_native
@@ -42,6 +42,10 @@ namespace dawn_native {
         uint64_t GetCompletedValue() const;
         void OnCompletion(uint64_t value, wgpu::FenceOnCompletionCallback callback, void* userdata);
 
+        // Blocks until the completed value reaches |value| or until |timeoutNs| passes. Returns
+        // whether the value was reached.
+        bool Wait(uint64_t value, uint64_t timeoutNs);
+
       protected:
         friend class QueueBase;
         friend class FenceSignalTracker;
@@ -52,6 +56,7 @@ namespace dawn_native {
         Fence(DeviceBase* device, ObjectBase::ErrorTag tag);
 
         MaybeError ValidateOnCompletion(uint64_t value, WGPUFenceCompletionStatus* status) const;
+        MaybeError ValidateWait(uint64_t value) const;
 
         struct OnCompletionData {
             wgpu::FenceOnCompletionCallback completionCallback = nullptr;
@@ -29,8 +29,20 @@ namespace dawn_native {
     void FenceSignalTracker::UpdateFenceOnComplete(Fence* fence, uint64_t value) {
         // Because we currently only have a single queue, we can simply update
         // the fence completed value once the last submitted serial has passed.
-        mFencesInFlight.Enqueue(FenceInFlight{fence, value},
-                                mDevice->GetLastSubmittedCommandSerial());
+        Serial serial = mDevice->GetLastSubmittedCommandSerial();
+        mFencesInFlight.Enqueue(FenceInFlight{fence, value, serial}, serial);
+    }
+
+    Serial FenceSignalTracker::GetSerialForValue(const Fence* fence, uint64_t value) const {
+        // Signals are tracked in submission order so the first one reaching |value| is the one
+        // to wait for.
+        for (const FenceInFlight& fenceInFlight : mFencesInFlight.IterateAll()) {
+            if (fenceInFlight.fence.Get() == fence && fenceInFlight.value >= value) {
+                return fenceInFlight.serial;
+            }
+        }
+        UNREACHABLE();
+        return 0;
     }
 
     void FenceSignalTracker::Tick(Serial finishedSerial) {
@@ -27,6 +27,7 @@ namespace dawn_native {
         struct FenceInFlight {
             Ref<Fence> fence;
             uint64_t value;
+            Serial serial;
         };
 
       public:
@@ -35,6 +36,10 @@ namespace dawn_native {
 
         void UpdateFenceOnComplete(Fence* fence, uint64_t value);
 
+        // Returns the serial after which the completed value of |fence| reaches |value|. The
+        // value must be signaled and not completed yet.
+        Serial GetSerialForValue(const Fence* fence, uint64_t value) const;
+
         void Tick(Serial finishedSerial);
 
       private:
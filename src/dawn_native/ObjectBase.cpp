@@ -14,16 +14,27 @@
 
 #include "dawn_native/ObjectBase.h"
 
+#include "dawn_native/Device.h"
+
 namespace dawn_native {
 
     static constexpr uint64_t kErrorPayload = 0;
     static constexpr uint64_t kNotErrorPayload = 1;
 
-    ObjectBase::ObjectBase(DeviceBase* device) : RefCounted(kNotErrorPayload), mDevice(device) {
+    namespace {
+
+        RefCountMode GetDeviceRefCountMode(DeviceBase* device) {
+            return device != nullptr ? device->GetRefCountMode() : RefCountMode::Atomic;
+        }
+
+    }  // anonymous namespace
+
+    ObjectBase::ObjectBase(DeviceBase* device)
+        : RefCounted(kNotErrorPayload, GetDeviceRefCountMode(device)), mDevice(device) {
     }
 
     ObjectBase::ObjectBase(DeviceBase* device, ErrorTag)
-        : RefCounted(kErrorPayload), mDevice(device) {
+        : RefCounted(kErrorPayload, GetDeviceRefCountMode(device)), mDevice(device) {
     }
 
     ObjectBase::~ObjectBase() {
@@ -0,0 +1,116 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_OBJECTPOOL_H_
+#define DAWNNATIVE_OBJECTPOOL_H_
+
+#include "common/ConcurrentSlabAllocator.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace dawn_native {
+
+    // The types of objects that applications typically create and release many times per frame
+    // and that are allocated from pools instead of the heap.
+    enum class PooledObjectType {
+        BindGroup,
+        CommandBuffer,
+        CommandEncoder,
+        ComputePassEncoder,
+        RenderPassEncoder,
+        TextureView,
+
+        EnumCount,
+    };
+
+    // Counts the allocations made from the pools of a device, for each type of pooled object.
+    class ObjectPoolCounters {
+      public:
+        void AddAllocation(PooledObjectType type) {
+            GetCounter(type).allocations.fetch_add(1, std::memory_order_relaxed);
+        }
+        void AddDeallocation(PooledObjectType type) {
+            GetCounter(type).deallocations.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // The total number of objects allocated since the creation of the device.
+        uint64_t GetAllocationCount(PooledObjectType type) const {
+            return GetCounter(type).allocations.load(std::memory_order_relaxed);
+        }
+        // The number of objects currently allocated.
+        uint64_t GetLiveCount(PooledObjectType type) const {
+            const Counter& counter = GetCounter(type);
+            return counter.allocations.load(std::memory_order_relaxed) -
+                   counter.deallocations.load(std::memory_order_relaxed);
+        }
+
+      private:
+        struct Counter {
+            std::atomic<uint64_t> allocations{0};
+            std::atomic<uint64_t> deallocations{0};
+        };
+
+        Counter& GetCounter(PooledObjectType type) {
+            return mCounters[static_cast<size_t>(type)];
+        }
+        const Counter& GetCounter(PooledObjectType type) const {
+            return mCounters[static_cast<size_t>(type)];
+        }
+
+        std::array<Counter, static_cast<size_t>(PooledObjectType::EnumCount)> mCounters;
+    };
+
+    // A pool of objects of type T, owned by a device. The memory is never returned to the system
+    // until the device is destroyed, so that applications creating and releasing the same number
+    // of objects every frame don't hit the heap at all after the first frames. Objects may be
+    // released on another thread than the one they were allocated on, for example when the device
+    // is ticked in the background.
+    //
+    // T must derive from PlacementAllocated and override RefCounted::DeleteThis to return itself
+    // to the pool with Free() since it can't be deleted.
+    template <typename T>
+    class ObjectPool {
+      public:
+        // The number of objects in each slab of memory of the pool.
+        static constexpr size_t kObjectsPerSlab = 64;
+
+        ObjectPool(ObjectPoolCounters* counters, PooledObjectType type)
+            : mAllocator(kObjectsPerSlab * sizeof(T)), mCounters(counters), mType(type) {
+        }
+
+        template <typename... Args>
+        T* Allocate(Args&&... args) {
+            mCounters->AddAllocation(mType);
+            return mAllocator.Allocate(std::forward<Args>(args)...);
+        }
+
+        // Destroys the object and returns its memory to the pool.
+        void Free(T* object) {
+            object->~T();
+            mAllocator.Deallocate(object);
+            mCounters->AddDeallocation(mType);
+        }
+
+      private:
+        ConcurrentSlabAllocator<T> mAllocator;
+        ObjectPoolCounters* mCounters;
+        PooledObjectType mType;
+    };
+
+}  // namespace dawn_native
+
+#endif  // DAWNNATIVE_OBJECTPOOL_H_
@@ -27,7 +27,8 @@ namespace dawn_native {
 
     // Which resources are used by pass and how they are used. The command buffer validation
     // pre-computes this information so that backends with explicit barriers don't have to
-    // re-compute it.
+    // re-compute it. Resources are unique and sorted by address so that usages can be merged
+    // efficiently.
     struct PassResourceUsage {
         std::vector<BufferBase*> buffers;
         std::vector<wgpu::BufferUsage> bufferUsages;
@@ -17,8 +17,91 @@
 #include "dawn_native/Buffer.h"
 #include "dawn_native/Texture.h"
 
+#include <algorithm>
+#include <functional>
+#include <utility>
+
 namespace dawn_native {
 
+    namespace {
+
+        // Merges |otherResources| into |resources| and ORs the usages of resources present in
+        // both. Both lists must be sorted and unique, and so is the result.
+        template <typename Resource, typename Usage>
+        void MergeSortedUsages(std::vector<Resource*>* resources,
+                               std::vector<Usage>* usages,
+                               const std::vector<Resource*>& otherResources,
+                               const std::vector<Usage>& otherUsages) {
+            if (otherResources.empty()) {
+                return;
+            }
+            if (resources->empty()) {
+                *resources = otherResources;
+                *usages = otherUsages;
+                return;
+            }
+
+            std::vector<Resource*> mergedResources;
+            std::vector<Usage> mergedUsages;
+            mergedResources.reserve(resources->size() + otherResources.size());
+            mergedUsages.reserve(resources->size() + otherResources.size());
+
+            std::less<Resource*> less;
+            size_t i = 0;
+            size_t j = 0;
+            while (i < resources->size() && j < otherResources.size()) {
+                if (less((*resources)[i], otherResources[j])) {
+                    mergedResources.push_back((*resources)[i]);
+                    mergedUsages.push_back((*usages)[i]);
+                    i++;
+                } else if (less(otherResources[j], (*resources)[i])) {
+                    mergedResources.push_back(otherResources[j]);
+                    mergedUsages.push_back(otherUsages[j]);
+                    j++;
+                } else {
+                    mergedResources.push_back((*resources)[i]);
+                    mergedUsages.push_back((*usages)[i] | otherUsages[j]);
+                    i++;
+                    j++;
+                }
+            }
+            for (; i < resources->size(); ++i) {
+                mergedResources.push_back((*resources)[i]);
+                mergedUsages.push_back((*usages)[i]);
+            }
+            for (; j < otherResources.size(); ++j) {
+                mergedResources.push_back(otherResources[j]);
+                mergedUsages.push_back(otherUsages[j]);
+            }
+
+            *resources = std::move(mergedResources);
+            *usages = std::move(mergedUsages);
+        }
+
+        // Sorts |pairs| by resource and combines the usages of each resource into |resources| and
+        // |usages|.
+        template <typename Resource, typename Usage>
+        void SortAndCombineUsages(std::vector<std::pair<Resource*, Usage>>* pairs,
+                                  std::vector<Resource*>* resources,
+                                  std::vector<Usage>* usages) {
+            std::sort(pairs->begin(), pairs->end(),
+                      [](const std::pair<Resource*, Usage>& a,
+                         const std::pair<Resource*, Usage>& b) {
+                          return std::less<Resource*>()(a.first, b.first);
+                      });
+
+            for (const std::pair<Resource*, Usage>& pair : *pairs) {
+                if (!resources->empty() && resources->back() == pair.first) {
+                    usages->back() |= pair.second;
+                } else {
+                    resources->push_back(pair.first);
+                    usages->push_back(pair.second);
+                }
+            }
+        }
+
+    }  // anonymous namespace
+
     void PassResourceUsageTracker::BufferUsedAs(BufferBase* buffer, wgpu::BufferUsage usage) {
         // std::map's operator[] will create the key and return 0 if the key didn't exist
         // before.
@@ -31,6 +114,13 @@ namespace dawn_native {
         mTextureUsages[texture] |= usage;
     }
 
+    void PassResourceUsageTracker::AddResourceUsage(const PassResourceUsage& usage) {
+        MergeSortedUsages(&mMergedUsage.buffers, &mMergedUsage.bufferUsages, usage.buffers,
+                          usage.bufferUsages);
+        MergeSortedUsages(&mMergedUsage.textures, &mMergedUsage.textureUsages, usage.textures,
+                          usage.textureUsages);
+    }
+
     // Returns the per-pass usage for use by backends for APIs with explicit barriers.
     PassResourceUsage PassResourceUsageTracker::AcquireResourceUsage() {
         PassResourceUsage result;
@@ -49,9 +139,42 @@ namespace dawn_native {
             result.textureUsages.push_back(it.second);
         }
 
+        MergeSortedUsages(&result.buffers, &result.bufferUsages, mMergedUsage.buffers,
+                          mMergedUsage.bufferUsages);
+        MergeSortedUsages(&result.textures, &result.textureUsages, mMergedUsage.textures,
+                          mMergedUsage.textureUsages);
+
         mBufferUsages.clear();
         mTextureUsages.clear();
+        mMergedUsage = {};
+
+        return result;
+    }
 
+    PassResourceUsage MergeResourceUsages(const std::vector<const PassResourceUsage*>& usages) {
+        size_t bufferCount = 0;
+        size_t textureCount = 0;
+        for (const PassResourceUsage* usage : usages) {
+            bufferCount += usage->buffers.size();
+            textureCount += usage->textures.size();
+        }
+
+        std::vector<std::pair<BufferBase*, wgpu::BufferUsage>> bufferPairs;
+        std::vector<std::pair<TextureBase*, wgpu::TextureUsage>> texturePairs;
+        bufferPairs.reserve(bufferCount);
+        texturePairs.reserve(textureCount);
+        for (const PassResourceUsage* usage : usages) {
+            for (size_t i = 0; i < usage->buffers.size(); ++i) {
+                bufferPairs.emplace_back(usage->buffers[i], usage->bufferUsages[i]);
+            }
+            for (size_t i = 0; i < usage->textures.size(); ++i) {
+                texturePairs.emplace_back(usage->textures[i], usage->textureUsages[i]);
+            }
+        }
+
+        PassResourceUsage result;
+        SortAndCombineUsages(&bufferPairs, &result.buffers, &result.bufferUsages);
+        SortAndCombineUsages(&texturePairs, &result.textures, &result.textureUsages);
         return result;
     }
 
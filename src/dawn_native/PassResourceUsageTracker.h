@@ -20,6 +20,7 @@
 #include "dawn_native/dawn_platform.h"
 
 #include <map>
+#include <vector>
 
 namespace dawn_native {
 
@@ -35,14 +36,24 @@ namespace dawn_native {
         void BufferUsedAs(BufferBase* buffer, wgpu::BufferUsage usage);
         void TextureUsedAs(TextureBase* texture, wgpu::TextureUsage usage);
 
+        // Adds all the usages in |usage|, for example the usage of render bundles. This merges
+        // the sorted lists in a single pass instead of adding each resource one by one.
+        void AddResourceUsage(const PassResourceUsage& usage);
+
         // Returns the per-pass usage for use by backends for APIs with explicit barriers.
         PassResourceUsage AcquireResourceUsage();
 
       private:
         std::map<BufferBase*, wgpu::BufferUsage> mBufferUsages;
         std::map<TextureBase*, wgpu::TextureUsage> mTextureUsages;
+
+        // The usages added with AddResourceUsage, merged together.
+        PassResourceUsage mMergedUsage;
     };
 
+    // Merges a list of usages into a single one.
+    PassResourceUsage MergeResourceUsages(const std::vector<const PassResourceUsage*>& usages);
+
 }  // namespace dawn_native
 
 #endif  // DAWNNATIVE_PASSRESOURCEUSAGETRACKER_H_
@@ -0,0 +1,80 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn_native/PersistentCache.h"
+
+#include "dawn_native/Device.h"
+#include "dawn_platform/DawnPlatform.h"
+
+namespace dawn_native {
+
+    void AppendToCacheKey(PersistentCacheKey* key, uint32_t value) {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+        key->insert(key->end(), bytes, bytes + sizeof(value));
+    }
+
+    void AppendToCacheKey(PersistentCacheKey* key, const std::string& value) {
+        AppendToCacheKey(key, static_cast<uint32_t>(value.size()));
+        key->insert(key->end(), value.begin(), value.end());
+    }
+
+    PersistentCache::PersistentCache(DeviceBase* device) : mDevice(device) {
+    }
+
+    bool PersistentCache::IsEnabled() const {
+        return GetPlatformCache() != nullptr;
+    }
+
+    std::vector<uint8_t> PersistentCache::LoadData(const PersistentCacheKey& key) {
+        std::vector<uint8_t> value;
+
+        dawn_platform::CachingInterface* cache = GetPlatformCache();
+        if (cache == nullptr) {
+            return value;
+        }
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        size_t size = cache->LoadData(key.data(), key.size(), nullptr, 0);
+        if (size == 0) {
+            return value;
+        }
+
+        value.resize(size);
+        // The value may have been dropped or replaced by a smaller one since the size was queried.
+        size_t loadedSize = cache->LoadData(key.data(), key.size(), value.data(), size);
+        if (loadedSize != size) {
+            value.clear();
+        }
+        return value;
+    }
+
+    void PersistentCache::StoreData(const PersistentCacheKey& key, const void* value, size_t size) {
+        dawn_platform::CachingInterface* cache = GetPlatformCache();
+        if (cache == nullptr) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        cache->StoreData(key.data(), key.size(), value, size);
+    }
+
+    dawn_platform::CachingInterface* PersistentCache::GetPlatformCache() const {
+        dawn_platform::Platform* platform = mDevice->GetPlatform();
+        if (platform == nullptr) {
+            return nullptr;
+        }
+        return platform->GetCachingInterface();
+    }
+
+}  // namespace dawn_native
@@ -0,0 +1,66 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_PERSISTENTCACHE_H_
+#define DAWNNATIVE_PERSISTENTCACHE_H_
+
+#include "dawn_native/Forward.h"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace dawn_platform {
+    class CachingInterface;
+}
+
+namespace dawn_native {
+
+    using PersistentCacheKey = std::vector<uint8_t>;
+
+    // Appends a value to a cache key. Strings are prefixed with their length so that different
+    // sequences of strings can't produce the same key.
+    void AppendToCacheKey(PersistentCacheKey* key, uint32_t value);
+    void AppendToCacheKey(PersistentCacheKey* key, const std::string& value);
+
+    // PersistentCache is how the backends store data in the blob store of the platform so that it
+    // survives the device, for example compiled shaders. When the platform doesn't provide a
+    // store, nothing is ever found in the cache. The keys must include everything the data depends
+    // on, including the driver for data that is only valid for one driver.
+    class PersistentCache {
+      public:
+        explicit PersistentCache(DeviceBase* device);
+
+        // Whether the platform provides a store. Data that is costly to produce only for the cache
+        // shouldn't be produced when it is not.
+        bool IsEnabled() const;
+
+        // Returns the data stored for |key|, or an empty vector if there is none.
+        std::vector<uint8_t> LoadData(const PersistentCacheKey& key);
+        void StoreData(const PersistentCacheKey& key, const void* value, size_t size);
+
+      private:
+        dawn_platform::CachingInterface* GetPlatformCache() const;
+
+        DeviceBase* mDevice;
+
+        // The store of the platform might not be thread-safe and the device may create objects on
+        // several threads.
+        std::mutex mMutex;
+    };
+
+}  // namespace dawn_native
+
+#endif  // DAWNNATIVE_PERSISTENTCACHE_H_
@@ -16,11 +16,12 @@
 
 #include "common/Assert.h"
 #include "common/BitSetIterator.h"
-#include "common/HashUtils.h"
 #include "dawn_native/BindGroupLayout.h"
 #include "dawn_native/Device.h"
 #include "dawn_native/ShaderModule.h"
 
+#include <algorithm>
+
 namespace dawn_native {
 
     namespace {
@@ -101,6 +102,13 @@ namespace dawn_native {
             mBindGroupLayouts[group] = descriptor->bindGroupLayouts[group];
             mMask.set(group);
         }
+
+        // The bind group layouts are deduplicated by the device so they are compared by address.
+        mCacheKey.Record(mMask);
+        for (uint32_t group : IterateBitSet(mMask)) {
+            mCacheKey.Record(mBindGroupLayouts[group].Get());
+        }
+        mCacheKey.Seal();
     }
 
     PipelineLayoutBase::PipelineLayoutBase(DeviceBase* device, ObjectBase::ErrorTag tag)
@@ -124,14 +132,31 @@ namespace dawn_native {
         DeviceBase* device,
         const ShaderModuleBase* const* modules,
         uint32_t count) {
-        ASSERT(count > 0);
+        ASSERT(count == 1 || count == 2);
+
+        // Applications create many pipelines from the same modules without a layout, so the
+        // default layout is memoized by the first module instead of being deduced from the
+        // reflection of the modules and looked up in the caches of the device for each pipeline.
+        const ShaderModuleBase* otherModule = count == 2 ? modules[1] : nullptr;
+        PipelineLayoutBase* pipelineLayout = modules[0]->GetDefaultPipelineLayout(otherModule);
+        if (pipelineLayout != nullptr) {
+            pipelineLayout->Reference();
+            return pipelineLayout;
+        }
+
+        DAWN_TRY_ASSIGN(pipelineLayout, ComputeDefault(device, modules, count));
+        modules[0]->SetDefaultPipelineLayout(otherModule, pipelineLayout);
+        return pipelineLayout;
+    }
 
+    // static
+    ResultOrError<PipelineLayoutBase*> PipelineLayoutBase::ComputeDefault(
+        DeviceBase* device,
+        const ShaderModuleBase* const* modules,
+        uint32_t count) {
         // Data which BindGroupLayoutDescriptor will point to for creation
         std::array<std::array<BindGroupLayoutBinding, kMaxBindingsPerGroup>, kMaxBindGroups>
-            bindingData = {};
-
-        // A map of bindings to the index in |bindingData|
-        std::array<std::map<BindingNumber, BindingIndex>, kMaxBindGroups> usedBindingsMap = {};
+            bindingData;
 
         // A counter of how many bindings we've populated in |bindingData|
         std::array<uint32_t, kMaxBindGroups> bindingCounts = {};
@@ -169,25 +194,30 @@ namespace dawn_native {
                         Format::FormatTypeToTextureComponentType(bindingInfo.textureComponentType);
                     bindingSlot.storageTextureFormat = bindingInfo.storageTextureFormat;
 
-                    {
-                        const auto& it = usedBindingsMap[group].find(bindingNumber);
-                        if (it != usedBindingsMap[group].end()) {
-                            if (bindingSlot == bindingData[group][it->second]) {
-                                // Already used and the data is the same. Continue.
-                                continue;
-                            } else {
-                                return DAWN_VALIDATION_ERROR(
-                                    "Duplicate binding in default pipeline layout initialization "
-                                    "not compatible with previous declaration");
-                            }
+                    // Groups have at most kMaxBindingsPerGroup bindings so the bindings of the
+                    // previous modules are searched linearly instead of being put in a map.
+                    const BindGroupLayoutBinding* groupBegin = bindingData[group].data();
+                    const BindGroupLayoutBinding* groupEnd = groupBegin + bindingCounts[group];
+                    const BindGroupLayoutBinding* previous = std::find_if(
+                        groupBegin, groupEnd, [&](const BindGroupLayoutBinding& binding) {
+                            return binding.binding == bindingSlot.binding;
+                        });
+                    if (previous != groupEnd) {
+                        if (bindingSlot == *previous) {
+                            // Already used and the data is the same. Continue.
+                            continue;
+                        } else {
+                            return DAWN_VALIDATION_ERROR(
+                                "Duplicate binding in default pipeline layout initialization "
+                                "not compatible with previous declaration");
                         }
                     }
 
-                    uint32_t currentBindingCount = bindingCounts[group];
-                    bindingData[group][currentBindingCount] = bindingSlot;
-
-                    usedBindingsMap[group][bindingNumber] = currentBindingCount;
-
+                    if (bindingCounts[group] == kMaxBindingsPerGroup) {
+                        return DAWN_VALIDATION_ERROR(
+                            "Too many bindings in a group of the default pipeline layout");
+                    }
+                    bindingData[group][bindingCounts[group]] = bindingSlot;
                     bindingCounts[group]++;
 
                     bindGroupLayoutCount = std::max(bindGroupLayoutCount, group + 1);
@@ -268,28 +298,12 @@ namespace dawn_native {
     }
 
     size_t PipelineLayoutBase::HashFunc::operator()(const PipelineLayoutBase* pl) const {
-        size_t hash = Hash(pl->mMask);
-
-        for (uint32_t group : IterateBitSet(pl->mMask)) {
-            HashCombine(&hash, pl->GetBindGroupLayout(group));
-        }
-
-        return hash;
+        return pl->mCacheKey.GetHash();
     }
 
     bool PipelineLayoutBase::EqualityFunc::operator()(const PipelineLayoutBase* a,
                                                       const PipelineLayoutBase* b) const {
-        if (a->mMask != b->mMask) {
-            return false;
-        }
-
-        for (uint32_t group : IterateBitSet(a->mMask)) {
-            if (a->GetBindGroupLayout(group) != b->GetBindGroupLayout(group)) {
-                return false;
-            }
-        }
-
-        return true;
+        return a->mCacheKey == b->mCacheKey;
     }
 
 }  // namespace dawn_native
@@ -16,6 +16,7 @@
 #define DAWNNATIVE_PIPELINELAYOUT_H_
 
 #include "common/Constants.h"
+#include "dawn_native/CacheKey.h"
 #include "dawn_native/CachedObject.h"
 #include "dawn_native/Error.h"
 #include "dawn_native/Forward.h"
@@ -38,6 +39,8 @@ namespace dawn_native {
         ~PipelineLayoutBase() override;
 
         static PipelineLayoutBase* MakeError(DeviceBase* device);
+        // |modules| are the compute module, or the vertex module followed by the optional
+        // fragment module.
         static ResultOrError<PipelineLayoutBase*>
         CreateDefault(DeviceBase* device, const ShaderModuleBase* const* modules, uint32_t count);
 
@@ -66,6 +69,12 @@ namespace dawn_native {
 
         BindGroupLayoutArray mBindGroupLayouts;
         std::bitset<kMaxBindGroups> mMask;
+
+      private:
+        static ResultOrError<PipelineLayoutBase*>
+        ComputeDefault(DeviceBase* device, const ShaderModuleBase* const* modules, uint32_t count);
+
+        CacheKey mCacheKey;
     };
 
 }  // namespace dawn_native
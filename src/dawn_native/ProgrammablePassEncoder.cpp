@@ -74,13 +74,17 @@ namespace dawn_native {
 
     ProgrammablePassEncoder::ProgrammablePassEncoder(DeviceBase* device,
                                                      EncodingContext* encodingContext)
-        : ObjectBase(device), mEncodingContext(encodingContext) {
+        : ObjectBase(device),
+          mEncodingContext(encodingContext),
+          mElideRedundantCommands(device->IsToggleEnabled(Toggle::ElideRedundantCommands)) {
     }
 
     ProgrammablePassEncoder::ProgrammablePassEncoder(DeviceBase* device,
                                                      EncodingContext* encodingContext,
                                                      ErrorTag errorTag)
-        : ObjectBase(device, errorTag), mEncodingContext(encodingContext) {
+        : ObjectBase(device, errorTag),
+          mEncodingContext(encodingContext),
+          mElideRedundantCommands(device->IsToggleEnabled(Toggle::ElideRedundantCommands)) {
     }
 
     void ProgrammablePassEncoder::InsertDebugMarker(const char* groupLabel) {
@@ -126,13 +130,16 @@ namespace dawn_native {
                 DAWN_TRY(GetDevice()->ValidateObject(group));
 
                 if (groupIndex >= kMaxBindGroups) {
-                    return DAWN_VALIDATION_ERROR("Setting bind group over the max");
+                    return DAWN_VALIDATION_ERROR("Setting bind group {} over the max of {}",
+                                                 groupIndex, kMaxBindGroups);
                 }
 
                 // Dynamic offsets count must match the number required by the layout perfectly.
                 const BindGroupLayoutBase* layout = group->GetLayout();
                 if (layout->GetDynamicBufferCount() != dynamicOffsetCount) {
-                    return DAWN_VALIDATION_ERROR("dynamicOffset count mismatch");
+                    return DAWN_VALIDATION_ERROR(
+                        "dynamicOffset count mismatch, {} given but {} required",
+                        dynamicOffsetCount, layout->GetDynamicBufferCount());
                 }
 
                 for (BindingIndex i = 0; i < dynamicOffsetCount; ++i) {
@@ -170,6 +177,14 @@ namespace dawn_native {
                 }
             }
 
+            // The resource usages of the group were already tracked when it was first set.
+            if (mElideRedundantCommands &&
+                mRedundantCommandTracker.SetBindGroup(groupIndex, group, dynamicOffsetCount,
+                                                      dynamicOffsets)) {
+                GetDevice()->IncrementElidedCommandCount();
+                return {};
+            }
+
             SetBindGroupCmd* cmd = allocator->Allocate<SetBindGroupCmd>(Command::SetBindGroup);
             cmd->index = groupIndex;
             cmd->group = group;
@@ -19,6 +19,7 @@
 #include "dawn_native/Error.h"
 #include "dawn_native/ObjectBase.h"
 #include "dawn_native/PassResourceUsageTracker.h"
+#include "dawn_native/RedundantCommandTracker.h"
 
 #include "dawn_native/dawn_platform.h"
 
@@ -49,6 +50,10 @@ namespace dawn_native {
 
         EncodingContext* mEncodingContext = nullptr;
         PassResourceUsageTracker mUsageTracker;
+
+        // Only updated when Toggle::ElideRedundantCommands is enabled.
+        const bool mElideRedundantCommands;
+        RedundantCommandTracker mRedundantCommandTracker;
     };
 
 }  // namespace dawn_native
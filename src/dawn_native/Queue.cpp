@@ -21,10 +21,13 @@
 #include "dawn_native/ErrorScopeTracker.h"
 #include "dawn_native/Fence.h"
 #include "dawn_native/FenceSignalTracker.h"
+#include "dawn_native/SubmitCoalescer.h"
 #include "dawn_native/Texture.h"
 #include "dawn_platform/DawnPlatform.h"
 #include "dawn_platform/tracing/TraceEvent.h"
 
+#include <algorithm>
+
 namespace dawn_native {
 
     // QueueBase
@@ -45,6 +48,11 @@ namespace dawn_native {
         return {};
     }
 
+    MaybeError QueueBase::LazyClearTexturesImpl(const std::vector<TextureBase*>& textures) {
+        UNREACHABLE();
+        return {};
+    }
+
     void QueueBase::Submit(uint32_t commandCount, CommandBufferBase* const* commands) {
         DeviceBase* device = GetDevice();
         if (device->ConsumedError(device->ValidateIsAlive())) {
@@ -59,13 +67,36 @@ namespace dawn_native {
         }
         ASSERT(!IsError());
 
-        if (device->ConsumedError(SubmitImpl(commandCount, commands))) {
+        if (device->IsToggleEnabled(Toggle::CoalesceQueueSubmits)) {
+            device->GetSubmitCoalescer()->Enqueue(this, commandCount, commands);
+            return;
+        }
+
+        if (device->ConsumedError(SubmitValidatedCommands(commandCount, commands))) {
             return;
         }
         device->GetErrorScopeTracker()->TrackUntilLastSubmitComplete(
             device->GetCurrentErrorScope());
     }
 
+    MaybeError QueueBase::SubmitValidatedCommands(uint32_t commandCount,
+                                                  CommandBufferBase* const* commands) {
+        DeviceBase* device = GetDevice();
+
+        // Clear all the textures that will be lazily cleared by the passes of the submit at once
+        // so that backends don't have to interleave clears with the submitted commands.
+        if (device->IsToggleEnabled(Toggle::LazyClearResourceOnFirstUse)) {
+            std::vector<TextureBase*> texturesToClear =
+                CollectLazyClearTextures(commandCount, commands);
+            if (!texturesToClear.empty()) {
+                DAWN_TRY(LazyClearTexturesImpl(texturesToClear));
+                device->IncrementLazyClearBatchCountForTesting();
+            }
+        }
+
+        return SubmitImpl(commandCount, commands);
+    }
+
     void QueueBase::Signal(Fence* fence, uint64_t signalValue) {
         DeviceBase* device = GetDevice();
         if (device->ConsumedError(ValidateSignal(fence, signalValue))) {
@@ -73,6 +104,11 @@ namespace dawn_native {
         }
         ASSERT(!IsError());
 
+        // The fence must only complete after the coalesced submits that precede it.
+        if (!device->GetSubmitCoalescer()->Flush()) {
+            return;
+        }
+
         fence->SetSignaledValue(signalValue);
         device->GetFenceSignalTracker()->UpdateFenceOnComplete(fence, signalValue);
         device->GetErrorScopeTracker()->TrackUntilLastSubmitComplete(
@@ -117,6 +153,42 @@ namespace dawn_native {
         return {};
     }
 
+    std::vector<TextureBase*> QueueBase::CollectLazyClearTextures(
+        uint32_t commandCount,
+        CommandBufferBase* const* commands) {
+        TRACE_EVENT0(GetDevice()->GetPlatform(), General, "Queue::CollectLazyClearTextures");
+
+        // Passes clear the whole content of uninitialized textures they use unless they are only
+        // used as output attachments, in which case the render pass load op handles the clear.
+        // Copies are not included because they only lazy clear the subresources they touch, and
+        // only when the copy doesn't overwrite them completely.
+        // Output attachments of reusable command buffers are cleared here too because changing
+        // their load op would change the recorded commands between submits.
+        std::vector<TextureBase*> textures;
+        for (uint32_t i = 0; i < commandCount; ++i) {
+            bool clearOutputAttachments = commands[i]->IsReusable();
+            for (const PassResourceUsage& passUsages : commands[i]->GetResourceUsages().perPass) {
+                for (size_t j = 0; j < passUsages.textures.size(); ++j) {
+                    TextureBase* texture = passUsages.textures[j];
+                    if (!clearOutputAttachments &&
+                        (passUsages.textureUsages[j] & wgpu::TextureUsage::OutputAttachment)) {
+                        continue;
+                    }
+                    if (texture->IsSubresourceContentInitialized(0, texture->GetNumMipLevels(), 0,
+                                                                 texture->GetArrayLayers())) {
+                        continue;
+                    }
+                    textures.push_back(texture);
+                }
+            }
+        }
+
+        // A texture can be used in multiple passes, only clear it once.
+        std::sort(textures.begin(), textures.end());
+        textures.erase(std::unique(textures.begin(), textures.end()), textures.end());
+        return textures;
+    }
+
     MaybeError QueueBase::ValidateSignal(const Fence* fence, uint64_t signalValue) {
         DAWN_TRY(GetDevice()->ValidateIsAlive());
         DAWN_TRY(GetDevice()->ValidateObject(this));
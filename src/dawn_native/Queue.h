@@ -21,6 +21,8 @@
 
 #include "dawn_native/dawn_platform.h"
 
+#include <vector>
+
 namespace dawn_native {
 
     class QueueBase : public ObjectBase {
@@ -34,11 +36,23 @@ namespace dawn_native {
         void Signal(Fence* fence, uint64_t signalValue);
         Fence* CreateFence(const FenceDescriptor* descriptor);
 
+        // Does the work of a submit after it was validated: lazily clears the textures used by
+        // the command buffers then gives them to the backend.
+        MaybeError SubmitValidatedCommands(uint32_t commandCount,
+                                           CommandBufferBase* const* commands);
+
       private:
         QueueBase(DeviceBase* device, ObjectBase::ErrorTag tag);
 
         virtual MaybeError SubmitImpl(uint32_t commandCount, CommandBufferBase* const* commands);
 
+        // Clears the whole content of |textures| before the commands of the current submit.
+        // Called before SubmitImpl with the textures returned by CollectLazyClearTextures.
+        virtual MaybeError LazyClearTexturesImpl(const std::vector<TextureBase*>& textures);
+
+        std::vector<TextureBase*> CollectLazyClearTextures(uint32_t commandCount,
+                                                           CommandBufferBase* const* commands);
+
         MaybeError ValidateSubmit(uint32_t commandCount, CommandBufferBase* const* commands);
         MaybeError ValidateSignal(const Fence* fence, uint64_t signalValue);
         MaybeError ValidateCreateFence(const FenceDescriptor* descriptor);
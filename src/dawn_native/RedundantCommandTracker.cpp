@@ -0,0 +1,135 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn_native/RedundantCommandTracker.h"
+
+#include <algorithm>
+
+namespace dawn_native {
+
+    bool RedundantCommandTracker::SetPipeline(PipelineBase* pipeline) {
+        if (mPipeline == pipeline) {
+            return true;
+        }
+        mPipeline = pipeline;
+        return false;
+    }
+
+    bool RedundantCommandTracker::SetBindGroup(uint32_t index,
+                                               BindGroupBase* group,
+                                               uint32_t dynamicOffsetCount,
+                                               const uint32_t* dynamicOffsets) {
+        // Indices and offset counts are only guaranteed to be in bounds when validation is
+        // enabled, never elide commands outside of the tracked state.
+        if (index >= kMaxBindGroups) {
+            return false;
+        }
+
+        BindGroupState& state = mBindGroups[index];
+        if (dynamicOffsetCount > kMaxDynamicBufferCount) {
+            state.group = nullptr;
+            return false;
+        }
+
+        if (state.group == group && state.dynamicOffsetCount == dynamicOffsetCount &&
+            std::equal(dynamicOffsets, dynamicOffsets + dynamicOffsetCount,
+                       state.dynamicOffsets.begin())) {
+            return true;
+        }
+
+        state.group = group;
+        state.dynamicOffsetCount = dynamicOffsetCount;
+        std::copy(dynamicOffsets, dynamicOffsets + dynamicOffsetCount,
+                  state.dynamicOffsets.begin());
+        return false;
+    }
+
+    bool RedundantCommandTracker::SetVertexBuffer(uint32_t slot,
+                                                  BufferBase* buffer,
+                                                  uint64_t offset) {
+        if (slot >= kMaxVertexBuffers) {
+            return false;
+        }
+
+        BufferState& state = mVertexBuffers[slot];
+        if (state.buffer == buffer && state.offset == offset) {
+            return true;
+        }
+        state = {buffer, offset};
+        return false;
+    }
+
+    bool RedundantCommandTracker::SetIndexBuffer(BufferBase* buffer, uint64_t offset) {
+        if (mIndexBuffer.buffer == buffer && mIndexBuffer.offset == offset) {
+            return true;
+        }
+        mIndexBuffer = {buffer, offset};
+        return false;
+    }
+
+    bool RedundantCommandTracker::SetStencilReference(uint32_t reference) {
+        if (mFixedFunctionStateSet[FIXED_FUNCTION_STATE_STENCIL_REFERENCE] &&
+            mStencilReference == reference) {
+            return true;
+        }
+        mFixedFunctionStateSet.set(FIXED_FUNCTION_STATE_STENCIL_REFERENCE);
+        mStencilReference = reference;
+        return false;
+    }
+
+    bool RedundantCommandTracker::SetBlendColor(const Color& color) {
+        if (mFixedFunctionStateSet[FIXED_FUNCTION_STATE_BLEND_COLOR] &&
+            mBlendColor.r == color.r && mBlendColor.g == color.g && mBlendColor.b == color.b &&
+            mBlendColor.a == color.a) {
+            return true;
+        }
+        mFixedFunctionStateSet.set(FIXED_FUNCTION_STATE_BLEND_COLOR);
+        mBlendColor = color;
+        return false;
+    }
+
+    bool RedundantCommandTracker::SetViewport(float x,
+                                              float y,
+                                              float width,
+                                              float height,
+                                              float minDepth,
+                                              float maxDepth) {
+        std::array<float, 6> viewport = {x, y, width, height, minDepth, maxDepth};
+        if (mFixedFunctionStateSet[FIXED_FUNCTION_STATE_VIEWPORT] && mViewport == viewport) {
+            return true;
+        }
+        mFixedFunctionStateSet.set(FIXED_FUNCTION_STATE_VIEWPORT);
+        mViewport = viewport;
+        return false;
+    }
+
+    bool RedundantCommandTracker::SetScissorRect(uint32_t x,
+                                                 uint32_t y,
+                                                 uint32_t width,
+                                                 uint32_t height) {
+        std::array<uint32_t, 4> scissorRect = {x, y, width, height};
+        if (mFixedFunctionStateSet[FIXED_FUNCTION_STATE_SCISSOR_RECT] &&
+            mScissorRect == scissorRect) {
+            return true;
+        }
+        mFixedFunctionStateSet.set(FIXED_FUNCTION_STATE_SCISSOR_RECT);
+        mScissorRect = scissorRect;
+        return false;
+    }
+
+    void RedundantCommandTracker::Reset() {
+        *this = RedundantCommandTracker();
+    }
+
+}  // namespace dawn_native
@@ -0,0 +1,90 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_REDUNDANTCOMMANDTRACKER_H_
+#define DAWNNATIVE_REDUNDANTCOMMANDTRACKER_H_
+
+#include "common/Constants.h"
+#include "dawn_native/Forward.h"
+
+#include "dawn_native/dawn_platform.h"
+
+#include <array>
+#include <bitset>
+
+namespace dawn_native {
+
+    // Tracks the state set by the commands of a pass or render bundle during encoding so that
+    // commands that set state to the value it already has can be dropped instead of being
+    // recorded and replayed by the backends.
+    //
+    // Each Set* method records the new state and returns true if it is the same as the current
+    // state, meaning the command is redundant. State that wasn't set yet is never redundant
+    // because its initial value depends on the backend and, for render bundles, on the pass they
+    // are executed in.
+    class RedundantCommandTracker {
+      public:
+        bool SetPipeline(PipelineBase* pipeline);
+        bool SetBindGroup(uint32_t index,
+                          BindGroupBase* group,
+                          uint32_t dynamicOffsetCount,
+                          const uint32_t* dynamicOffsets);
+        bool SetVertexBuffer(uint32_t slot, BufferBase* buffer, uint64_t offset);
+        bool SetIndexBuffer(BufferBase* buffer, uint64_t offset);
+        bool SetStencilReference(uint32_t reference);
+        bool SetBlendColor(const Color& color);
+        bool SetViewport(float x, float y, float width, float height, float minDepth, float maxDepth);
+        bool SetScissorRect(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
+        // Forgets all the state, for example after render bundles reset the state of a pass.
+        void Reset();
+
+      private:
+        struct BindGroupState {
+            BindGroupBase* group = nullptr;
+            uint32_t dynamicOffsetCount = 0;
+            std::array<uint32_t, kMaxDynamicBufferCount> dynamicOffsets;
+        };
+
+        struct BufferState {
+            BufferBase* buffer = nullptr;
+            uint64_t offset = 0;
+        };
+
+        PipelineBase* mPipeline = nullptr;
+        std::array<BindGroupState, kMaxBindGroups> mBindGroups;
+        std::array<BufferState, kMaxVertexBuffers> mVertexBuffers;
+        BufferState mIndexBuffer;
+
+        // Fixed function state doesn't have a "null" value so whether it was set is tracked
+        // separately.
+        enum FixedFunctionState {
+            FIXED_FUNCTION_STATE_STENCIL_REFERENCE,
+            FIXED_FUNCTION_STATE_BLEND_COLOR,
+            FIXED_FUNCTION_STATE_VIEWPORT,
+            FIXED_FUNCTION_STATE_SCISSOR_RECT,
+
+            FIXED_FUNCTION_STATE_COUNT
+        };
+        std::bitset<FIXED_FUNCTION_STATE_COUNT> mFixedFunctionStateSet;
+
+        uint32_t mStencilReference = 0;
+        Color mBlendColor;
+        std::array<float, 6> mViewport;
+        std::array<uint32_t, 4> mScissorRect;
+    };
+
+}  // namespace dawn_native
+
+#endif  // DAWNNATIVE_REDUNDANTCOMMANDTRACKER_H_
@@ -20,12 +20,21 @@
 
 namespace dawn_native {
 
-    static constexpr size_t kPayloadBits = 1;
+    // The lowest bit of the payload is given by the subclasses, the next one tags objects using
+    // non-atomic refcounts.
+    static constexpr size_t kPayloadBits = 2;
     static constexpr uint64_t kPayloadMask = (uint64_t(1) << kPayloadBits) - 1;
+    static constexpr uint64_t kExternalPayloadMask = 1;
+    static constexpr uint64_t kNonAtomicBit = 2;
     static constexpr uint64_t kRefCountIncrement = (uint64_t(1) << kPayloadBits);
 
-    RefCounted::RefCounted(uint64_t payload) : mRefCount(kRefCountIncrement + payload) {
-        ASSERT((payload & kPayloadMask) == payload);
+    RefCounted::RefCounted(uint64_t payload, RefCountMode mode)
+        : mRefCount(kRefCountIncrement + payload +
+                    (mode == RefCountMode::NonAtomic ? kNonAtomicBit : 0)) {
+        ASSERT((payload & kExternalPayloadMask) == payload);
+#if defined(DAWN_ENABLE_ASSERTS)
+        mOwningThread = std::this_thread::get_id();
+#endif
     }
 
     RefCounted::~RefCounted() {
@@ -40,12 +49,38 @@ namespace dawn_native {
         // initialization so we can use the relaxed memory order. The order doesn't guarantee
         // anything except the atomicity of the load, which is enough since any past values of the
         // atomic will have the correct payload bits.
-        return kPayloadMask & mRefCount.load(std::memory_order_relaxed);
+        return kExternalPayloadMask & mRefCount.load(std::memory_order_relaxed);
+    }
+
+    bool RefCounted::IsNonAtomic() const {
+        // Like the other payload bits this one never changes after initialization.
+        return (mRefCount.load(std::memory_order_relaxed) & kNonAtomicBit) != 0;
+    }
+
+    void RefCounted::SetOwningThreadToCurrent() {
+#if defined(DAWN_ENABLE_ASSERTS)
+        mOwningThread = std::this_thread::get_id();
+#endif
+    }
+
+    void RefCounted::DeleteThis() {
+        delete this;
     }
 
     void RefCounted::Reference() {
         ASSERT((mRefCount & ~kPayloadMask) != 0);
 
+        // Non-atomic refcounts are only ever accessed from a single thread, so a separate load and
+        // store, that compile to plain memory accesses, is enough and avoids a locked instruction.
+        if (IsNonAtomic()) {
+#if defined(DAWN_ENABLE_ASSERTS)
+            ASSERT(mOwningThread == std::this_thread::get_id());
+#endif
+            mRefCount.store(mRefCount.load(std::memory_order_relaxed) + kRefCountIncrement,
+                            std::memory_order_relaxed);
+            return;
+        }
+
         // The relaxed ordering guarantees only the atomicity of the update, which is enough here
         // because the reference we are copying from still exists and makes sure other threads
         // don't delete `this`.
@@ -57,12 +92,24 @@ namespace dawn_native {
     void RefCounted::Release() {
         ASSERT((mRefCount & ~kPayloadMask) != 0);
 
+        if (IsNonAtomic()) {
+#if defined(DAWN_ENABLE_ASSERTS)
+            ASSERT(mOwningThread == std::this_thread::get_id());
+#endif
+            uint64_t previousRefCount = mRefCount.load(std::memory_order_relaxed);
+            mRefCount.store(previousRefCount - kRefCountIncrement, std::memory_order_relaxed);
+            if (previousRefCount < 2 * kRefCountIncrement) {
+                DeleteThis();
+            }
+            return;
+        }
+
         // The release fence here is to make sure all accesses to the object on a thread A
         // happen-before the object is deleted on a thread B. The release memory order ensures that
         // all accesses on thread A happen-before the refcount is decreased and the atomic variable
         // makes sure the refcount decrease in A happens-before the refcount decrease in B. Finally
         // the acquire fence in the destruction case makes sure the refcount decrease in B
-        // happens-before the `delete this`.
+        // happens-before the `DeleteThis()`.
         //
         // See the explanation in the Boost documentation:
         //     https://www.boost.org/doc/libs/1_55_0/doc/html/atomic/usage_examples.html
@@ -75,7 +122,7 @@ namespace dawn_native {
             // memory barrier, when an acquire load on mRefCount (using the `ldar` instruction)
             // should be enough and could end up being faster.
             std::atomic_thread_fence(std::memory_order_acquire);
-            delete this;
+            DeleteThis();
         }
     }
 
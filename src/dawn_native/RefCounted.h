@@ -18,11 +18,22 @@
 #include <atomic>
 #include <cstdint>
 
+#if defined(DAWN_ENABLE_ASSERTS)
+#    include <thread>
+#endif
+
 namespace dawn_native {
 
+    enum class RefCountMode {
+        Atomic,
+        // The refcount is updated without atomic read-modify-writes, the object must only be
+        // referenced and released on the thread that created it.
+        NonAtomic,
+    };
+
     class RefCounted {
       public:
-        RefCounted(uint64_t payload = 0);
+        RefCounted(uint64_t payload = 0, RefCountMode mode = RefCountMode::Atomic);
         virtual ~RefCounted();
 
         uint64_t GetRefCountForTesting() const;
@@ -32,8 +43,24 @@ namespace dawn_native {
         void Reference();
         void Release();
 
+        // Makes the calling thread the owner of a non-atomic refcount. Only valid for objects
+        // created on a thread that handed them over (with synchronization) and no longer uses
+        // them, like the objects created on worker threads.
+        void SetOwningThreadToCurrent();
+
       protected:
+        // Called when the last reference is released. Objects that aren't allocated with new, for
+        // example the ones allocated from an ObjectPool, override it to free themselves.
+        virtual void DeleteThis();
+
         std::atomic_uint64_t mRefCount;
+
+      private:
+        bool IsNonAtomic() const;
+
+#if defined(DAWN_ENABLE_ASSERTS)
+        std::thread::id mOwningThread;
+#endif
     };
 
     template <typename T>
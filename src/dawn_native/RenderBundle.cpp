@@ -17,10 +17,17 @@
 #include "common/BitSetIterator.h"
 #include "dawn_native/Commands.h"
 #include "dawn_native/Device.h"
+#include "dawn_native/PassResourceUsageTracker.h"
 #include "dawn_native/RenderBundleEncoder.h"
 
+#include <atomic>
+
 namespace dawn_native {
 
+    namespace {
+        std::atomic<uint64_t> sNextRenderBundleId(1);
+    }  // anonymous namespace
+
     RenderBundleBase::RenderBundleBase(RenderBundleEncoder* encoder,
                                        const RenderBundleDescriptor* descriptor,
                                        AttachmentState* attachmentState,
@@ -28,7 +35,8 @@ namespace dawn_native {
         : ObjectBase(encoder->GetDevice()),
           mCommands(encoder->AcquireCommands()),
           mAttachmentState(attachmentState),
-          mResourceUsage(std::move(resourceUsage)) {
+          mResourceUsage(std::move(resourceUsage)),
+          mUniqueId(sNextRenderBundleId++) {
     }
 
     RenderBundleBase::~RenderBundleBase() {
@@ -58,4 +66,35 @@ namespace dawn_native {
         return mResourceUsage;
     }
 
+    const PassResourceUsage& RenderBundleBase::GetMergedResourceUsage(
+        uint32_t count,
+        RenderBundleBase* const* bundles) {
+        ASSERT(!IsError());
+        ASSERT(count > 0 && bundles[0] == this);
+
+        if (count == 1) {
+            return mResourceUsage;
+        }
+
+        bool cacheHit = mMergedUsageCacheKey.size() == count - 1;
+        for (uint32_t i = 1; cacheHit && i < count; ++i) {
+            cacheHit = mMergedUsageCacheKey[i - 1] == bundles[i]->mUniqueId;
+        }
+        if (cacheHit) {
+            return mMergedUsageCache;
+        }
+
+        std::vector<const PassResourceUsage*> usages(count);
+        mMergedUsageCacheKey.resize(count - 1);
+        for (uint32_t i = 0; i < count; ++i) {
+            usages[i] = &bundles[i]->GetResourceUsage();
+            if (i > 0) {
+                mMergedUsageCacheKey[i - 1] = bundles[i]->mUniqueId;
+            }
+        }
+        mMergedUsageCache = MergeResourceUsages(usages);
+
+        return mMergedUsageCache;
+    }
+
 }  // namespace dawn_native
@@ -25,6 +25,7 @@
 #include "dawn_native/dawn_platform.h"
 
 #include <bitset>
+#include <vector>
 
 namespace dawn_native {
 
@@ -47,12 +48,25 @@ namespace dawn_native {
         const AttachmentState* GetAttachmentState() const;
         const PassResourceUsage& GetResourceUsage() const;
 
+        // Returns the merged resource usage of executing |bundles|, where this bundle is the
+        // first one. Applications usually execute the same groups of bundles every frame so the
+        // result for the last group starting with this bundle is cached.
+        const PassResourceUsage& GetMergedResourceUsage(uint32_t count,
+                                                        RenderBundleBase* const* bundles);
+
       private:
         RenderBundleBase(DeviceBase* device, ErrorTag errorTag);
 
         CommandIterator mCommands;
         Ref<AttachmentState> mAttachmentState;
         PassResourceUsage mResourceUsage;
+
+        // Bundles are identified by a unique ID in the cache key instead of their address so
+        // that a destroyed bundle can't be confused with a new one allocated at the same address,
+        // without the cache keeping bundles alive.
+        uint64_t mUniqueId = 0;
+        std::vector<uint64_t> mMergedUsageCacheKey;
+        PassResourceUsage mMergedUsageCache;
     };
 
 }  // namespace dawn_native
@@ -127,6 +127,11 @@ namespace dawn_native {
         mEncodingContext->TryEncode(this, [&](CommandAllocator* allocator) -> MaybeError {
             DAWN_TRY(GetDevice()->ValidateObject(pipeline));
 
+            if (mElideRedundantCommands && mRedundantCommandTracker.SetPipeline(pipeline)) {
+                GetDevice()->IncrementElidedCommandCount();
+                return {};
+            }
+
             SetRenderPipelineCmd* cmd =
                 allocator->Allocate<SetRenderPipelineCmd>(Command::SetRenderPipeline);
             cmd->pipeline = pipeline;
@@ -139,6 +144,11 @@ namespace dawn_native {
         mEncodingContext->TryEncode(this, [&](CommandAllocator* allocator) -> MaybeError {
             DAWN_TRY(GetDevice()->ValidateObject(buffer));
 
+            if (mElideRedundantCommands && mRedundantCommandTracker.SetIndexBuffer(buffer, offset)) {
+                GetDevice()->IncrementElidedCommandCount();
+                return {};
+            }
+
             SetIndexBufferCmd* cmd =
                 allocator->Allocate<SetIndexBufferCmd>(Command::SetIndexBuffer);
             cmd->buffer = buffer;
@@ -158,6 +168,12 @@ namespace dawn_native {
                 return DAWN_VALIDATION_ERROR("Vertex buffer slot out of bounds");
             }
 
+            if (mElideRedundantCommands &&
+                mRedundantCommandTracker.SetVertexBuffer(slot, buffer, offset)) {
+                GetDevice()->IncrementElidedCommandCount();
+                return {};
+            }
+
             SetVertexBufferCmd* cmd =
                 allocator->Allocate<SetVertexBufferCmd>(Command::SetVertexBuffer);
             cmd->slot = slot;
@@ -48,7 +48,12 @@ namespace dawn_native {
     RenderPassEncoder* RenderPassEncoder::MakeError(DeviceBase* device,
                                                     CommandEncoder* commandEncoder,
                                                     EncodingContext* encodingContext) {
-        return new RenderPassEncoder(device, commandEncoder, encodingContext, ObjectBase::kError);
+        return device->GetRenderPassEncoderPool()->Allocate(
+            device, commandEncoder, encodingContext, ObjectBase::kError);
+    }
+
+    void RenderPassEncoder::DeleteThis() {
+        GetDevice()->GetRenderPassEncoderPool()->Free(this);
     }
 
     void RenderPassEncoder::EndPass() {
@@ -63,6 +68,11 @@ namespace dawn_native {
 
     void RenderPassEncoder::SetStencilReference(uint32_t reference) {
         mEncodingContext->TryEncode(this, [&](CommandAllocator* allocator) -> MaybeError {
+            if (mElideRedundantCommands && mRedundantCommandTracker.SetStencilReference(reference)) {
+                GetDevice()->IncrementElidedCommandCount();
+                return {};
+            }
+
             SetStencilReferenceCmd* cmd =
                 allocator->Allocate<SetStencilReferenceCmd>(Command::SetStencilReference);
             cmd->reference = reference;
@@ -73,6 +83,11 @@ namespace dawn_native {
 
     void RenderPassEncoder::SetBlendColor(const Color* color) {
         mEncodingContext->TryEncode(this, [&](CommandAllocator* allocator) -> MaybeError {
+            if (mElideRedundantCommands && mRedundantCommandTracker.SetBlendColor(*color)) {
+                GetDevice()->IncrementElidedCommandCount();
+                return {};
+            }
+
             SetBlendColorCmd* cmd = allocator->Allocate<SetBlendColorCmd>(Command::SetBlendColor);
             cmd->color = *color;
 
@@ -103,6 +118,12 @@ namespace dawn_native {
                 return DAWN_VALIDATION_ERROR("minDepth and maxDepth must be in [0, 1].");
             }
 
+            if (mElideRedundantCommands &&
+                mRedundantCommandTracker.SetViewport(x, y, width, height, minDepth, maxDepth)) {
+                GetDevice()->IncrementElidedCommandCount();
+                return {};
+            }
+
             SetViewportCmd* cmd = allocator->Allocate<SetViewportCmd>(Command::SetViewport);
             cmd->x = x;
             cmd->y = y;
@@ -124,6 +145,12 @@ namespace dawn_native {
                 return DAWN_VALIDATION_ERROR("Width and height must be greater than 0.");
             }
 
+            if (mElideRedundantCommands &&
+                mRedundantCommandTracker.SetScissorRect(x, y, width, height)) {
+                GetDevice()->IncrementElidedCommandCount();
+                return {};
+            }
+
             SetScissorRectCmd* cmd =
                 allocator->Allocate<SetScissorRectCmd>(Command::SetScissorRect);
             cmd->x = x;
@@ -148,16 +175,16 @@ namespace dawn_native {
             Ref<RenderBundleBase>* bundles = allocator->AllocateData<Ref<RenderBundleBase>>(count);
             for (uint32_t i = 0; i < count; ++i) {
                 bundles[i] = renderBundles[i];
+            }
 
-                const PassResourceUsage& usages = bundles[i]->GetResourceUsage();
-                for (uint32_t i = 0; i < usages.buffers.size(); ++i) {
-                    mUsageTracker.BufferUsedAs(usages.buffers[i], usages.bufferUsages[i]);
-                }
-                for (uint32_t i = 0; i < usages.textures.size(); ++i) {
-                    mUsageTracker.TextureUsedAs(usages.textures[i], usages.textureUsages[i]);
-                }
+            if (count > 0) {
+                mUsageTracker.AddResourceUsage(
+                    renderBundles[0]->GetMergedResourceUsage(count, renderBundles));
             }
 
+            // Executing render bundles resets the state of the pass.
+            mRedundantCommandTracker.Reset();
+
             return {};
         });
     }
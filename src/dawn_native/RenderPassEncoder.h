@@ -15,6 +15,7 @@
 #ifndef DAWNNATIVE_RENDERPASSENCODER_H_
 #define DAWNNATIVE_RENDERPASSENCODER_H_
 
+#include "common/PlacementAllocated.h"
 #include "dawn_native/Error.h"
 #include "dawn_native/RenderEncoderBase.h"
 
@@ -22,13 +23,19 @@ namespace dawn_native {
 
     class RenderBundleBase;
 
-    class RenderPassEncoder final : public RenderEncoderBase {
+    // Allocated from the pool of the device, see DeviceBase::GetRenderPassEncoderPool.
+    class RenderPassEncoder final : public RenderEncoderBase, public PlacementAllocated {
       public:
         RenderPassEncoder(DeviceBase* device,
                           CommandEncoder* commandEncoder,
                           EncodingContext* encodingContext,
                           PassResourceUsageTracker usageTracker);
 
+        RenderPassEncoder(DeviceBase* device,
+                          CommandEncoder* commandEncoder,
+                          EncodingContext* encodingContext,
+                          ErrorTag errorTag);
+
         static RenderPassEncoder* MakeError(DeviceBase* device,
                                             CommandEncoder* commandEncoder,
                                             EncodingContext* encodingContext);
@@ -46,13 +53,9 @@ namespace dawn_native {
         void SetScissorRect(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
         void ExecuteBundles(uint32_t count, RenderBundleBase* const* renderBundles);
 
-      protected:
-        RenderPassEncoder(DeviceBase* device,
-                          CommandEncoder* commandEncoder,
-                          EncodingContext* encodingContext,
-                          ErrorTag errorTag);
-
       private:
+        void DeleteThis() override;
+
         // For render and compute passes, the encoding context is borrowed from the command encoder.
         // Keep a reference to the encoder to make sure the context isn't freed.
         Ref<CommandEncoder> mCommandEncoder;
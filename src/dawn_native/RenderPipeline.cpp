@@ -15,7 +15,7 @@
 #include "dawn_native/RenderPipeline.h"
 
 #include "common/BitSetIterator.h"
-#include "common/HashUtils.h"
+#include "dawn_native/CacheKeys_autogen.h"
 #include "dawn_native/Commands.h"
 #include "dawn_native/Device.h"
 #include "dawn_native/ValidationUtils_autogen.h"
@@ -450,6 +450,8 @@ namespace dawn_native {
 
         // TODO(cwallez@chromium.org): Check against the shader module that the correct color
         // attachment are set?
+
+        ComputeCacheKey();
     }
 
     RenderPipelineBase::RenderPipelineBase(DeviceBase* device, ObjectBase::ErrorTag tag)
@@ -559,185 +561,76 @@ namespace dawn_native {
         return attributesUsingVertexBuffer[slot];
     }
 
-    size_t RenderPipelineBase::HashFunc::operator()(const RenderPipelineBase* pipeline) const {
-        size_t hash = 0;
-
-        // Hash modules and layout
-        HashCombine(&hash, pipeline->GetLayout());
-        HashCombine(&hash, pipeline->mVertexModule.Get(), pipeline->mFragmentEntryPoint);
-        HashCombine(&hash, pipeline->mFragmentModule.Get(), pipeline->mFragmentEntryPoint);
-
-        // Hierarchically hash the attachment state.
-        // It contains the attachments set, texture formats, and sample count.
-        HashCombine(&hash, pipeline->mAttachmentState.Get());
-
-        // Hash attachments
-        for (uint32_t i : IterateBitSet(pipeline->mAttachmentState->GetColorAttachmentsMask())) {
-            const ColorStateDescriptor& desc = *pipeline->GetColorStateDescriptor(i);
-            HashCombine(&hash, desc.writeMask);
-            HashCombine(&hash, desc.colorBlend.operation, desc.colorBlend.srcFactor,
-                        desc.colorBlend.dstFactor);
-            HashCombine(&hash, desc.alphaBlend.operation, desc.alphaBlend.srcFactor,
-                        desc.alphaBlend.dstFactor);
+    void RenderPipelineBase::ComputeCacheKey() {
+        // The layout, modules and attachment state are deduplicated by the device so they are
+        // compared by address.
+        mCacheKey.Record(GetLayout());
+        mCacheKey.Record(mVertexModule.Get());
+        mCacheKey.Record(mVertexEntryPoint);
+        mCacheKey.Record(mFragmentModule.Get());
+        mCacheKey.Record(mFragmentEntryPoint);
+        mCacheKey.Record(mAttachmentState.Get());
+
+        // The attachment state contains the attachments set, texture formats, and sample count.
+        for (uint32_t i : IterateBitSet(mAttachmentState->GetColorAttachmentsMask())) {
+            ColorStateDescriptorCacheKey packed;
+            PackCacheKey(&packed, mColorStates[i]);
+            mCacheKey.RecordPacked(packed);
         }
 
-        if (pipeline->mAttachmentState->HasDepthStencilAttachment()) {
-            const DepthStencilStateDescriptor& desc = pipeline->mDepthStencilState;
-            HashCombine(&hash, desc.depthWriteEnabled, desc.depthCompare);
-            HashCombine(&hash, desc.stencilReadMask, desc.stencilWriteMask);
-            HashCombine(&hash, desc.stencilFront.compare, desc.stencilFront.failOp,
-                        desc.stencilFront.depthFailOp, desc.stencilFront.passOp);
-            HashCombine(&hash, desc.stencilBack.compare, desc.stencilBack.failOp,
-                        desc.stencilBack.depthFailOp, desc.stencilBack.passOp);
+        if (mAttachmentState->HasDepthStencilAttachment()) {
+            DepthStencilStateDescriptorCacheKey packed;
+            PackCacheKey(&packed, mDepthStencilState);
+            mCacheKey.RecordPacked(packed);
         }
 
-        // Hash vertex state
-        HashCombine(&hash, pipeline->mAttributeLocationsUsed);
-        for (uint32_t i : IterateBitSet(pipeline->mAttributeLocationsUsed)) {
-            const VertexAttributeInfo& desc = pipeline->GetAttribute(i);
-            HashCombine(&hash, desc.shaderLocation, desc.vertexBufferSlot, desc.offset,
-                        desc.format);
+        // Vertex state
+        mCacheKey.Record(mAttributeLocationsUsed);
+        for (uint32_t location : IterateBitSet(mAttributeLocationsUsed)) {
+            const VertexAttributeInfo& info = mAttributeInfos[location];
+            VertexAttributeDescriptor attribute;
+            attribute.format = info.format;
+            attribute.offset = info.offset;
+            attribute.shaderLocation = info.shaderLocation;
+
+            VertexAttributeDescriptorCacheKey packed;
+            PackCacheKey(&packed, attribute);
+            mCacheKey.RecordPacked(packed);
+            mCacheKey.Record(info.vertexBufferSlot);
         }
 
-        HashCombine(&hash, pipeline->mVertexBufferSlotsUsed);
-        for (uint32_t i : IterateBitSet(pipeline->mVertexBufferSlotsUsed)) {
-            const VertexBufferInfo& desc = pipeline->GetVertexBuffer(i);
-            HashCombine(&hash, desc.arrayStride, desc.stepMode);
+        mCacheKey.Record(mVertexBufferSlotsUsed);
+        for (uint32_t slot : IterateBitSet(mVertexBufferSlotsUsed)) {
+            mCacheKey.Record(mVertexBufferInfos[slot].arrayStride);
+            mCacheKey.Record(mVertexBufferInfos[slot].stepMode);
         }
 
-        HashCombine(&hash, pipeline->mVertexState.indexFormat);
+        mCacheKey.Record(mVertexState.indexFormat);
 
-        // Hash rasterization state
+        // Rasterization state
         {
-            const RasterizationStateDescriptor& desc = pipeline->mRasterizationState;
-            HashCombine(&hash, desc.frontFace, desc.cullMode);
-            HashCombine(&hash, desc.depthBias, desc.depthBiasSlopeScale, desc.depthBiasClamp);
+            ASSERT(!std::isnan(mRasterizationState.depthBiasSlopeScale));
+            ASSERT(!std::isnan(mRasterizationState.depthBiasClamp));
+            RasterizationStateDescriptorCacheKey packed;
+            PackCacheKey(&packed, mRasterizationState);
+            mCacheKey.RecordPacked(packed);
         }
 
-        // Hash other state
-        HashCombine(&hash, pipeline->mPrimitiveTopology, pipeline->mSampleMask,
-                    pipeline->mAlphaToCoverageEnabled);
+        // Other state
+        mCacheKey.Record(mPrimitiveTopology);
+        mCacheKey.Record(mSampleMask);
+        mCacheKey.Record(static_cast<uint32_t>(mAlphaToCoverageEnabled));
+
+        mCacheKey.Seal();
+    }
 
-        return hash;
+    size_t RenderPipelineBase::HashFunc::operator()(const RenderPipelineBase* pipeline) const {
+        return pipeline->mCacheKey.GetHash();
     }
 
     bool RenderPipelineBase::EqualityFunc::operator()(const RenderPipelineBase* a,
                                                       const RenderPipelineBase* b) const {
-        // Check modules and layout
-        if (a->GetLayout() != b->GetLayout() || a->mVertexModule.Get() != b->mVertexModule.Get() ||
-            a->mVertexEntryPoint != b->mVertexEntryPoint ||
-            a->mFragmentModule.Get() != b->mFragmentModule.Get() ||
-            a->mFragmentEntryPoint != b->mFragmentEntryPoint) {
-            return false;
-        }
-
-        // Check the attachment state.
-        // It contains the attachments set, texture formats, and sample count.
-        if (a->mAttachmentState.Get() != b->mAttachmentState.Get()) {
-            return false;
-        }
-
-        for (uint32_t i : IterateBitSet(a->mAttachmentState->GetColorAttachmentsMask())) {
-            const ColorStateDescriptor& descA = *a->GetColorStateDescriptor(i);
-            const ColorStateDescriptor& descB = *b->GetColorStateDescriptor(i);
-            if (descA.writeMask != descB.writeMask) {
-                return false;
-            }
-            if (descA.colorBlend.operation != descB.colorBlend.operation ||
-                descA.colorBlend.srcFactor != descB.colorBlend.srcFactor ||
-                descA.colorBlend.dstFactor != descB.colorBlend.dstFactor) {
-                return false;
-            }
-            if (descA.alphaBlend.operation != descB.alphaBlend.operation ||
-                descA.alphaBlend.srcFactor != descB.alphaBlend.srcFactor ||
-                descA.alphaBlend.dstFactor != descB.alphaBlend.dstFactor) {
-                return false;
-            }
-        }
-
-        if (a->mAttachmentState->HasDepthStencilAttachment()) {
-            const DepthStencilStateDescriptor& descA = a->mDepthStencilState;
-            const DepthStencilStateDescriptor& descB = b->mDepthStencilState;
-            if (descA.depthWriteEnabled != descB.depthWriteEnabled ||
-                descA.depthCompare != descB.depthCompare) {
-                return false;
-            }
-            if (descA.stencilReadMask != descB.stencilReadMask ||
-                descA.stencilWriteMask != descB.stencilWriteMask) {
-                return false;
-            }
-            if (descA.stencilFront.compare != descB.stencilFront.compare ||
-                descA.stencilFront.failOp != descB.stencilFront.failOp ||
-                descA.stencilFront.depthFailOp != descB.stencilFront.depthFailOp ||
-                descA.stencilFront.passOp != descB.stencilFront.passOp) {
-                return false;
-            }
-            if (descA.stencilBack.compare != descB.stencilBack.compare ||
-                descA.stencilBack.failOp != descB.stencilBack.failOp ||
-                descA.stencilBack.depthFailOp != descB.stencilBack.depthFailOp ||
-                descA.stencilBack.passOp != descB.stencilBack.passOp) {
-                return false;
-            }
-        }
-
-        // Check vertex state
-        if (a->mAttributeLocationsUsed != b->mAttributeLocationsUsed) {
-            return false;
-        }
-
-        for (uint32_t i : IterateBitSet(a->mAttributeLocationsUsed)) {
-            const VertexAttributeInfo& descA = a->GetAttribute(i);
-            const VertexAttributeInfo& descB = b->GetAttribute(i);
-            if (descA.shaderLocation != descB.shaderLocation ||
-                descA.vertexBufferSlot != descB.vertexBufferSlot || descA.offset != descB.offset ||
-                descA.format != descB.format) {
-                return false;
-            }
-        }
-
-        if (a->mVertexBufferSlotsUsed != b->mVertexBufferSlotsUsed) {
-            return false;
-        }
-
-        for (uint32_t i : IterateBitSet(a->mVertexBufferSlotsUsed)) {
-            const VertexBufferInfo& descA = a->GetVertexBuffer(i);
-            const VertexBufferInfo& descB = b->GetVertexBuffer(i);
-            if (descA.arrayStride != descB.arrayStride || descA.stepMode != descB.stepMode) {
-                return false;
-            }
-        }
-
-        if (a->mVertexState.indexFormat != b->mVertexState.indexFormat) {
-            return false;
-        }
-
-        // Check rasterization state
-        {
-            const RasterizationStateDescriptor& descA = a->mRasterizationState;
-            const RasterizationStateDescriptor& descB = b->mRasterizationState;
-            if (descA.frontFace != descB.frontFace || descA.cullMode != descB.cullMode) {
-                return false;
-            }
-
-            ASSERT(!std::isnan(descA.depthBiasSlopeScale));
-            ASSERT(!std::isnan(descB.depthBiasSlopeScale));
-            ASSERT(!std::isnan(descA.depthBiasClamp));
-            ASSERT(!std::isnan(descB.depthBiasClamp));
-
-            if (descA.depthBias != descB.depthBias ||
-                descA.depthBiasSlopeScale != descB.depthBiasSlopeScale ||
-                descA.depthBiasClamp != descB.depthBiasClamp) {
-                return false;
-            }
-        }
-
-        // Check other state
-        if (a->mPrimitiveTopology != b->mPrimitiveTopology || a->mSampleMask != b->mSampleMask ||
-            a->mAlphaToCoverageEnabled != b->mAlphaToCoverageEnabled) {
-            return false;
-        }
-
-        return true;
+        return a->mCacheKey == b->mCacheKey;
     }
 
 }  // namespace dawn_native
@@ -16,6 +16,7 @@
 #define DAWNNATIVE_RENDERPIPELINE_H_
 
 #include "dawn_native/AttachmentState.h"
+#include "dawn_native/CacheKey.h"
 #include "dawn_native/Pipeline.h"
 
 #include "dawn_native/dawn_platform.h"
@@ -94,6 +95,9 @@ namespace dawn_native {
       private:
         RenderPipelineBase(DeviceBase* device, ObjectBase::ErrorTag tag);
 
+        // Called by the constructor once the state is known.
+        void ComputeCacheKey();
+
         // Vertex state
         VertexStateDescriptor mVertexState;
         std::bitset<kMaxVertexAttributes> mAttributeLocationsUsed;
@@ -118,6 +122,8 @@ namespace dawn_native {
         std::string mVertexEntryPoint;
         Ref<ShaderModuleBase> mFragmentModule;
         std::string mFragmentEntryPoint;
+
+        CacheKey mCacheKey;
     };
 
 }  // namespace dawn_native
@@ -14,7 +14,7 @@
 
 #include "dawn_native/Sampler.h"
 
-#include "common/HashUtils.h"
+#include "dawn_native/CacheKeys_autogen.h"
 #include "dawn_native/Device.h"
 #include "dawn_native/ValidationUtils_autogen.h"
 
@@ -53,16 +53,15 @@ namespace dawn_native {
     // SamplerBase
 
     SamplerBase::SamplerBase(DeviceBase* device, const SamplerDescriptor* descriptor)
-        : CachedObject(device),
-          mAddressModeU(descriptor->addressModeU),
-          mAddressModeV(descriptor->addressModeV),
-          mAddressModeW(descriptor->addressModeW),
-          mMagFilter(descriptor->magFilter),
-          mMinFilter(descriptor->minFilter),
-          mMipmapFilter(descriptor->mipmapFilter),
-          mLodMinClamp(descriptor->lodMinClamp),
-          mLodMaxClamp(descriptor->lodMaxClamp),
-          mCompareFunction(descriptor->compare) {
+        : CachedObject(device) {
+        // Validation rejects NaN LOD clamps, which would make the keys of equal samplers differ.
+        ASSERT(!std::isnan(descriptor->lodMinClamp));
+        ASSERT(!std::isnan(descriptor->lodMaxClamp));
+
+        SamplerDescriptorCacheKey packed;
+        PackCacheKey(&packed, *descriptor);
+        mCacheKey.RecordPacked(packed);
+        mCacheKey.Seal();
     }
 
     SamplerBase::SamplerBase(DeviceBase* device, ObjectBase::ErrorTag tag)
@@ -81,36 +80,11 @@ namespace dawn_native {
     }
 
     size_t SamplerBase::HashFunc::operator()(const SamplerBase* module) const {
-        size_t hash = 0;
-
-        HashCombine(&hash, module->mAddressModeU);
-        HashCombine(&hash, module->mAddressModeV);
-        HashCombine(&hash, module->mAddressModeW);
-        HashCombine(&hash, module->mMagFilter);
-        HashCombine(&hash, module->mMinFilter);
-        HashCombine(&hash, module->mMipmapFilter);
-        HashCombine(&hash, module->mLodMinClamp);
-        HashCombine(&hash, module->mLodMaxClamp);
-        HashCombine(&hash, module->mCompareFunction);
-
-        return hash;
+        return module->mCacheKey.GetHash();
     }
 
     bool SamplerBase::EqualityFunc::operator()(const SamplerBase* a, const SamplerBase* b) const {
-        if (a == b) {
-            return true;
-        }
-
-        ASSERT(!std::isnan(a->mLodMinClamp));
-        ASSERT(!std::isnan(b->mLodMinClamp));
-        ASSERT(!std::isnan(a->mLodMaxClamp));
-        ASSERT(!std::isnan(b->mLodMaxClamp));
-
-        return a->mAddressModeU == b->mAddressModeU && a->mAddressModeV == b->mAddressModeV &&
-               a->mAddressModeW == b->mAddressModeW && a->mMagFilter == b->mMagFilter &&
-               a->mMinFilter == b->mMinFilter && a->mMipmapFilter == b->mMipmapFilter &&
-               a->mLodMinClamp == b->mLodMinClamp && a->mLodMaxClamp == b->mLodMaxClamp &&
-               a->mCompareFunction == b->mCompareFunction;
+        return a == b || a->mCacheKey == b->mCacheKey;
     }
 
 }  // namespace dawn_native
@@ -15,6 +15,7 @@
 #ifndef DAWNNATIVE_SAMPLER_H_
 #define DAWNNATIVE_SAMPLER_H_
 
+#include "dawn_native/CacheKey.h"
 #include "dawn_native/CachedObject.h"
 #include "dawn_native/Error.h"
 
@@ -44,16 +45,7 @@ namespace dawn_native {
       private:
         SamplerBase(DeviceBase* device, ObjectBase::ErrorTag tag);
 
-        // TODO(cwallez@chromium.org): Store a crypto hash of the items instead?
-        wgpu::AddressMode mAddressModeU;
-        wgpu::AddressMode mAddressModeV;
-        wgpu::AddressMode mAddressModeW;
-        wgpu::FilterMode mMagFilter;
-        wgpu::FilterMode mMinFilter;
-        wgpu::FilterMode mMipmapFilter;
-        float mLodMinClamp;
-        float mLodMaxClamp;
-        wgpu::CompareFunction mCompareFunction;
+        CacheKey mCacheKey;
     };
 
 }  // namespace dawn_native
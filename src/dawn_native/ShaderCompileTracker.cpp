@@ -0,0 +1,133 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn_native/ShaderCompileTracker.h"
+
+#include "common/Assert.h"
+#include "dawn_native/Device.h"
+#include "dawn_native/ShaderModule.h"
+#include "dawn_platform/DawnPlatform.h"
+#include "dawn_platform/tracing/TraceEvent.h"
+
+#include <algorithm>
+
+namespace dawn_native {
+
+    namespace {
+
+        // The names of the trace events must have application lifetime.
+        constexpr const char* kPhaseTraceNames[] = {
+            "ShaderCompile::Validation",         "ShaderCompile::Reflection",
+            "ShaderCompile::Translation",        "ShaderCompile::BackendCompilation",
+            "ShaderCompile::PipelineCreation",
+        };
+        static_assert(sizeof(kPhaseTraceNames) / sizeof(kPhaseTraceNames[0]) ==
+                          static_cast<size_t>(ShaderCompilePhase::EnumCount),
+                      "");
+
+    }  // anonymous namespace
+
+    // ShaderCompileTracker
+
+    void ShaderCompileTracker::Record(ShaderCompilePhase phase,
+                                      const ShaderModuleContent* const* modules,
+                                      uint32_t moduleCount,
+                                      double milliseconds) {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        ShaderCompilePhaseStatistics& phaseStatistics = mPhases[static_cast<size_t>(phase)];
+        phaseStatistics.count++;
+        phaseStatistics.totalMilliseconds += milliseconds;
+        phaseStatistics.maxMilliseconds = std::max(phaseStatistics.maxMilliseconds, milliseconds);
+
+        // The creation of a pipeline is attributed to each of its modules since it depends on
+        // all of them.
+        for (uint32_t i = 0; i < moduleCount; ++i) {
+            const ShaderModuleContent* module = modules[i];
+            ModuleStatistics& moduleStatistics = mModules[module->GetContentHash()];
+            moduleStatistics.codeSize = module->GetCodeSize();
+            moduleStatistics.totalMilliseconds += milliseconds;
+        }
+    }
+
+    ShaderCompileStatistics ShaderCompileTracker::GetStatistics() {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        ShaderCompileStatistics statistics;
+        statistics.validation = mPhases[static_cast<size_t>(ShaderCompilePhase::Validation)];
+        statistics.reflection = mPhases[static_cast<size_t>(ShaderCompilePhase::Reflection)];
+        statistics.translation = mPhases[static_cast<size_t>(ShaderCompilePhase::Translation)];
+        statistics.backendCompilation =
+            mPhases[static_cast<size_t>(ShaderCompilePhase::BackendCompilation)];
+        statistics.pipelineCreation =
+            mPhases[static_cast<size_t>(ShaderCompilePhase::PipelineCreation)];
+
+        statistics.modules.reserve(mModules.size());
+        for (const auto& it : mModules) {
+            ShaderModuleCompileStatistics module;
+            module.contentHash = it.first;
+            module.codeSize = it.second.codeSize;
+            module.totalMilliseconds = it.second.totalMilliseconds;
+            statistics.modules.push_back(module);
+        }
+        std::sort(statistics.modules.begin(), statistics.modules.end(),
+                  [](const ShaderModuleCompileStatistics& a,
+                     const ShaderModuleCompileStatistics& b) {
+                      return a.totalMilliseconds > b.totalMilliseconds;
+                  });
+
+        return statistics;
+    }
+
+    // ScopedShaderCompileTimer
+
+    ScopedShaderCompileTimer::ScopedShaderCompileTimer(
+        DeviceBase* device,
+        ShaderCompilePhase phase,
+        std::initializer_list<const ShaderModuleContent*> modules)
+        : mDevice(device),
+          mPhase(phase),
+          mRecordStatistics(device->IsToggleEnabled(Toggle::RecordShaderCompileStatistics)) {
+        ASSERT(modules.size() <= kNumStages);
+        // Render pipelines don't always have a fragment module.
+        for (const ShaderModuleContent* module : modules) {
+            if (module != nullptr) {
+                mModules[mModuleCount++] = module;
+            }
+        }
+        ASSERT(mModuleCount > 0);
+
+        TRACE_EVENT_BEGIN2(mDevice->GetPlatform(), General,
+                           kPhaseTraceNames[static_cast<size_t>(mPhase)], "moduleHash",
+                           static_cast<unsigned long long>(mModules[0]->GetContentHash()),
+                           "codeSize", mModules[0]->GetCodeSize());
+
+        if (mRecordStatistics) {
+            mStart = std::chrono::steady_clock::now();
+        }
+    }
+
+    ScopedShaderCompileTimer::~ScopedShaderCompileTimer() {
+        TRACE_EVENT_END0(mDevice->GetPlatform(), General,
+                         kPhaseTraceNames[static_cast<size_t>(mPhase)]);
+
+        if (mRecordStatistics) {
+            std::chrono::duration<double, std::milli> duration =
+                std::chrono::steady_clock::now() - mStart;
+            mDevice->GetShaderCompileTracker()->Record(mPhase, mModules.data(), mModuleCount,
+                                                       duration.count());
+        }
+    }
+
+}  // namespace dawn_native
@@ -0,0 +1,94 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_SHADERCOMPILETRACKER_H_
+#define DAWNNATIVE_SHADERCOMPILETRACKER_H_
+
+#include "dawn_native/DawnNative.h"
+#include "dawn_native/Forward.h"
+#include "dawn_native/PerStage.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <mutex>
+#include <unordered_map>
+
+namespace dawn_native {
+
+    class ShaderModuleContent;
+
+    enum class ShaderCompilePhase {
+        Validation,
+        Reflection,
+        Translation,
+        BackendCompilation,
+        PipelineCreation,
+
+        EnumCount,
+    };
+
+    // ShaderCompileTracker aggregates the time spent in each of the phases of the compilation of
+    // shaders, and per shader module so that the modules that dominate the loading time can be
+    // found. Phases can run on the worker threads creating shader modules in parallel.
+    class ShaderCompileTracker {
+      public:
+        void Record(ShaderCompilePhase phase,
+                    const ShaderModuleContent* const* modules,
+                    uint32_t moduleCount,
+                    double milliseconds);
+
+        ShaderCompileStatistics GetStatistics();
+
+      private:
+        struct ModuleStatistics {
+            uint32_t codeSize = 0;
+            double totalMilliseconds = 0;
+        };
+
+        std::mutex mMutex;
+        std::array<ShaderCompilePhaseStatistics,
+                   static_cast<size_t>(ShaderCompilePhase::EnumCount)>
+            mPhases;
+        // Keyed by the hash of the content so that modules created again add up.
+        std::unordered_map<size_t, ModuleStatistics> mModules;
+    };
+
+    // Times a phase of the compilation of shaders for the ShaderCompileTracker of the device and
+    // records a trace event for it. The events are tagged with the hash and size of the code of the
+    // first module, which is the vertex or compute module for pipelines. The phase is only timed
+    // when the RecordShaderCompileStatistics toggle is enabled.
+    class ScopedShaderCompileTimer {
+      public:
+        ScopedShaderCompileTimer(DeviceBase* device,
+                                 ShaderCompilePhase phase,
+                                 std::initializer_list<const ShaderModuleContent*> modules);
+        ~ScopedShaderCompileTimer();
+
+        ScopedShaderCompileTimer(const ScopedShaderCompileTimer&) = delete;
+        ScopedShaderCompileTimer& operator=(const ScopedShaderCompileTimer&) = delete;
+
+      private:
+        DeviceBase* mDevice;
+        ShaderCompilePhase mPhase;
+        std::array<const ShaderModuleContent*, kNumStages> mModules;
+        uint32_t mModuleCount = 0;
+        bool mRecordStatistics;
+        std::chrono::steady_clock::time_point mStart;
+    };
+
+}  // namespace dawn_native
+
+#endif  // DAWNNATIVE_SHADERCOMPILETRACKER_H_
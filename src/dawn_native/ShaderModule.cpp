@@ -19,15 +19,22 @@
 #include "dawn_native/Device.h"
 #include "dawn_native/Pipeline.h"
 #include "dawn_native/PipelineLayout.h"
+#include "dawn_native/ShaderCompileTracker.h"
+#include "dawn_native/SpirvReflector.h"
 
 #include <spirv-tools/libspirv.hpp>
 #include <spirv_cross.hpp>
 
+#include <atomic>
+#include <cstring>
 #include <sstream>
 
 namespace dawn_native {
 
     namespace {
+
+        std::atomic<uint64_t> sNextShaderModuleId(1);
+
         Format::Type SpirvCrossBaseTypeToFormatType(spirv_cross::SPIRType::BaseType spirvBaseType) {
             switch (spirvBaseType) {
                 case spirv_cross::SPIRType::Float:
@@ -285,6 +292,10 @@ namespace dawn_native {
             return DAWN_VALIDATION_ERROR("nextInChain must be nullptr");
         }
 
+        return {};
+    }
+
+    MaybeError ValidateSpirv(const uint32_t* code, uint32_t codeSize) {
         spvtools::SpirvTools spirvTools(SPV_ENV_VULKAN_1_1);
 
         std::ostringstream errorStream;
@@ -311,17 +322,57 @@ namespace dawn_native {
             }
         });
 
-        if (!spirvTools.Validate(descriptor->code, descriptor->codeSize)) {
-            return DAWN_VALIDATION_ERROR(errorStream.str().c_str());
+        if (!spirvTools.Validate(code, codeSize)) {
+            return DAWN_MAKE_ERROR_FROM_STRING(InternalErrorType::Validation, errorStream.str());
         }
 
         return {};
-    }  // namespace
+    }
+
+    // ShaderModuleContent
+
+    ShaderModuleContent::ShaderModuleContent(const ShaderModuleDescriptor* descriptor)
+        : mCode(descriptor->code), mCodeSize(descriptor->codeSize) {
+        mContentHash = Hash(mCodeSize);
+        for (uint32_t i = 0; i < mCodeSize; ++i) {
+            HashCombine(&mContentHash, mCode[i]);
+        }
+    }
+
+    void ShaderModuleContent::CopyCode() {
+        mOwnedCode.assign(mCode, mCode + mCodeSize);
+        mCode = mOwnedCode.data();
+    }
+
+    size_t ShaderModuleContent::GetContentHash() const {
+        return mContentHash;
+    }
+
+    const uint32_t* ShaderModuleContent::GetCode() const {
+        return mCode;
+    }
+
+    uint32_t ShaderModuleContent::GetCodeSize() const {
+        return mCodeSize;
+    }
+
+    size_t ShaderModuleContent::HashFunc::operator()(const ShaderModuleContent* content) const {
+        return content->mContentHash;
+    }
+
+    bool ShaderModuleContent::EqualityFunc::operator()(const ShaderModuleContent* a,
+                                                       const ShaderModuleContent* b) const {
+        return a->mContentHash == b->mContentHash && a->mCodeSize == b->mCodeSize &&
+               memcmp(a->mCode, b->mCode, a->mCodeSize * sizeof(uint32_t)) == 0;
+    }
 
     // ShaderModuleBase
 
     ShaderModuleBase::ShaderModuleBase(DeviceBase* device, const ShaderModuleDescriptor* descriptor)
-        : CachedObject(device), mCode(descriptor->code, descriptor->code + descriptor->codeSize) {
+        : ShaderModuleContent(descriptor),
+          CachedObject(device),
+          mUniqueId(sNextShaderModuleId++) {
+        CopyCode();
         mFragmentOutputFormatBaseTypes.fill(Format::Other);
         if (GetDevice()->IsToggleEnabled(Toggle::UseSpvcParser)) {
             mSpvcContext.SetUseSpvcParser(true);
@@ -343,12 +394,21 @@ namespace dawn_native {
         return new ShaderModuleBase(device, ObjectBase::kError);
     }
 
-    MaybeError ShaderModuleBase::ExtractSpirvInfo(const spirv_cross::Compiler& compiler) {
+    MaybeError ShaderModuleBase::ExtractSpirvInfo() {
         ASSERT(!IsError());
+        ScopedShaderCompileTimer timer(GetDevice(), ShaderCompilePhase::Reflection, {this});
+
         if (GetDevice()->IsToggleEnabled(Toggle::UseSpvc)) {
             DAWN_TRY(ExtractSpirvInfoWithSpvc());
-        } else {
+        } else if (GetDevice()->IsToggleEnabled(Toggle::UseSpirvCrossReflection)) {
+            spirv_cross::Compiler compiler(GetCode(), GetCodeSize());
             DAWN_TRY(ExtractSpirvInfoWithSpirvCross(compiler));
+        } else {
+            DAWN_TRY(ExtractSpirvInfoWithReflector());
+        }
+
+        for (uint32_t group = 0; group < kMaxBindGroups; ++group) {
+            mUsedBindGroups.set(group, !mBindingInfo[group].empty());
         }
         return {};
     }
@@ -533,82 +593,156 @@ namespace dawn_native {
                 return DAWN_VALIDATION_ERROR("Unexpected shader execution model");
         }
 
-        if (resources.push_constant_buffers.size() > 0) {
-            return DAWN_VALIDATION_ERROR("Push constants aren't supported.");
+        // Convert the spirv_cross resources to the variables of the SpirvReflector so that both
+        // are validated by PopulateSpirvInfo.
+        using VariableKind = SpirvReflector::VariableKind;
+        std::vector<SpirvReflector::Variable> variables;
+        auto AddVariables = [&compiler, &variables](
+                                const spirv_cross::SmallVector<spirv_cross::Resource>& resources,
+                                VariableKind kind) {
+            for (const auto& resource : resources) {
+                const spirv_cross::Bitset& decorations =
+                    compiler.get_decoration_bitset(resource.id);
+
+                SpirvReflector::Variable variable;
+                variable.kind = kind;
+                variable.id = resource.id;
+                variable.baseTypeId = resource.base_type_id;
+                variable.hasBinding = decorations.get(spv::DecorationBinding);
+                variable.binding = compiler.get_decoration(resource.id, spv::DecorationBinding);
+                variable.hasDescriptorSet = decorations.get(spv::DecorationDescriptorSet);
+                variable.descriptorSet =
+                    compiler.get_decoration(resource.id, spv::DecorationDescriptorSet);
+                variable.hasLocation = decorations.get(spv::DecorationLocation);
+                variable.location = compiler.get_decoration(resource.id, spv::DecorationLocation);
+
+                const spirv_cross::SPIRType& baseType = compiler.get_type(resource.base_type_id);
+                switch (kind) {
+                    case VariableKind::StorageBuffer:
+                        variable.nonWritable = compiler.get_buffer_block_flags(resource.id)
+                                                   .get(spv::DecorationNonWritable);
+                        break;
+                    case VariableKind::SampledTexture:
+                    case VariableKind::StorageTexture:
+                        variable.nonWritable = decorations.get(spv::DecorationNonWritable);
+                        variable.nonReadable = decorations.get(spv::DecorationNonReadable);
+                        variable.dimension = baseType.image.dim;
+                        variable.arrayed = baseType.image.arrayed;
+                        variable.multisampled = baseType.image.ms;
+                        variable.imageFormat = baseType.image.format;
+                        if (kind == VariableKind::SampledTexture) {
+                            variable.componentType = SpirvCrossBaseTypeToFormatType(
+                                compiler.get_type(baseType.image.type).basetype);
+                        }
+                        break;
+                    default:
+                        break;
+                }
+                variables.push_back(variable);
+            }
+        };
+
+        AddVariables(resources.push_constant_buffers, VariableKind::PushConstant);
+        AddVariables(resources.uniform_buffers, VariableKind::UniformBuffer);
+        AddVariables(resources.separate_images, VariableKind::SampledTexture);
+        AddVariables(resources.separate_samplers, VariableKind::Sampler);
+        AddVariables(resources.storage_buffers, VariableKind::StorageBuffer);
+        AddVariables(resources.storage_images, VariableKind::StorageTexture);
+        AddVariables(resources.stage_inputs, VariableKind::StageInput);
+        AddVariables(resources.stage_outputs, VariableKind::StageOutput);
+
+        // Only the type of fragment outputs is used, other stage variables can be structs.
+        if (mExecutionModel == SingleShaderStage::Fragment) {
+            for (SpirvReflector::Variable& variable : variables) {
+                if (variable.kind == VariableKind::StageOutput) {
+                    variable.componentType = SpirvCrossBaseTypeToFormatType(
+                        compiler.get_type(variable.baseTypeId).basetype);
+                }
+            }
         }
 
-        // Fill in bindingInfo with the SPIRV bindings
-        auto ExtractResourcesBinding =
-            [this](const spirv_cross::SmallVector<spirv_cross::Resource>& resources,
-                   const spirv_cross::Compiler& compiler,
-                   wgpu::BindingType bindingType) -> MaybeError {
-            for (const auto& resource : resources) {
-                if (!compiler.get_decoration_bitset(resource.id).get(spv::DecorationBinding)) {
-                    return DAWN_VALIDATION_ERROR("No Binding decoration set for resource");
+        return PopulateSpirvInfo(variables);
+    }
+
+    MaybeError ShaderModuleBase::ExtractSpirvInfoWithReflector() {
+        SpirvReflector reflector;
+        DAWN_TRY(reflector.Reflect(GetCode(), GetCodeSize()));
+        mExecutionModel = reflector.GetExecutionModel();
+        return PopulateSpirvInfo(reflector.GetVariables());
+    }
+
+    MaybeError ShaderModuleBase::PopulateSpirvInfo(
+        const std::vector<SpirvReflector::Variable>& variables) {
+        using VariableKind = SpirvReflector::VariableKind;
+
+        for (const SpirvReflector::Variable& variable : variables) {
+            if (variable.kind == VariableKind::PushConstant) {
+                return DAWN_VALIDATION_ERROR("Push constants aren't supported.");
+            }
+        }
+
+        // Fill in bindingInfo with the SPIRV bindings, one kind of resource after the other.
+        auto ExtractResourcesBinding = [this, &variables](VariableKind kind) -> MaybeError {
+            for (const SpirvReflector::Variable& variable : variables) {
+                if (variable.kind != kind) {
+                    continue;
                 }
 
-                if (!compiler.get_decoration_bitset(resource.id)
-                         .get(spv::DecorationDescriptorSet)) {
+                if (!variable.hasBinding) {
+                    return DAWN_VALIDATION_ERROR("No Binding decoration set for resource");
+                }
+                if (!variable.hasDescriptorSet) {
                     return DAWN_VALIDATION_ERROR("No Descriptor Decoration set for resource");
                 }
 
-                BindingNumber bindingNumber(
-                    compiler.get_decoration(resource.id, spv::DecorationBinding));
-                uint32_t set = compiler.get_decoration(resource.id, spv::DecorationDescriptorSet);
-
-                if (set >= kMaxBindGroups) {
+                if (variable.descriptorSet >= kMaxBindGroups) {
                     return DAWN_VALIDATION_ERROR("Bind group index over limits in the SPIRV");
                 }
 
-                const auto& it = mBindingInfo[set].emplace(bindingNumber, ShaderBindingInfo{});
+                const auto& it = mBindingInfo[variable.descriptorSet].emplace(
+                    BindingNumber(variable.binding), ShaderBindingInfo{});
                 if (!it.second) {
                     return DAWN_VALIDATION_ERROR("Shader has duplicate bindings");
                 }
 
                 ShaderBindingInfo* info = &it.first->second;
-                info->id = resource.id;
-                info->base_type_id = resource.base_type_id;
-
-                switch (bindingType) {
-                    case wgpu::BindingType::SampledTexture: {
-                        spirv_cross::SPIRType::ImageType imageType =
-                            compiler.get_type(info->base_type_id).image;
-                        spirv_cross::SPIRType::BaseType textureComponentType =
-                            compiler.get_type(imageType.type).basetype;
+                info->id = variable.id;
+                info->base_type_id = variable.baseTypeId;
 
-                        info->multisampled = imageType.ms;
+                switch (kind) {
+                    case VariableKind::UniformBuffer:
+                        info->type = wgpu::BindingType::UniformBuffer;
+                        break;
+                    case VariableKind::Sampler:
+                        info->type = wgpu::BindingType::Sampler;
+                        break;
+                    case VariableKind::SampledTexture:
+                        info->type = wgpu::BindingType::SampledTexture;
+                        info->multisampled = variable.multisampled;
                         info->textureDimension =
-                            SpirvDimToTextureViewDimension(imageType.dim, imageType.arrayed);
-                        info->textureComponentType =
-                            SpirvCrossBaseTypeToFormatType(textureComponentType);
-                        info->type = bindingType;
+                            SpirvDimToTextureViewDimension(variable.dimension, variable.arrayed);
+                        info->textureComponentType = variable.componentType;
                         break;
-                    }
-                    case wgpu::BindingType::StorageBuffer: {
+                    case VariableKind::StorageBuffer:
                         // Differentiate between readonly storage bindings and writable ones
                         // based on the NonWritable decoration
-                        spirv_cross::Bitset flags = compiler.get_buffer_block_flags(resource.id);
-                        if (flags.get(spv::DecorationNonWritable)) {
+                        if (variable.nonWritable) {
                             info->type = wgpu::BindingType::ReadonlyStorageBuffer;
                         } else {
                             info->type = wgpu::BindingType::StorageBuffer;
                         }
                         break;
-                    }
-                    case wgpu::BindingType::StorageTexture: {
-                        spirv_cross::Bitset flags = compiler.get_decoration_bitset(resource.id);
-                        if (flags.get(spv::DecorationNonReadable)) {
+                    case VariableKind::StorageTexture: {
+                        if (variable.nonReadable) {
                             info->type = wgpu::BindingType::WriteonlyStorageTexture;
-                        } else if (flags.get(spv::DecorationNonWritable)) {
+                        } else if (variable.nonWritable) {
                             info->type = wgpu::BindingType::ReadonlyStorageTexture;
                         } else {
                             info->type = wgpu::BindingType::StorageTexture;
                         }
 
-                        spirv_cross::SPIRType::ImageType imageType =
-                            compiler.get_type(info->base_type_id).image;
                         wgpu::TextureFormat storageTextureFormat =
-                            ToWGPUTextureFormat(imageType.format);
+                            ToWGPUTextureFormat(variable.imageFormat);
                         if (storageTextureFormat == wgpu::TextureFormat::Undefined) {
                             return DAWN_VALIDATION_ERROR(
                                 "Invalid image format declaration on storage image");
@@ -619,50 +753,45 @@ namespace dawn_native {
                             return DAWN_VALIDATION_ERROR(
                                 "The storage texture format is not supported");
                         }
-                        info->multisampled = imageType.ms;
+                        info->multisampled = variable.multisampled;
                         info->storageTextureFormat = storageTextureFormat;
                         info->textureDimension =
-                            SpirvDimToTextureViewDimension(imageType.dim, imageType.arrayed);
+                            SpirvDimToTextureViewDimension(variable.dimension, variable.arrayed);
                         break;
                     }
                     default:
-                        info->type = bindingType;
+                        UNREACHABLE();
                 }
             }
             return {};
         };
 
-        DAWN_TRY(ExtractResourcesBinding(resources.uniform_buffers, compiler,
-                                         wgpu::BindingType::UniformBuffer));
-        DAWN_TRY(ExtractResourcesBinding(resources.separate_images, compiler,
-                                         wgpu::BindingType::SampledTexture));
-        DAWN_TRY(ExtractResourcesBinding(resources.separate_samplers, compiler,
-                                         wgpu::BindingType::Sampler));
-        DAWN_TRY(ExtractResourcesBinding(resources.storage_buffers, compiler,
-                                         wgpu::BindingType::StorageBuffer));
-        DAWN_TRY(ExtractResourcesBinding(resources.storage_images, compiler,
-                                         wgpu::BindingType::StorageTexture));
+        DAWN_TRY(ExtractResourcesBinding(VariableKind::UniformBuffer));
+        DAWN_TRY(ExtractResourcesBinding(VariableKind::SampledTexture));
+        DAWN_TRY(ExtractResourcesBinding(VariableKind::Sampler));
+        DAWN_TRY(ExtractResourcesBinding(VariableKind::StorageBuffer));
+        DAWN_TRY(ExtractResourcesBinding(VariableKind::StorageTexture));
 
         // Extract the vertex attributes
         if (mExecutionModel == SingleShaderStage::Vertex) {
-            for (const auto& attrib : resources.stage_inputs) {
-                if (!(compiler.get_decoration_bitset(attrib.id).get(spv::DecorationLocation))) {
-                    return DAWN_VALIDATION_ERROR(
-                        "Unable to find Location decoration for Vertex input");
-                }
-                uint32_t location = compiler.get_decoration(attrib.id, spv::DecorationLocation);
-
-                if (location >= kMaxVertexAttributes) {
-                    return DAWN_VALIDATION_ERROR("Attribute location over limits in the SPIRV");
+            for (const SpirvReflector::Variable& variable : variables) {
+                if (variable.kind == VariableKind::StageInput) {
+                    if (!variable.hasLocation) {
+                        return DAWN_VALIDATION_ERROR(
+                            "Unable to find Location decoration for Vertex input");
+                    }
+                    if (variable.location >= kMaxVertexAttributes) {
+                        return DAWN_VALIDATION_ERROR(
+                            "Attribute location over limits in the SPIRV");
+                    }
+                    mUsedVertexAttributes.set(variable.location);
                 }
-
-                mUsedVertexAttributes.set(location);
             }
 
             // Without a location qualifier on vertex outputs, spirv_cross::CompilerMSL gives
             // them all the location 0, causing a compile error.
-            for (const auto& attrib : resources.stage_outputs) {
-                if (!compiler.get_decoration_bitset(attrib.id).get(spv::DecorationLocation)) {
+            for (const SpirvReflector::Variable& variable : variables) {
+                if (variable.kind == VariableKind::StageOutput && !variable.hasLocation) {
                     return DAWN_VALIDATION_ERROR("Need location qualifier on vertex output");
                 }
             }
@@ -671,33 +800,28 @@ namespace dawn_native {
         if (mExecutionModel == SingleShaderStage::Fragment) {
             // Without a location qualifier on vertex inputs, spirv_cross::CompilerMSL gives
             // them all the location 0, causing a compile error.
-            for (const auto& attrib : resources.stage_inputs) {
-                if (!compiler.get_decoration_bitset(attrib.id).get(spv::DecorationLocation)) {
+            for (const SpirvReflector::Variable& variable : variables) {
+                if (variable.kind == VariableKind::StageInput && !variable.hasLocation) {
                     return DAWN_VALIDATION_ERROR("Need location qualifier on fragment input");
                 }
             }
 
-            for (const auto& fragmentOutput : resources.stage_outputs) {
-                if (!compiler.get_decoration_bitset(fragmentOutput.id)
-                         .get(spv::DecorationLocation)) {
+            for (const SpirvReflector::Variable& variable : variables) {
+                if (variable.kind != VariableKind::StageOutput) {
+                    continue;
+                }
+                if (!variable.hasLocation) {
                     return DAWN_VALIDATION_ERROR(
                         "Unable to find Location decoration for Fragment output");
                 }
-                uint32_t location =
-                    compiler.get_decoration(fragmentOutput.id, spv::DecorationLocation);
-                if (location >= kMaxColorAttachments) {
+                if (variable.location >= kMaxColorAttachments) {
                     return DAWN_VALIDATION_ERROR(
                         "Fragment output location over limits in the SPIRV");
                 }
-
-                spirv_cross::SPIRType::BaseType shaderFragmentOutputBaseType =
-                    compiler.get_type(fragmentOutput.base_type_id).basetype;
-                Format::Type formatType =
-                    SpirvCrossBaseTypeToFormatType(shaderFragmentOutputBaseType);
-                if (formatType == Format::Type::Other) {
+                if (variable.componentType == Format::Type::Other) {
                     return DAWN_VALIDATION_ERROR("Unexpected Fragment output type");
-                };
-                mFragmentOutputFormatBaseTypes[location] = formatType;
+                }
+                mFragmentOutputFormatBaseTypes[variable.location] = variable.componentType;
             }
         }
         return {};
@@ -733,13 +857,7 @@ namespace dawn_native {
             }
         }
 
-        for (uint32_t group : IterateBitSet(~layout->GetBindGroupLayoutsMask())) {
-            if (mBindingInfo[group].size() > 0) {
-                return false;
-            }
-        }
-
-        return true;
+        return (mUsedBindGroups & ~layout->GetBindGroupLayoutsMask()).none();
     }
 
     bool ShaderModuleBase::IsCompatibleWithBindGroupLayout(
@@ -747,16 +865,69 @@ namespace dawn_native {
         const BindGroupLayoutBase* layout) const {
         ASSERT(!IsError());
 
+        uint64_t layoutId = layout->GetUniqueId();
+        for (const BindGroupLayoutCompatibility& compatibility : mBindGroupLayoutCompatibilities) {
+            if (compatibility.layoutId == layoutId && compatibility.group == group) {
+                return compatibility.compatible;
+            }
+        }
+
+        bool compatible = ComputeCompatibilityWithBindGroupLayout(group, layout);
+        if (mBindGroupLayoutCompatibilities.size() == kMaxBindGroupLayoutCompatibilities) {
+            mBindGroupLayoutCompatibilities.erase(mBindGroupLayoutCompatibilities.begin());
+        }
+        mBindGroupLayoutCompatibilities.push_back(
+            {layoutId, static_cast<uint32_t>(group), compatible});
+        return compatible;
+    }
+
+    uint64_t ShaderModuleBase::GetUniqueId() const {
+        ASSERT(!IsError());
+        return mUniqueId;
+    }
+
+    PipelineLayoutBase* ShaderModuleBase::GetDefaultPipelineLayout(
+        const ShaderModuleBase* otherModule) const {
+        ASSERT(!IsError());
+
+        uint64_t otherModuleId = otherModule != nullptr ? otherModule->GetUniqueId() : 0;
+        for (DefaultPipelineLayout& defaultLayout : mDefaultPipelineLayouts) {
+            if (defaultLayout.otherModuleId == otherModuleId) {
+                return defaultLayout.layout.Get();
+            }
+        }
+        return nullptr;
+    }
+
+    void ShaderModuleBase::SetDefaultPipelineLayout(const ShaderModuleBase* otherModule,
+                                                    PipelineLayoutBase* layout) const {
+        ASSERT(!IsError());
+        ASSERT(GetDefaultPipelineLayout(otherModule) == nullptr);
+
+        uint64_t otherModuleId = otherModule != nullptr ? otherModule->GetUniqueId() : 0;
+        if (mDefaultPipelineLayouts.size() == kMaxDefaultPipelineLayouts) {
+            mDefaultPipelineLayouts.erase(mDefaultPipelineLayouts.begin());
+        }
+        mDefaultPipelineLayouts.push_back({otherModuleId, layout});
+    }
+
+    bool ShaderModuleBase::ComputeCompatibilityWithBindGroupLayout(
+        size_t group,
+        const BindGroupLayoutBase* layout) const {
         const BindGroupLayoutBase::BindingMap& bindingMap = layout->GetBindingMap();
 
         // Iterate over all bindings used by this group in the shader, and find the
-        // corresponding binding in the BindGroupLayout, if it exists.
+        // corresponding binding in the BindGroupLayout, if it exists. Both maps are sorted by
+        // binding number so they are walked together instead of looking up each binding.
+        auto bindingIt = bindingMap.begin();
         for (const auto& it : mBindingInfo[group]) {
             BindingNumber bindingNumber = it.first;
             const ShaderBindingInfo& moduleInfo = it.second;
 
-            const auto& bindingIt = bindingMap.find(bindingNumber);
-            if (bindingIt == bindingMap.end()) {
+            while (bindingIt != bindingMap.end() && bindingIt->first < bindingNumber) {
+                ++bindingIt;
+            }
+            if (bindingIt == bindingMap.end() || bindingIt->first != bindingNumber) {
                 return false;
             }
             BindingIndex bindingIndex(bindingIt->second);
@@ -821,25 +992,10 @@ namespace dawn_native {
         return true;
     }
 
-    size_t ShaderModuleBase::HashFunc::operator()(const ShaderModuleBase* module) const {
-        size_t hash = 0;
-
-        for (uint32_t word : module->mCode) {
-            HashCombine(&hash, word);
-        }
-
-        return hash;
-    }
-
-    bool ShaderModuleBase::EqualityFunc::operator()(const ShaderModuleBase* a,
-                                                    const ShaderModuleBase* b) const {
-        return a->mCode == b->mCode;
-    }
-
     MaybeError ShaderModuleBase::CheckSpvcSuccess(shaderc_spvc_status status,
                                                   const char* error_msg) {
         if (status != shaderc_spvc_status_success) {
-            return DAWN_VALIDATION_ERROR(error_msg);
+            return DAWN_MAKE_ERROR_FROM_STRING(InternalErrorType::Validation, error_msg);
         }
         return {};
     }
@@ -22,6 +22,8 @@
 #include "dawn_native/Format.h"
 #include "dawn_native/Forward.h"
 #include "dawn_native/PerStage.h"
+#include "dawn_native/PipelineLayout.h"
+#include "dawn_native/SpirvReflector.h"
 
 #include "dawn_native/dawn_platform.h"
 
@@ -41,14 +43,59 @@ namespace dawn_native {
     MaybeError ValidateShaderModuleDescriptor(DeviceBase* device,
                                               const ShaderModuleDescriptor* descriptor);
 
-    class ShaderModuleBase : public CachedObject {
+    // Runs the SPIR-V validator on the code. This is the expensive part of the validation of shader
+    // modules so it is done by the device only for code it hasn't seen pass validation already.
+    MaybeError ValidateSpirv(const uint32_t* code, uint32_t codeSize);
+
+    // ShaderModuleContent is the SPIR-V code of a shader module and is the key of the shader module
+    // cache. The hash of the code is computed once when the content is created. The blueprints used
+    // to look up the cache only point at the code of the descriptor while shader modules own a
+    // copy of it.
+    class ShaderModuleContent {
+      public:
+        explicit ShaderModuleContent(const ShaderModuleDescriptor* descriptor);
+
+        // Moving keeps the code at the same address, copying would leave it pointing to the
+        // code of the other content.
+        ShaderModuleContent(ShaderModuleContent&& rhs) = default;
+        ShaderModuleContent(const ShaderModuleContent& rhs) = delete;
+        ShaderModuleContent& operator=(const ShaderModuleContent& rhs) = delete;
+
+        size_t GetContentHash() const;
+        const uint32_t* GetCode() const;
+        uint32_t GetCodeSize() const;
+
+        // Functors necessary for the unordered_set<ShaderModuleContent*>-based cache.
+        struct HashFunc {
+            size_t operator()(const ShaderModuleContent* content) const;
+        };
+        struct EqualityFunc {
+            bool operator()(const ShaderModuleContent* a, const ShaderModuleContent* b) const;
+        };
+
+      protected:
+        ShaderModuleContent() = default;
+
+        // Makes the content own a copy of the code it points at.
+        void CopyCode();
+
+      private:
+        std::vector<uint32_t> mOwnedCode;
+        const uint32_t* mCode = nullptr;
+        uint32_t mCodeSize = 0;
+        size_t mContentHash = 0;
+    };
+
+    class ShaderModuleBase : public ShaderModuleContent, public CachedObject {
       public:
         ShaderModuleBase(DeviceBase* device, const ShaderModuleDescriptor* descriptor);
         ~ShaderModuleBase() override;
 
         static ShaderModuleBase* MakeError(DeviceBase* device);
 
-        MaybeError ExtractSpirvInfo(const spirv_cross::Compiler& compiler);
+        // Reflects the SPIR-V with the SpirvReflector, unless spvc is used or spirv_cross
+        // reflection is forced with the UseSpirvCrossReflection toggle.
+        MaybeError ExtractSpirvInfo();
 
         struct ShaderBindingInfo : BindingInfo {
             // The SPIRV ID of the resource.
@@ -75,13 +122,16 @@ namespace dawn_native {
 
         bool IsCompatibleWithPipelineLayout(const PipelineLayoutBase* layout) const;
 
-        // Functors necessary for the unordered_set<ShaderModuleBase*>-based cache.
-        struct HashFunc {
-            size_t operator()(const ShaderModuleBase* module) const;
-        };
-        struct EqualityFunc {
-            bool operator()(const ShaderModuleBase* a, const ShaderModuleBase* b) const;
-        };
+        // Unlike the address of the module, the unique ID isn't reused by another module once this
+        // one is destroyed, so it can identify the module in caches that don't keep it alive.
+        uint64_t GetUniqueId() const;
+
+        // The default layout of the pipelines created with this module as their first stage and
+        // |otherModule|, the fragment module of render pipelines or nullptr. It only depends on
+        // the modules so it is memoized by this one. Returns nullptr if it isn't memoized.
+        PipelineLayoutBase* GetDefaultPipelineLayout(const ShaderModuleBase* otherModule) const;
+        void SetDefaultPipelineLayout(const ShaderModuleBase* otherModule,
+                                      PipelineLayoutBase* layout) const;
 
         shaderc_spvc::Context* GetContext() {
             return &mSpvcContext;
@@ -97,21 +147,51 @@ namespace dawn_native {
         ShaderModuleBase(DeviceBase* device, ObjectBase::ErrorTag tag);
 
         bool IsCompatibleWithBindGroupLayout(size_t group, const BindGroupLayoutBase* layout) const;
+        bool ComputeCompatibilityWithBindGroupLayout(size_t group,
+                                                     const BindGroupLayoutBase* layout) const;
 
         // Different implementations reflection into the shader depending on
-        // whether using spvc, or directly accessing spirv-cross.
+        // whether using spvc, directly accessing spirv-cross or the SpirvReflector.
         MaybeError ExtractSpirvInfoWithSpvc();
         MaybeError ExtractSpirvInfoWithSpirvCross(const spirv_cross::Compiler& compiler);
-
-        // TODO(cwallez@chromium.org): The code is only stored for deduplication. We could maybe
-        // store a cryptographic hash of the code instead?
-        std::vector<uint32_t> mCode;
+        MaybeError ExtractSpirvInfoWithReflector();
+        // Validates the resources and stage variables reflected by the spirv_cross and the
+        // SpirvReflector paths and records them in the module.
+        MaybeError PopulateSpirvInfo(const std::vector<SpirvReflector::Variable>& variables);
 
         ModuleBindingInfo mBindingInfo;
         std::bitset<kMaxVertexAttributes> mUsedVertexAttributes;
         SingleShaderStage mExecutionModel;
 
         FragmentOutputBaseTypes mFragmentOutputFormatBaseTypes;
+
+        // The groups of mBindingInfo that have bindings.
+        std::bitset<kMaxBindGroups> mUsedBindGroups;
+
+        // The results of IsCompatibleWithBindGroupLayout, since many pipelines are created with
+        // the same modules and layouts. Layouts are identified by their unique ID so that the
+        // results for a destroyed layout can't be used for a new one allocated at the same
+        // address, without the memo keeping layouts alive. The memo is small and searched
+        // linearly because applications use few layouts per module.
+        struct BindGroupLayoutCompatibility {
+            uint64_t layoutId;
+            uint32_t group;
+            bool compatible;
+        };
+        static constexpr size_t kMaxBindGroupLayoutCompatibilities = 32;
+        mutable std::vector<BindGroupLayoutCompatibility> mBindGroupLayoutCompatibilities;
+
+        uint64_t mUniqueId = 0;
+
+        // The memo of the default pipeline layouts, keyed by the unique ID of the other module, or
+        // 0 when there is none, so that it doesn't keep the other modules alive. It keeps the
+        // layouts alive so that they aren't created again for each pipeline.
+        struct DefaultPipelineLayout {
+            uint64_t otherModuleId;
+            Ref<PipelineLayoutBase> layout;
+        };
+        static constexpr size_t kMaxDefaultPipelineLayouts = 8;
+        mutable std::vector<DefaultPipelineLayout> mDefaultPipelineLayouts;
     };
 
 }  // namespace dawn_native
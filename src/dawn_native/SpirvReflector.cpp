@@ -0,0 +1,497 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn_native/SpirvReflector.h"
+
+namespace dawn_native {
+
+    namespace {
+
+        // The header is the magic number, the version, the generator, the bound of the ids and
+        // the schema.
+        constexpr size_t kHeaderSize = 5;
+        constexpr size_t kIdBoundOffset = 3;
+
+        // The decorations tracked in IdInfo::decorations.
+        enum DecorationBit : uint32_t {
+            kBinding = 1 << 0,
+            kDescriptorSet = 1 << 1,
+            kLocation = 1 << 2,
+            kBuiltIn = 1 << 3,
+            kBlock = 1 << 4,
+            kBufferBlock = 1 << 5,
+            kNonWritable = 1 << 6,
+            kNonReadable = 1 << 7,
+        };
+
+        uint32_t GetOpcode(uint32_t firstWord) {
+            return firstWord & spv::OpCodeMask;
+        }
+
+        uint32_t GetWordCount(uint32_t firstWord) {
+            return firstWord >> spv::WordCountShift;
+        }
+
+        // Literal strings are nul-terminated and packed 4 characters per word.
+        bool IsLastWordOfString(uint32_t word) {
+            return (word & 0x000000FF) == 0 || (word & 0x0000FF00) == 0 ||
+                   (word & 0x00FF0000) == 0 || (word & 0xFF000000) == 0;
+        }
+
+    }  // anonymous namespace
+
+    MaybeError SpirvReflector::Reflect(const uint32_t* code, size_t codeSize) {
+        if (codeSize < kHeaderSize || code[0] != spv::MagicNumber) {
+            return DAWN_VALIDATION_ERROR("Invalid SPIR-V header");
+        }
+
+        // Each id is the result of an instruction of at least two words so a valid bound is
+        // smaller than the code. Checking it avoids huge allocations when validation is skipped.
+        uint32_t idBound = code[kIdBoundOffset];
+        if (idBound > codeSize) {
+            return DAWN_VALIDATION_ERROR("Invalid SPIR-V id bound");
+        }
+
+        mCode = code;
+        mCodeSize = codeSize;
+        mIds.assign(idBound, IdInfo{});
+        mHasEntryPoint = false;
+        mVariables.clear();
+
+        bool reachedFunctions = false;
+        size_t offset = kHeaderSize;
+        while (offset < codeSize && !reachedFunctions) {
+            uint32_t opcode = GetOpcode(code[offset]);
+            uint32_t wordCount = GetWordCount(code[offset]);
+            if (wordCount == 0 || wordCount > codeSize - offset) {
+                return DAWN_VALIDATION_ERROR("Invalid SPIR-V instruction size");
+            }
+
+            const uint32_t* operands = &code[offset + 1];
+            uint32_t operandCount = wordCount - 1;
+
+            switch (opcode) {
+                case spv::OpEntryPoint:
+                    DAWN_TRY(ReflectEntryPoint(operands, operandCount));
+                    break;
+
+                case spv::OpDecorate:
+                    if (operandCount < 2 || operands[0] >= idBound) {
+                        return DAWN_VALIDATION_ERROR("Invalid SPIR-V OpDecorate");
+                    }
+                    ReflectDecoration(operands[0], operands[1],
+                                      operandCount > 2 ? operands[2] : 0);
+                    break;
+
+                case spv::OpMemberDecorate:
+                    if (operandCount < 3 || operands[0] >= idBound) {
+                        return DAWN_VALIDATION_ERROR("Invalid SPIR-V OpMemberDecorate");
+                    }
+                    ReflectMemberDecoration(operands[0], operands[2]);
+                    break;
+
+                // The decorations of a group are the ones of the group id, they are copied to
+                // the targets of the group.
+                case spv::OpGroupDecorate: {
+                    if (operandCount < 1 || operands[0] >= idBound) {
+                        return DAWN_VALIDATION_ERROR("Invalid SPIR-V OpGroupDecorate");
+                    }
+                    const IdInfo group = mIds[operands[0]];
+                    for (uint32_t i = 1; i < operandCount; ++i) {
+                        if (operands[i] >= idBound) {
+                            return DAWN_VALIDATION_ERROR("Invalid SPIR-V OpGroupDecorate");
+                        }
+                        IdInfo* target = &mIds[operands[i]];
+                        target->decorations |= group.decorations;
+                        if (group.decorations & kBinding) {
+                            target->binding = group.binding;
+                        }
+                        if (group.decorations & kDescriptorSet) {
+                            target->descriptorSet = group.descriptorSet;
+                        }
+                        if (group.decorations & kLocation) {
+                            target->location = group.location;
+                        }
+                    }
+                    break;
+                }
+
+                case spv::OpGroupMemberDecorate: {
+                    if (operandCount < 1 || operands[0] >= idBound) {
+                        return DAWN_VALIDATION_ERROR("Invalid SPIR-V OpGroupMemberDecorate");
+                    }
+                    uint32_t groupDecorations = mIds[operands[0]].decorations;
+                    for (uint32_t i = 1; i + 1 < operandCount; i += 2) {
+                        if (operands[i] >= idBound) {
+                            return DAWN_VALIDATION_ERROR("Invalid SPIR-V OpGroupMemberDecorate");
+                        }
+                        if (groupDecorations & kNonWritable) {
+                            ReflectMemberDecoration(operands[i], spv::DecorationNonWritable);
+                        }
+                        if (groupDecorations & kBuiltIn) {
+                            ReflectMemberDecoration(operands[i], spv::DecorationBuiltIn);
+                        }
+                    }
+                    break;
+                }
+
+                case spv::OpTypeVoid:
+                case spv::OpTypeBool:
+                case spv::OpTypeInt:
+                case spv::OpTypeFloat:
+                case spv::OpTypeVector:
+                case spv::OpTypeMatrix:
+                case spv::OpTypeImage:
+                case spv::OpTypeSampler:
+                case spv::OpTypeSampledImage:
+                case spv::OpTypeArray:
+                case spv::OpTypeRuntimeArray:
+                case spv::OpTypeStruct:
+                case spv::OpTypePointer:
+                    if (operandCount < 1 || operands[0] >= idBound) {
+                        return DAWN_VALIDATION_ERROR("Invalid SPIR-V type declaration");
+                    }
+                    mIds[operands[0]].typeDefinition = static_cast<uint32_t>(offset);
+                    break;
+
+                case spv::OpVariable:
+                    if (operandCount < 3) {
+                        return DAWN_VALIDATION_ERROR("Invalid SPIR-V OpVariable");
+                    }
+                    DAWN_TRY(ReflectVariable(operands[0], operands[1], operands[2]));
+                    break;
+
+                // The module-scope variables are all declared before the functions.
+                case spv::OpFunction:
+                    reachedFunctions = true;
+                    break;
+
+                default:
+                    break;
+            }
+
+            offset += wordCount;
+        }
+
+        if (!mHasEntryPoint) {
+            return DAWN_VALIDATION_ERROR("No entry point in the SPIR-V");
+        }
+        return {};
+    }
+
+    SingleShaderStage SpirvReflector::GetExecutionModel() const {
+        ASSERT(mHasEntryPoint);
+        return mExecutionModel;
+    }
+
+    const std::vector<SpirvReflector::Variable>& SpirvReflector::GetVariables() const {
+        return mVariables;
+    }
+
+    MaybeError SpirvReflector::ReflectEntryPoint(const uint32_t* operands, uint32_t operandCount) {
+        // Like spirv_cross, only the first entry point is reflected.
+        if (mHasEntryPoint) {
+            return {};
+        }
+
+        if (operandCount < 3) {
+            return DAWN_VALIDATION_ERROR("Invalid SPIR-V OpEntryPoint");
+        }
+
+        switch (operands[0]) {
+            case spv::ExecutionModelVertex:
+                mExecutionModel = SingleShaderStage::Vertex;
+                break;
+            case spv::ExecutionModelFragment:
+                mExecutionModel = SingleShaderStage::Fragment;
+                break;
+            case spv::ExecutionModelGLCompute:
+                mExecutionModel = SingleShaderStage::Compute;
+                break;
+            default:
+                return DAWN_VALIDATION_ERROR("Unexpected shader execution model");
+        }
+        mHasEntryPoint = true;
+
+        // The operands are the execution model, the function, the name and the interface ids.
+        uint32_t operand = 2;
+        while (operand < operandCount && !IsLastWordOfString(operands[operand])) {
+            operand++;
+        }
+        operand++;
+
+        for (; operand < operandCount; ++operand) {
+            if (operands[operand] >= mIds.size()) {
+                return DAWN_VALIDATION_ERROR("Invalid SPIR-V OpEntryPoint");
+            }
+            mIds[operands[operand]].isEntryPointInterface = true;
+        }
+        return {};
+    }
+
+    void SpirvReflector::ReflectDecoration(uint32_t target, uint32_t decoration, uint32_t value) {
+        IdInfo* info = &mIds[target];
+        switch (decoration) {
+            case spv::DecorationBinding:
+                info->decorations |= kBinding;
+                info->binding = value;
+                break;
+            case spv::DecorationDescriptorSet:
+                info->decorations |= kDescriptorSet;
+                info->descriptorSet = value;
+                break;
+            case spv::DecorationLocation:
+                info->decorations |= kLocation;
+                info->location = value;
+                break;
+            case spv::DecorationBuiltIn:
+                info->decorations |= kBuiltIn;
+                break;
+            case spv::DecorationBlock:
+                info->decorations |= kBlock;
+                break;
+            case spv::DecorationBufferBlock:
+                info->decorations |= kBufferBlock;
+                break;
+            case spv::DecorationNonWritable:
+                info->decorations |= kNonWritable;
+                break;
+            case spv::DecorationNonReadable:
+                info->decorations |= kNonReadable;
+                break;
+            default:
+                break;
+        }
+    }
+
+    void SpirvReflector::ReflectMemberDecoration(uint32_t structType, uint32_t decoration) {
+        IdInfo* info = &mIds[structType];
+        switch (decoration) {
+            case spv::DecorationNonWritable:
+                info->nonWritableMemberCount++;
+                break;
+            case spv::DecorationBuiltIn:
+                info->hasBuiltInMember = true;
+                break;
+            default:
+                break;
+        }
+    }
+
+    MaybeError SpirvReflector::ReflectVariable(uint32_t pointerType,
+                                               uint32_t id,
+                                               uint32_t storageClass) {
+        switch (storageClass) {
+            case spv::StorageClassUniformConstant:
+            case spv::StorageClassUniform:
+            case spv::StorageClassStorageBuffer:
+            case spv::StorageClassPushConstant:
+            case spv::StorageClassInput:
+            case spv::StorageClassOutput:
+                break;
+            default:
+                return {};
+        }
+
+        if (id >= mIds.size()) {
+            return DAWN_VALIDATION_ERROR("Invalid SPIR-V OpVariable");
+        }
+
+        uint32_t pointerDefinition;
+        DAWN_TRY_ASSIGN(pointerDefinition, GetTypeDefinition(pointerType));
+        if (GetOpcode(mCode[pointerDefinition]) != spv::OpTypePointer) {
+            return DAWN_VALIDATION_ERROR("The type of a SPIR-V variable isn't a pointer");
+        }
+
+        uint32_t pointeeType;
+        DAWN_TRY_ASSIGN(pointeeType, GetOperand(pointerDefinition, 2));
+        uint32_t baseType;
+        DAWN_TRY_ASSIGN(baseType, StripArrays(pointeeType));
+        uint32_t baseDefinition;
+        DAWN_TRY_ASSIGN(baseDefinition, GetTypeDefinition(baseType));
+        uint32_t baseOpcode = GetOpcode(mCode[baseDefinition]);
+
+        const IdInfo& info = mIds[id];
+        const IdInfo& baseInfo = mIds[baseType];
+
+        Variable variable;
+        variable.id = id;
+        variable.baseTypeId = baseType;
+
+        switch (storageClass) {
+            case spv::StorageClassUniformConstant: {
+                if (baseOpcode == spv::OpTypeSampler) {
+                    variable.kind = VariableKind::Sampler;
+                    break;
+                }
+                // Combined image samplers aren't used in WebGPU.
+                if (baseOpcode != spv::OpTypeImage) {
+                    return {};
+                }
+
+                // The operands of OpTypeImage are the result, the sampled type, the dimension,
+                // depth, arrayed, multisampled, sampled and the image format.
+                uint32_t sampled;
+                DAWN_TRY_ASSIGN(sampled, GetOperand(baseDefinition, 6));
+                if (sampled == 1) {
+                    variable.kind = VariableKind::SampledTexture;
+                } else if (sampled == 2) {
+                    variable.kind = VariableKind::StorageTexture;
+                } else {
+                    return {};
+                }
+
+                uint32_t sampledType;
+                uint32_t dimension;
+                uint32_t arrayed;
+                uint32_t multisampled;
+                uint32_t imageFormat;
+                DAWN_TRY_ASSIGN(sampledType, GetOperand(baseDefinition, 1));
+                DAWN_TRY_ASSIGN(dimension, GetOperand(baseDefinition, 2));
+                DAWN_TRY_ASSIGN(arrayed, GetOperand(baseDefinition, 4));
+                DAWN_TRY_ASSIGN(multisampled, GetOperand(baseDefinition, 5));
+                DAWN_TRY_ASSIGN(imageFormat, GetOperand(baseDefinition, 7));
+                DAWN_TRY_ASSIGN(variable.componentType, GetComponentType(sampledType));
+                variable.dimension = static_cast<spv::Dim>(dimension);
+                variable.arrayed = arrayed != 0;
+                variable.multisampled = multisampled != 0;
+                variable.imageFormat = static_cast<spv::ImageFormat>(imageFormat);
+                break;
+            }
+
+            case spv::StorageClassUniform:
+                if (baseInfo.decorations & kBlock) {
+                    variable.kind = VariableKind::UniformBuffer;
+                } else if (baseInfo.decorations & kBufferBlock) {
+                    variable.kind = VariableKind::StorageBuffer;
+                } else {
+                    return {};
+                }
+                break;
+
+            case spv::StorageClassStorageBuffer:
+                variable.kind = VariableKind::StorageBuffer;
+                break;
+
+            case spv::StorageClassPushConstant:
+                variable.kind = VariableKind::PushConstant;
+                break;
+
+            case spv::StorageClassInput:
+            case spv::StorageClassOutput:
+                // Builtins like gl_Position or the members of gl_PerVertex aren't stage variables.
+                if (!info.isEntryPointInterface || (info.decorations & kBuiltIn) ||
+                    baseInfo.hasBuiltInMember) {
+                    return {};
+                }
+                variable.kind = storageClass == spv::StorageClassInput ? VariableKind::StageInput
+                                                                       : VariableKind::StageOutput;
+                DAWN_TRY_ASSIGN(variable.componentType, GetComponentType(baseType));
+                break;
+
+            default:
+                UNREACHABLE();
+        }
+
+        variable.hasBinding = (info.decorations & kBinding) != 0;
+        variable.binding = info.binding;
+        variable.hasDescriptorSet = (info.decorations & kDescriptorSet) != 0;
+        variable.descriptorSet = info.descriptorSet;
+        variable.hasLocation = (info.decorations & kLocation) != 0;
+        variable.location = info.location;
+        variable.nonReadable = (info.decorations & kNonReadable) != 0;
+        variable.nonWritable = (info.decorations & kNonWritable) != 0;
+
+        // Like spirv_cross, a buffer is also non-writable if all the members of its block are.
+        if (variable.kind == VariableKind::StorageBuffer && baseOpcode == spv::OpTypeStruct) {
+            uint32_t memberCount = GetWordCount(mCode[baseDefinition]) - 2;
+            if (memberCount > 0 && baseInfo.nonWritableMemberCount >= memberCount) {
+                variable.nonWritable = true;
+            }
+        }
+
+        mVariables.push_back(variable);
+        return {};
+    }
+
+    ResultOrError<uint32_t> SpirvReflector::GetTypeDefinition(uint32_t id) const {
+        if (id >= mIds.size() || mIds[id].typeDefinition == 0) {
+            return DAWN_VALIDATION_ERROR("Invalid SPIR-V type");
+        }
+        uint32_t definition = mIds[id].typeDefinition;
+        return definition;
+    }
+
+    ResultOrError<uint32_t> SpirvReflector::GetOperand(uint32_t instruction, uint32_t index) const {
+        if (index + 1 >= GetWordCount(mCode[instruction])) {
+            return DAWN_VALIDATION_ERROR("Missing SPIR-V operand");
+        }
+        uint32_t operand = mCode[instruction + 1 + index];
+        return operand;
+    }
+
+    ResultOrError<uint32_t> SpirvReflector::StripArrays(uint32_t type) const {
+        // Types are declared before they are used so a valid module can't have more nested
+        // arrays than ids.
+        for (size_t i = 0; i < mIds.size(); ++i) {
+            uint32_t definition;
+            DAWN_TRY_ASSIGN(definition, GetTypeDefinition(type));
+
+            uint32_t opcode = GetOpcode(mCode[definition]);
+            if (opcode != spv::OpTypeArray && opcode != spv::OpTypeRuntimeArray) {
+                return type;
+            }
+            DAWN_TRY_ASSIGN(type, GetOperand(definition, 1));
+        }
+        return DAWN_VALIDATION_ERROR("Invalid SPIR-V array type");
+    }
+
+    ResultOrError<Format::Type> SpirvReflector::GetComponentType(uint32_t type) const {
+        // Matrices are vectors of vectors which are vectors of scalars.
+        constexpr uint32_t kMaxTypeDepth = 3;
+        for (uint32_t i = 0; i < kMaxTypeDepth; ++i) {
+            uint32_t definition;
+            DAWN_TRY_ASSIGN(definition, GetTypeDefinition(type));
+
+            switch (GetOpcode(mCode[definition])) {
+                case spv::OpTypeVector:
+                case spv::OpTypeMatrix:
+                    DAWN_TRY_ASSIGN(type, GetOperand(definition, 1));
+                    break;
+
+                case spv::OpTypeFloat: {
+                    uint32_t width;
+                    DAWN_TRY_ASSIGN(width, GetOperand(definition, 1));
+                    return width == 32 ? Format::Type::Float : Format::Type::Other;
+                }
+
+                case spv::OpTypeInt: {
+                    uint32_t width;
+                    uint32_t signedness;
+                    DAWN_TRY_ASSIGN(width, GetOperand(definition, 1));
+                    DAWN_TRY_ASSIGN(signedness, GetOperand(definition, 2));
+                    if (width != 32) {
+                        return Format::Type::Other;
+                    }
+                    return signedness != 0 ? Format::Type::Sint : Format::Type::Uint;
+                }
+
+                default:
+                    return Format::Type::Other;
+            }
+        }
+        return Format::Type::Other;
+    }
+
+}  // namespace dawn_native
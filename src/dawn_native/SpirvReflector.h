@@ -0,0 +1,129 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_SPIRVREFLECTOR_H_
+#define DAWNNATIVE_SPIRVREFLECTOR_H_
+
+#include "dawn_native/Error.h"
+#include "dawn_native/Format.h"
+#include "dawn_native/PerStage.h"
+
+#include <spirv.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace dawn_native {
+
+    // SpirvReflector extracts what the frontend needs to know about a SPIR-V module: the execution
+    // model of its entry point, its resources and its stage inputs and outputs. Unlike
+    // spirv_cross it doesn't build an IR of the module: it scans the instructions once, keeping
+    // only the decorations and the definitions of the types of the module, and stops at the first
+    // function since all the variables it looks for are declared before. The module must be valid
+    // SPIR-V, the reflector only checks what it needs to not read out of bounds.
+    //
+    // The variables are classified like spirv_cross::Compiler::get_shader_resources does, so that
+    // the reflection of a module matches the one done with spirv_cross.
+    class SpirvReflector {
+      public:
+        enum class VariableKind {
+            UniformBuffer,
+            StorageBuffer,
+            SampledTexture,
+            Sampler,
+            StorageTexture,
+            PushConstant,
+            StageInput,
+            StageOutput,
+        };
+
+        struct Variable {
+            VariableKind kind;
+            uint32_t id;
+            // The type of the variable without its pointer and arrays, like the base_type_id of
+            // spirv_cross resources.
+            uint32_t baseTypeId;
+
+            bool hasBinding = false;
+            uint32_t binding = 0;
+            bool hasDescriptorSet = false;
+            uint32_t descriptorSet = 0;
+            bool hasLocation = false;
+            uint32_t location = 0;
+
+            // For storage buffers, includes the NonWritable decorations of all the block members.
+            bool nonWritable = false;
+            bool nonReadable = false;
+
+            // Only for textures.
+            spv::Dim dimension = spv::Dim2D;
+            bool arrayed = false;
+            bool multisampled = false;
+            spv::ImageFormat imageFormat = spv::ImageFormatUnknown;
+
+            // The type of the components of sampled textures and stage variables. Other when they
+            // aren't 32-bit floats or integers.
+            Format::Type componentType = Format::Type::Other;
+        };
+
+        MaybeError Reflect(const uint32_t* code, size_t codeSize);
+
+        SingleShaderStage GetExecutionModel() const;
+        // In the order the variables are declared in the module.
+        const std::vector<Variable>& GetVariables() const;
+
+      private:
+        // What the reflector knows about an id of the module.
+        struct IdInfo {
+            // The offset in the code of the instruction defining the type with this id, or 0.
+            uint32_t typeDefinition = 0;
+
+            // A mask of the decorations the reflector tracks, with the values of the ones that
+            // have a value.
+            uint32_t decorations = 0;
+            uint32_t binding = 0;
+            uint32_t descriptorSet = 0;
+            uint32_t location = 0;
+
+            // Only for structs.
+            uint32_t nonWritableMemberCount = 0;
+            bool hasBuiltInMember = false;
+
+            bool isEntryPointInterface = false;
+        };
+
+        MaybeError ReflectEntryPoint(const uint32_t* operands, uint32_t operandCount);
+        void ReflectDecoration(uint32_t target, uint32_t decoration, uint32_t value);
+        void ReflectMemberDecoration(uint32_t structType, uint32_t decoration);
+        MaybeError ReflectVariable(uint32_t pointerType, uint32_t id, uint32_t storageClass);
+
+        // Returns the offset of the instruction defining a type, or an error if |id| isn't a
+        // type.
+        ResultOrError<uint32_t> GetTypeDefinition(uint32_t id) const;
+        ResultOrError<uint32_t> GetOperand(uint32_t instruction, uint32_t index) const;
+        ResultOrError<uint32_t> StripArrays(uint32_t type) const;
+        ResultOrError<Format::Type> GetComponentType(uint32_t type) const;
+
+        const uint32_t* mCode = nullptr;
+        size_t mCodeSize = 0;
+
+        std::vector<IdInfo> mIds;
+        bool mHasEntryPoint = false;
+        SingleShaderStage mExecutionModel = SingleShaderStage::Vertex;
+        std::vector<Variable> mVariables;
+    };
+
+}  // namespace dawn_native
+
+#endif  // DAWNNATIVE_SPIRVREFLECTOR_H_
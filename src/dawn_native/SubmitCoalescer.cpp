@@ -0,0 +1,94 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn_native/SubmitCoalescer.h"
+
+#include "dawn_native/CommandBuffer.h"
+#include "dawn_native/Device.h"
+#include "dawn_native/ErrorScope.h"
+#include "dawn_native/ErrorScopeTracker.h"
+#include "dawn_native/Queue.h"
+#include "dawn_platform/DawnPlatform.h"
+#include "dawn_platform/tracing/TraceEvent.h"
+
+namespace dawn_native {
+
+    SubmitCoalescer::SubmitCoalescer(DeviceBase* device) : mDevice(device) {
+    }
+
+    SubmitCoalescer::~SubmitCoalescer() {
+        ASSERT(mCommands.empty());
+        ASSERT(mErrorScope.Get() == nullptr);
+    }
+
+    void SubmitCoalescer::Enqueue(QueueBase* queue,
+                                  uint32_t commandCount,
+                                  CommandBufferBase* const* commands) {
+        ErrorScope* scope = mDevice->GetCurrentErrorScope();
+        if (mQueue.Get() != queue || mErrorScope.Get() != scope) {
+            if (!Flush()) {
+                return;
+            }
+            mQueue = queue;
+            mErrorScope = scope;
+        }
+
+        for (uint32_t i = 0; i < commandCount; ++i) {
+            mCommands.emplace_back(commands[i]);
+        }
+
+        if (mCommands.size() >= kMaxPendingCommandBuffers) {
+            Flush();
+        }
+    }
+
+    bool SubmitCoalescer::Flush() {
+        if (mCommands.empty()) {
+            return true;
+        }
+        TRACE_EVENT0(mDevice->GetPlatform(), General, "SubmitCoalescer::Flush");
+
+        // Take the pending state first because backends can tick the device, and flush again,
+        // during the submit.
+        Ref<QueueBase> queue = std::move(mQueue);
+        std::vector<Ref<CommandBufferBase>> pendingCommands = std::move(mCommands);
+        Ref<ErrorScope> errorScope = std::move(mErrorScope);
+        mCommands.clear();
+
+        std::vector<CommandBufferBase*> commands(pendingCommands.size());
+        for (size_t i = 0; i < pendingCommands.size(); ++i) {
+            commands[i] = pendingCommands[i].Get();
+        }
+        MaybeError result = queue->SubmitValidatedCommands(
+            static_cast<uint32_t>(commands.size()), commands.data());
+        if (result.IsError()) {
+            mDevice->ConsumeErrorInScope(result.AcquireError(), errorScope.Get());
+            return !mDevice->IsLost();
+        }
+
+        mDevice->GetErrorScopeTracker()->TrackUntilLastSubmitComplete(errorScope.Get());
+        return true;
+    }
+
+    void SubmitCoalescer::Discard() {
+        mQueue = nullptr;
+        mCommands.clear();
+        mErrorScope = nullptr;
+    }
+
+    size_t SubmitCoalescer::GetPendingCommandBufferCount() const {
+        return mCommands.size();
+    }
+
+}  // namespace dawn_native
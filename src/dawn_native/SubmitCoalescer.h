@@ -0,0 +1,73 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_SUBMITCOALESCER_H_
+#define DAWNNATIVE_SUBMITCOALESCER_H_
+
+#include "dawn_native/Error.h"
+#include "dawn_native/RefCounted.h"
+
+#include <vector>
+
+namespace dawn_native {
+
+    class CommandBufferBase;
+    class DeviceBase;
+    class ErrorScope;
+    class QueueBase;
+
+    // Accumulates the validated command buffers of Queue::Submit calls when the
+    // CoalesceQueueSubmits toggle is enabled so that they are given to the backend in a single
+    // SubmitImpl call. The pending command buffers must be flushed before anything that could
+    // observe the end of their execution or that must be ordered after them, for example fence
+    // signals, buffer mapping and writes, and resource destruction.
+    //
+    // The submits are validated completely by Queue::Submit, but the deferred work, like the lazy
+    // clears and the backend submit, can still fail when flushing. Only submits made in the same
+    // error scope are coalesced, and errors of a flush are reported to that error scope instead
+    // of the API call that caused the flush.
+    class SubmitCoalescer {
+      public:
+        // Flush automatically once this many command buffers are pending.
+        static constexpr size_t kMaxPendingCommandBuffers = 64;
+
+        SubmitCoalescer(DeviceBase* device);
+        ~SubmitCoalescer();
+
+        void Enqueue(QueueBase* queue, uint32_t commandCount, CommandBufferBase* const* commands);
+        // Returns false if the device was lost while flushing.
+        bool Flush();
+
+        // Drops the pending command buffers without submitting them, when the device is lost or
+        // destroyed.
+        void Discard();
+
+        size_t GetPendingCommandBufferCount() const;
+
+      private:
+        DeviceBase* mDevice;
+
+        // Only the command buffers of a single queue object are pending at a time. Submits on
+        // another queue object flush them first to preserve ordering.
+        Ref<QueueBase> mQueue;
+        std::vector<Ref<CommandBufferBase>> mCommands;
+
+        // The error scope that was current during the coalesced submits. It is kept alive until
+        // the flushed submit completes, like with submits that aren't coalesced.
+        Ref<ErrorScope> mErrorScope;
+    };
+
+}  // namespace dawn_native
+
+#endif  // DAWNNATIVE_SUBMITCOALESCER_H_
@@ -0,0 +1,332 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_SUBRESOURCESTORAGE_H_
+#define DAWNNATIVE_SUBRESOURCESTORAGE_H_
+
+#include "common/Assert.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace dawn_native {
+
+    // A range of subresources of a texture: |levelCount| mip levels in each of |layerCount| array
+    // layers.
+    struct SubresourceRange {
+        uint32_t baseMipLevel;
+        uint32_t levelCount;
+        uint32_t baseArrayLayer;
+        uint32_t layerCount;
+
+        static SubresourceRange SingleSubresource(uint32_t mipLevel, uint32_t arrayLayer) {
+            return {mipLevel, 1, arrayLayer, 1};
+        }
+    };
+
+    // SubresourceStorage<T> stores one value of type T per subresource of a texture, for example
+    // whether it is initialized or what its last usage was. Most of the time all the subresources
+    // of a texture, or all the mip levels of an array layer, have the same value. To make this case
+    // fast and small, the storage is "compressed" at two levels:
+    //
+    //  - When the whole texture is compressed, a single value is stored inline and operations on
+    //    any range are O(1). No per-subresource storage is allocated.
+    //  - When the texture is decompressed, each array layer is either compressed (a single value for
+    //    all its mip levels) or holds one value per mip level.
+    //
+    // Updates decompress the storage as needed so that |updateFunc| can modify exactly the range
+    // that's requested. After an update the touched layers are recompressed if all their mip levels
+    // are equal, and the whole texture is recompressed if the update covered all the layers and they
+    // are all compressed to the same value. T must therefore be copyable and equality comparable.
+    //
+    // Iterations and updates call the functor once per compressed group of subresources that
+    // intersects the range, with the (sub-)range that group covers.
+    template <typename T>
+    class SubresourceStorage {
+      public:
+        SubresourceStorage(uint32_t arrayLayerCount, uint32_t mipLevelCount, T initialValue = {});
+
+        // Calls |updateFunc(const SubresourceRange& range, T* data)| on groups of subresources
+        // covering exactly |range|.
+        template <typename F>
+        void Update(const SubresourceRange& range, F&& updateFunc);
+
+        // Calls |iterateFunc(const SubresourceRange& range, const T& data)| on groups of
+        // subresources covering exactly |range|.
+        template <typename F>
+        void Iterate(const SubresourceRange& range, F&& iterateFunc) const;
+
+        // Same as above but on all the subresources.
+        template <typename F>
+        void Iterate(F&& iterateFunc) const;
+
+        // Sets all the subresources in |range| to |value|.
+        void Fill(const SubresourceRange& range, const T& value);
+
+        const T& Get(uint32_t mipLevel, uint32_t arrayLayer) const;
+
+        uint32_t GetArrayLayerCount() const;
+        uint32_t GetMipLevelCount() const;
+
+        bool IsFullyCompressedForTesting() const;
+        bool IsLayerCompressedForTesting(uint32_t arrayLayer) const;
+
+      private:
+        SubresourceRange GetFullRange() const;
+        SubresourceRange GetFullLayerRange(uint32_t arrayLayer) const;
+        bool CoversFullLayers(const SubresourceRange& range) const;
+
+        void DecompressAll();
+        void RecompressAllIfPossible();
+        void DecompressLayer(uint32_t arrayLayer);
+        void RecompressLayerIfPossible(uint32_t arrayLayer);
+
+        // The value of a compressed layer is stored in the slot of its first mip level.
+        T& LayerData(uint32_t arrayLayer);
+        const T& LayerData(uint32_t arrayLayer) const;
+        T& DataAt(uint32_t mipLevel, uint32_t arrayLayer);
+        const T& DataAt(uint32_t mipLevel, uint32_t arrayLayer) const;
+
+        uint32_t mArrayLayerCount;
+        uint32_t mMipLevelCount;
+
+        bool mFullyCompressed = true;
+        T mFullValue;
+
+        // Lazily allocated the first time the storage is decompressed.
+        std::unique_ptr<bool[]> mLayerCompressed;
+        std::unique_ptr<T[]> mData;
+    };
+
+    template <typename T>
+    SubresourceStorage<T>::SubresourceStorage(uint32_t arrayLayerCount,
+                                              uint32_t mipLevelCount,
+                                              T initialValue)
+        : mArrayLayerCount(arrayLayerCount),
+          mMipLevelCount(mipLevelCount),
+          mFullValue(std::move(initialValue)) {
+    }
+
+    template <typename T>
+    template <typename F>
+    void SubresourceStorage<T>::Update(const SubresourceRange& range, F&& updateFunc) {
+        ASSERT(range.baseArrayLayer + range.layerCount <= mArrayLayerCount);
+        ASSERT(range.baseMipLevel + range.levelCount <= mMipLevelCount);
+
+        bool coversFullLayers = CoversFullLayers(range);
+        bool coversAllLayers = range.baseArrayLayer == 0 && range.layerCount == mArrayLayerCount;
+
+        if (mFullyCompressed) {
+            if (coversFullLayers && coversAllLayers) {
+                updateFunc(range, &mFullValue);
+                return;
+            }
+            DecompressAll();
+        }
+
+        for (uint32_t layer = range.baseArrayLayer; layer < range.baseArrayLayer + range.layerCount;
+             ++layer) {
+            if (coversFullLayers && mLayerCompressed[layer]) {
+                updateFunc(GetFullLayerRange(layer), &LayerData(layer));
+                continue;
+            }
+
+            DecompressLayer(layer);
+            for (uint32_t level = range.baseMipLevel;
+                 level < range.baseMipLevel + range.levelCount; ++level) {
+                updateFunc(SubresourceRange::SingleSubresource(level, layer),
+                           &DataAt(level, layer));
+            }
+            RecompressLayerIfPossible(layer);
+        }
+
+        // Only check for whole-texture recompression when all layers were touched so that the
+        // cost of updates stays proportional to the size of the range.
+        if (coversAllLayers) {
+            RecompressAllIfPossible();
+        }
+    }
+
+    template <typename T>
+    template <typename F>
+    void SubresourceStorage<T>::Iterate(const SubresourceRange& range, F&& iterateFunc) const {
+        ASSERT(range.baseArrayLayer + range.layerCount <= mArrayLayerCount);
+        ASSERT(range.baseMipLevel + range.levelCount <= mMipLevelCount);
+
+        if (mFullyCompressed) {
+            iterateFunc(range, mFullValue);
+            return;
+        }
+
+        for (uint32_t layer = range.baseArrayLayer; layer < range.baseArrayLayer + range.layerCount;
+             ++layer) {
+            if (mLayerCompressed[layer]) {
+                iterateFunc(
+                    SubresourceRange{range.baseMipLevel, range.levelCount, layer, 1},
+                    LayerData(layer));
+                continue;
+            }
+
+            for (uint32_t level = range.baseMipLevel;
+                 level < range.baseMipLevel + range.levelCount; ++level) {
+                iterateFunc(SubresourceRange::SingleSubresource(level, layer),
+                            DataAt(level, layer));
+            }
+        }
+    }
+
+    template <typename T>
+    template <typename F>
+    void SubresourceStorage<T>::Iterate(F&& iterateFunc) const {
+        Iterate(GetFullRange(), std::forward<F>(iterateFunc));
+    }
+
+    template <typename T>
+    void SubresourceStorage<T>::Fill(const SubresourceRange& range, const T& value) {
+        Update(range, [&value](const SubresourceRange&, T* data) { *data = value; });
+    }
+
+    template <typename T>
+    const T& SubresourceStorage<T>::Get(uint32_t mipLevel, uint32_t arrayLayer) const {
+        ASSERT(arrayLayer < mArrayLayerCount);
+        ASSERT(mipLevel < mMipLevelCount);
+
+        if (mFullyCompressed) {
+            return mFullValue;
+        }
+        if (mLayerCompressed[arrayLayer]) {
+            return LayerData(arrayLayer);
+        }
+        return DataAt(mipLevel, arrayLayer);
+    }
+
+    template <typename T>
+    uint32_t SubresourceStorage<T>::GetArrayLayerCount() const {
+        return mArrayLayerCount;
+    }
+
+    template <typename T>
+    uint32_t SubresourceStorage<T>::GetMipLevelCount() const {
+        return mMipLevelCount;
+    }
+
+    template <typename T>
+    bool SubresourceStorage<T>::IsFullyCompressedForTesting() const {
+        return mFullyCompressed;
+    }
+
+    template <typename T>
+    bool SubresourceStorage<T>::IsLayerCompressedForTesting(uint32_t arrayLayer) const {
+        return mFullyCompressed || mLayerCompressed[arrayLayer];
+    }
+
+    template <typename T>
+    SubresourceRange SubresourceStorage<T>::GetFullRange() const {
+        return {0, mMipLevelCount, 0, mArrayLayerCount};
+    }
+
+    template <typename T>
+    SubresourceRange SubresourceStorage<T>::GetFullLayerRange(uint32_t arrayLayer) const {
+        return {0, mMipLevelCount, arrayLayer, 1};
+    }
+
+    template <typename T>
+    bool SubresourceStorage<T>::CoversFullLayers(const SubresourceRange& range) const {
+        return range.baseMipLevel == 0 && range.levelCount == mMipLevelCount;
+    }
+
+    template <typename T>
+    void SubresourceStorage<T>::DecompressAll() {
+        ASSERT(mFullyCompressed);
+
+        if (mData == nullptr) {
+            mLayerCompressed = std::make_unique<bool[]>(mArrayLayerCount);
+            mData = std::make_unique<T[]>(mArrayLayerCount * mMipLevelCount);
+        }
+
+        for (uint32_t layer = 0; layer < mArrayLayerCount; ++layer) {
+            mLayerCompressed[layer] = true;
+            LayerData(layer) = mFullValue;
+        }
+        mFullyCompressed = false;
+    }
+
+    template <typename T>
+    void SubresourceStorage<T>::RecompressAllIfPossible() {
+        ASSERT(!mFullyCompressed);
+
+        const T& firstValue = LayerData(0);
+        for (uint32_t layer = 0; layer < mArrayLayerCount; ++layer) {
+            if (!mLayerCompressed[layer] || !(LayerData(layer) == firstValue)) {
+                return;
+            }
+        }
+
+        mFullValue = firstValue;
+        mFullyCompressed = true;
+    }
+
+    template <typename T>
+    void SubresourceStorage<T>::DecompressLayer(uint32_t arrayLayer) {
+        ASSERT(!mFullyCompressed);
+        if (!mLayerCompressed[arrayLayer]) {
+            return;
+        }
+
+        const T& layerValue = LayerData(arrayLayer);
+        for (uint32_t level = 1; level < mMipLevelCount; ++level) {
+            DataAt(level, arrayLayer) = layerValue;
+        }
+        mLayerCompressed[arrayLayer] = false;
+    }
+
+    template <typename T>
+    void SubresourceStorage<T>::RecompressLayerIfPossible(uint32_t arrayLayer) {
+        ASSERT(!mFullyCompressed);
+        ASSERT(!mLayerCompressed[arrayLayer]);
+
+        const T& layerValue = LayerData(arrayLayer);
+        for (uint32_t level = 1; level < mMipLevelCount; ++level) {
+            if (!(DataAt(level, arrayLayer) == layerValue)) {
+                return;
+            }
+        }
+        mLayerCompressed[arrayLayer] = true;
+    }
+
+    template <typename T>
+    T& SubresourceStorage<T>::LayerData(uint32_t arrayLayer) {
+        return DataAt(0, arrayLayer);
+    }
+
+    template <typename T>
+    const T& SubresourceStorage<T>::LayerData(uint32_t arrayLayer) const {
+        return DataAt(0, arrayLayer);
+    }
+
+    template <typename T>
+    T& SubresourceStorage<T>::DataAt(uint32_t mipLevel, uint32_t arrayLayer) {
+        ASSERT(mData != nullptr);
+        return mData[arrayLayer * mMipLevelCount + mipLevel];
+    }
+
+    template <typename T>
+    const T& SubresourceStorage<T>::DataAt(uint32_t mipLevel, uint32_t arrayLayer) const {
+        ASSERT(mData != nullptr);
+        return mData[arrayLayer * mMipLevelCount + mipLevel];
+    }
+
+}  // namespace dawn_native
+
+#endif  // DAWNNATIVE_SUBRESOURCESTORAGE_H_
@@ -17,6 +17,7 @@
 #include "common/Constants.h"
 #include "dawn_native/Adapter.h"
 #include "dawn_native/Device.h"
+#include "dawn_native/SubmitCoalescer.h"
 #include "dawn_native/Surface.h"
 #include "dawn_native/Texture.h"
 #include "dawn_native/ValidationUtils_autogen.h"
@@ -201,6 +202,10 @@ namespace dawn_native {
         }
         ASSERT(!IsError());
 
+        // The coalesced submits that render to the texture must happen before it is presented.
+        if (!GetDevice()->GetSubmitCoalescer()->Flush()) {
+            return;
+        }
         if (GetDevice()->ConsumedError(OnBeforePresent(mCurrentTexture.Get()))) {
             return;
         }
@@ -335,6 +340,10 @@ namespace dawn_native {
             return;
         }
 
+        // The coalesced submits that render to the texture must happen before it is presented.
+        if (!GetDevice()->GetSubmitCoalescer()->Flush()) {
+            return;
+        }
         if (GetDevice()->ConsumedError(PresentImpl())) {
             return;
         }
@@ -20,6 +20,7 @@
 #include "common/Constants.h"
 #include "common/Math.h"
 #include "dawn_native/Device.h"
+#include "dawn_native/SubmitCoalescer.h"
 #include "dawn_native/ValidationUtils_autogen.h"
 
 namespace dawn_native {
@@ -349,16 +350,14 @@ namespace dawn_native {
           mMipLevelCount(descriptor->mipLevelCount),
           mSampleCount(descriptor->sampleCount),
           mUsage(descriptor->usage),
-          mState(state) {
-        uint32_t subresourceCount =
-            GetSubresourceIndex(descriptor->mipLevelCount, descriptor->arrayLayerCount);
-        mIsSubresourceContentInitializedAtIndex = std::vector<bool>(subresourceCount, false);
+          mState(state),
+          mIsSubresourceContentInitialized(mArrayLayerCount, mMipLevelCount, false) {
     }
 
     static Format kUnusedFormat;
 
     TextureBase::TextureBase(DeviceBase* device, ObjectBase::ErrorTag tag)
-        : ObjectBase(device, tag), mFormat(kUnusedFormat) {
+        : ObjectBase(device, tag), mFormat(kUnusedFormat), mIsSubresourceContentInitialized(0, 0) {
     }
 
     // static
@@ -416,17 +415,13 @@ namespace dawn_native {
                                                       uint32_t baseArrayLayer,
                                                       uint32_t layerCount) const {
         ASSERT(!IsError());
-        for (uint32_t mipLevel = baseMipLevel; mipLevel < baseMipLevel + levelCount; ++mipLevel) {
-            for (uint32_t arrayLayer = baseArrayLayer; arrayLayer < baseArrayLayer + layerCount;
-                 ++arrayLayer) {
-                uint32_t subresourceIndex = GetSubresourceIndex(mipLevel, arrayLayer);
-                ASSERT(subresourceIndex < mIsSubresourceContentInitializedAtIndex.size());
-                if (!mIsSubresourceContentInitializedAtIndex[subresourceIndex]) {
-                    return false;
-                }
-            }
-        }
-        return true;
+        bool isInitialized = true;
+        mIsSubresourceContentInitialized.Iterate(
+            {baseMipLevel, levelCount, baseArrayLayer, layerCount},
+            [&isInitialized](const SubresourceRange&, bool isRangeInitialized) {
+                isInitialized &= isRangeInitialized;
+            });
+        return isInitialized;
     }
 
     void TextureBase::SetIsSubresourceContentInitialized(bool isInitialized,
@@ -435,14 +430,8 @@ namespace dawn_native {
                                                          uint32_t baseArrayLayer,
                                                          uint32_t layerCount) {
         ASSERT(!IsError());
-        for (uint32_t mipLevel = baseMipLevel; mipLevel < baseMipLevel + levelCount; ++mipLevel) {
-            for (uint32_t arrayLayer = baseArrayLayer; arrayLayer < baseArrayLayer + layerCount;
-                 ++arrayLayer) {
-                uint32_t subresourceIndex = GetSubresourceIndex(mipLevel, arrayLayer);
-                ASSERT(subresourceIndex < mIsSubresourceContentInitializedAtIndex.size());
-                mIsSubresourceContentInitializedAtIndex[subresourceIndex] = isInitialized;
-            }
-        }
+        mIsSubresourceContentInitialized.Fill(
+            {baseMipLevel, levelCount, baseArrayLayer, layerCount}, isInitialized);
     }
 
     MaybeError TextureBase::ValidateCanUseInSubmitNow() const {
@@ -491,6 +480,11 @@ namespace dawn_native {
             return;
         }
         ASSERT(!IsError());
+
+        // Coalesced submits that use the texture must be given to the backend while it exists.
+        if (!GetDevice()->GetSubmitCoalescer()->Flush()) {
+            return;
+        }
         DestroyInternal();
     }
 
@@ -18,6 +18,7 @@
 #include "dawn_native/Error.h"
 #include "dawn_native/Forward.h"
 #include "dawn_native/ObjectBase.h"
+#include "dawn_native/SubresourceStorage.h"
 
 #include "dawn_native/dawn_platform.h"
 
@@ -102,8 +103,7 @@ namespace dawn_native {
         wgpu::TextureUsage mUsage = wgpu::TextureUsage::None;
         TextureState mState;
 
-        // TODO(natlee@microsoft.com): Use a more optimized data structure to save space
-        std::vector<bool> mIsSubresourceContentInitializedAtIndex;
+        SubresourceStorage<bool> mIsSubresourceContentInitialized;
     };
 
     class TextureViewBase : public ObjectBase {
@@ -123,6 +123,37 @@ namespace dawn_native {
              {"use_d3d12_small_shader_visible_heap",
               "Enable use of a small D3D12 shader visible heap, instead of using a large one by "
               "default. This setting is used to test bindgroup encoding."}},
+            {Toggle::ElideRedundantCommands,
+             {"elide_redundant_commands",
+              "Drop commands that set pass state to the value it already has, like setting the "
+              "same pipeline or bind group twice, instead of recording them for the backends."}},
+            {Toggle::CoalesceQueueSubmits,
+             {"coalesce_queue_submits",
+              "Accumulate the command buffers of Queue::Submit calls and submit them to the "
+              "backend together when the device is ticked, a fence is signaled, a buffer is mapped "
+              "or written, a resource is destroyed, a swap chain presents, the error scope changes "
+              "or too many command buffers are pending. Submits are validated immediately, errors "
+              "of the deferred lazy clears and backend submits are reported to the error scope "
+              "that was current at Queue::Submit."}},
+            {Toggle::TickOnBackgroundThread,
+             {"tick_on_background_thread",
+              "Tick the device on an internal thread so that completed work is reclaimed without "
+              "the application calling Device::Tick. User callbacks are delivered at the next API "
+              "call on the device or at dawn_native::ProcessEvents."}},
+            {Toggle::UseNonAtomicRefCounts,
+             {"use_non_atomic_refcounts",
+              "Use plain integer reference counts for the objects of the device instead of atomic "
+              "ones. The device and its objects must then only be used from a single thread. "
+              "Ignored when the device is ticked on a background thread."}},
+            {Toggle::UseSpirvCrossReflection,
+             {"use_spirv_cross_reflection",
+              "Reflect the shader modules with spirv_cross instead of Dawn's SPIR-V reflector. "
+              "This is slower and only useful to compare the results of both reflections."}},
+            {Toggle::RecordShaderCompileStatistics,
+             {"record_shader_compile_statistics",
+              "Time the phases of the compilation of shaders for "
+              "dawn_native::GetShaderCompileStatistics. Trace events for the phases are recorded "
+              "even when this is disabled."}},
         }};
 
     }  // anonymous namespace
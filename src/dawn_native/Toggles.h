@@ -41,6 +41,12 @@ namespace dawn_native {
         DisableBaseVertex,
         DisableBaseInstance,
         UseD3D12SmallShaderVisibleHeapForTesting,
+        ElideRedundantCommands,
+        CoalesceQueueSubmits,
+        TickOnBackgroundThread,
+        UseNonAtomicRefCounts,
+        UseSpirvCrossReflection,
+        RecordShaderCompileStatistics,
 
         EnumCount,
         InvalidEnum = EnumCount,
@@ -0,0 +1,98 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn_native/WorkerPool.h"
+
+#include "common/Assert.h"
+
+namespace dawn_native {
+
+    WorkerPool::WorkerPool() {
+        // hardware_concurrency() may return 0 when it can't tell, in which case only the calling
+        // thread runs the tasks.
+        unsigned int threadCount = std::thread::hardware_concurrency();
+        for (unsigned int i = 1; i < threadCount; ++i) {
+            mWorkers.emplace_back([this]() { WorkerLoop(); });
+        }
+    }
+
+    WorkerPool::~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStopping = true;
+        }
+        mBatchStarted.notify_all();
+
+        for (std::thread& worker : mWorkers) {
+            worker.join();
+        }
+    }
+
+    void WorkerPool::ParallelFor(size_t count, const std::function<void(size_t)>& task) {
+        if (mWorkers.empty() || count <= 1) {
+            for (size_t i = 0; i < count; ++i) {
+                task(i);
+            }
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            ASSERT(mTask == nullptr);
+            mBatchSerial++;
+            mTask = &task;
+            mCount = count;
+            mNextIndex = 0;
+            mBusyWorkerCount = mWorkers.size();
+        }
+        mBatchStarted.notify_all();
+
+        RunTasks();
+
+        std::unique_lock<std::mutex> lock(mMutex);
+        mBatchFinished.wait(lock, [this]() { return mBusyWorkerCount == 0; });
+        mTask = nullptr;
+    }
+
+    void WorkerPool::WorkerLoop() {
+        uint64_t lastBatchSerial = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mBatchStarted.wait(
+                    lock, [&]() { return mStopping || mBatchSerial != lastBatchSerial; });
+                if (mStopping) {
+                    return;
+                }
+                lastBatchSerial = mBatchSerial;
+            }
+
+            RunTasks();
+
+            std::lock_guard<std::mutex> lock(mMutex);
+            ASSERT(mBusyWorkerCount > 0);
+            if (--mBusyWorkerCount == 0) {
+                mBatchFinished.notify_one();
+            }
+        }
+    }
+
+    void WorkerPool::RunTasks() {
+        // mTask and mCount don't change until all the workers are done with the batch.
+        for (size_t i = mNextIndex.fetch_add(1); i < mCount; i = mNextIndex.fetch_add(1)) {
+            (*mTask)(i);
+        }
+    }
+
+}  // namespace dawn_native
@@ -0,0 +1,65 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_WORKERPOOL_H_
+#define DAWNNATIVE_WORKERPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace dawn_native {
+
+    // WorkerPool runs batches of expensive CPU-only tasks on threads that it keeps for its whole
+    // lifetime, so that a batch doesn't pay for creating threads. There is one worker less than
+    // the number of hardware threads since the calling thread runs tasks too.
+    class WorkerPool {
+      public:
+        WorkerPool();
+        ~WorkerPool();
+
+        // Calls |task| once for each index in [0, count) and returns when all the calls returned.
+        // The calls are spread over the workers and the calling thread, in no particular order,
+        // so |task| must only touch state that is private to its index or thread-safe. Batches
+        // must not be run concurrently.
+        void ParallelFor(size_t count, const std::function<void(size_t)>& task);
+
+      private:
+        void WorkerLoop();
+        void RunTasks();
+
+        std::vector<std::thread> mWorkers;
+
+        std::mutex mMutex;
+        std::condition_variable mBatchStarted;
+        std::condition_variable mBatchFinished;
+        bool mStopping = false;
+
+        // The current batch. Each batch has a new serial so that the workers know that they
+        // haven't run it yet, and it finishes once all the workers are done with it.
+        uint64_t mBatchSerial = 0;
+        const std::function<void(size_t)>* mTask = nullptr;
+        size_t mCount = 0;
+        std::atomic<size_t> mNextIndex{0};
+        size_t mBusyWorkerCount = 0;
+    };
+
+}  // namespace dawn_native
+
+#endif  // DAWNNATIVE_WORKERPOOL_H_
@@ -132,11 +132,13 @@ namespace dawn_native { namespace d3d12 {
 
     BindGroup* BindGroupLayout::AllocateBindGroup(Device* device,
                                                   const BindGroupDescriptor* descriptor) {
+        device->GetObjectPoolCounters()->AddAllocation(PooledObjectType::BindGroup);
         return mBindGroupAllocator.Allocate(device, descriptor);
     }
 
     void BindGroupLayout::DeallocateBindGroup(BindGroup* bindGroup) {
         mBindGroupAllocator.Deallocate(bindGroup);
+        GetDevice()->GetObjectPoolCounters()->AddDeallocation(PooledObjectType::BindGroup);
     }
 
     const std::array<uint32_t, kMaxBindingsPerGroup>& BindGroupLayout::GetBindingOffsets() const {
@@ -477,6 +477,10 @@ namespace dawn_native { namespace d3d12 {
         FreeCommands(&mCommands);
     }
 
+    void CommandBuffer::DeleteThis() {
+        ToBackend(GetDevice())->GetCommandBufferPool()->Free(this);
+    }
+
     MaybeError CommandBuffer::RecordCommands(CommandRecordingContext* commandContext) {
         Device* device = ToBackend(GetDevice());
         BindGroupStateTracker bindingTracker(device);
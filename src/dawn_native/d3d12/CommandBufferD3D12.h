@@ -16,6 +16,7 @@
 #define DAWNNATIVE_D3D12_COMMANDBUFFERD3D12_H_
 
 #include "common/Constants.h"
+#include "common/PlacementAllocated.h"
 #include "dawn_native/CommandAllocator.h"
 #include "dawn_native/CommandBuffer.h"
 #include "dawn_native/Error.h"
@@ -44,7 +45,7 @@ namespace dawn_native { namespace d3d12 {
     class RenderPassBuilder;
     class RenderPipeline;
 
-    class CommandBuffer : public CommandBufferBase {
+    class CommandBuffer : public CommandBufferBase, public PlacementAllocated {
       public:
         CommandBuffer(CommandEncoder* encoder, const CommandBufferDescriptor* descriptor);
         ~CommandBuffer();
@@ -52,6 +53,8 @@ namespace dawn_native { namespace d3d12 {
         MaybeError RecordCommands(CommandRecordingContext* commandContext);
 
       private:
+        void DeleteThis() override;
+
         MaybeError RecordComputePass(CommandRecordingContext* commandContext,
                                      BindGroupStateTracker* bindingTracker);
         MaybeError RecordRenderPass(CommandRecordingContext* commandContext,
@@ -15,6 +15,7 @@
 #include "dawn_native/d3d12/ComputePipelineD3D12.h"
 
 #include "common/Assert.h"
+#include "dawn_native/ShaderCompileTracker.h"
 #include "dawn_native/d3d12/DeviceD3D12.h"
 #include "dawn_native/d3d12/PipelineLayoutD3D12.h"
 #include "dawn_native/d3d12/PlatformFunctions.h"
@@ -49,11 +50,16 @@ namespace dawn_native { namespace d3d12 {
         ComPtr<ID3DBlob> errors;
 
         const PlatformFunctions* functions = device->GetFunctions();
-        if (FAILED(functions->d3dCompile(hlslSource.c_str(), hlslSource.length(), nullptr, nullptr,
-                                         nullptr, descriptor->computeStage.entryPoint, "cs_5_1",
-                                         compileFlags, 0, &compiledShader, &errors))) {
-            printf("%s\n", reinterpret_cast<char*>(errors->GetBufferPointer()));
-            ASSERT(false);
+        {
+            ScopedShaderCompileTimer timer(device, ShaderCompilePhase::BackendCompilation,
+                                           {module});
+            if (FAILED(functions->d3dCompile(hlslSource.c_str(), hlslSource.length(), nullptr,
+                                             nullptr, nullptr, descriptor->computeStage.entryPoint,
+                                             "cs_5_1", compileFlags, 0, &compiledShader,
+                                             &errors))) {
+                printf("%s\n", reinterpret_cast<char*>(errors->GetBufferPointer()));
+                ASSERT(false);
+            }
         }
 
         D3D12_COMPUTE_PIPELINE_STATE_DESC d3dDesc = {};
@@ -25,15 +25,15 @@ namespace dawn_native { namespace d3d12 {
         std::string message = std::string(context) + " failed with " + std::to_string(result);
 
         if (result == DXGI_ERROR_DEVICE_REMOVED) {
-            return DAWN_DEVICE_LOST_ERROR(message);
+            return DAWN_MAKE_ERROR_FROM_STRING(InternalErrorType::DeviceLost, message);
         } else {
-            return DAWN_INTERNAL_ERROR(message);
+            return DAWN_MAKE_ERROR_FROM_STRING(InternalErrorType::Internal, message);
         }
     }
 
     MaybeError CheckOutOfMemoryHRESULT(HRESULT result, const char* context) {
         if (result == E_OUTOFMEMORY) {
-            return DAWN_OUT_OF_MEMORY_ERROR(context);
+            return DAWN_MAKE_ERROR_FROM_STRING(InternalErrorType::OutOfMemory, context);
         }
         return CheckHRESULT(result, context);
     }
@@ -41,10 +41,14 @@
 #include "dawn_native/d3d12/SwapChainD3D12.h"
 #include "dawn_native/d3d12/TextureD3D12.h"
 
+#include <algorithm>
+
 namespace dawn_native { namespace d3d12 {
 
     Device::Device(Adapter* adapter, const DeviceDescriptor* descriptor)
-        : DeviceBase(adapter, descriptor) {
+        : DeviceBase(adapter, descriptor),
+          mCommandBufferPool(GetObjectPoolCounters(), PooledObjectType::CommandBuffer),
+          mTextureViewPool(GetObjectPoolCounters(), PooledObjectType::TextureView) {
         InitTogglesFromDriver();
         if (descriptor != nullptr) {
             ApplyToggleOverrides(descriptor);
@@ -160,6 +164,14 @@ namespace dawn_native { namespace d3d12 {
         return mMapRequestTracker.get();
     }
 
+    ObjectPool<CommandBuffer>* Device::GetCommandBufferPool() {
+        return &mCommandBufferPool;
+    }
+
+    ObjectPool<TextureView>* Device::GetTextureViewPool() {
+        return &mTextureViewPool;
+    }
+
     CommandAllocatorManager* Device::GetCommandAllocatorManager() const {
         return mCommandAllocatorManager.get();
     }
@@ -223,6 +235,46 @@ namespace dawn_native { namespace d3d12 {
         return {};
     }
 
+    ResultOrError<bool> Device::WaitForCompletionImpl(Serial serial, uint64_t timeoutNs) {
+        mCompletedSerial = mFence->GetCompletedValue();
+        if (mCompletedSerial >= serial) {
+            return true;
+        }
+
+        // Use a new event for timed waits so that a wait that timed out can't leave mFenceEvent
+        // signaled for the next WaitForSerial.
+        HANDLE event = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+        if (event == nullptr) {
+            return DAWN_OUT_OF_MEMORY_ERROR("Failed to create the D3D12 fence event");
+        }
+
+        MaybeError setEvent = CheckHRESULT(mFence->SetEventOnCompletion(serial, event),
+                                           "D3D12 set event on completion");
+        if (setEvent.IsError()) {
+            ::CloseHandle(event);
+            return setEvent.AcquireError();
+        }
+
+        DWORD timeoutMs = INFINITE;
+        if (timeoutNs != kWaitTimeoutInfinite) {
+            // Round up so that short timeouts still wait instead of polling.
+            uint64_t ms = (timeoutNs + 999999) / 1000000;
+            timeoutMs = static_cast<DWORD>(std::min<uint64_t>(ms, INFINITE - 1));
+        }
+        DWORD waitResult = WaitForSingleObject(event, timeoutMs);
+        ::CloseHandle(event);
+
+        if (waitResult == WAIT_TIMEOUT) {
+            return false;
+        }
+        if (waitResult != WAIT_OBJECT_0) {
+            return DAWN_DEVICE_LOST_ERROR("Failed to wait for the D3D12 fence");
+        }
+
+        mCompletedSerial = mFence->GetCompletedValue();
+        return mCompletedSerial >= serial;
+    }
+
     void Device::ReferenceUntilUnused(ComPtr<IUnknown> object) {
         mUsedComObjectRefs.Enqueue(object, GetPendingCommandSerial());
     }
@@ -246,7 +298,7 @@ namespace dawn_native { namespace d3d12 {
     }
     CommandBufferBase* Device::CreateCommandBuffer(CommandEncoder* encoder,
                                                    const CommandBufferDescriptor* descriptor) {
-        return new CommandBuffer(encoder, descriptor);
+        return mCommandBufferPool.Allocate(encoder, descriptor);
     }
     ResultOrError<ComputePipelineBase*> Device::CreateComputePipelineImpl(
         const ComputePipelineDescriptor* descriptor) {
@@ -286,7 +338,7 @@ namespace dawn_native { namespace d3d12 {
     ResultOrError<TextureViewBase*> Device::CreateTextureViewImpl(
         TextureBase* texture,
         const TextureViewDescriptor* descriptor) {
-        return new TextureView(texture, descriptor);
+        return mTextureViewPool.Allocate(texture, descriptor);
     }
 
     ResultOrError<std::unique_ptr<StagingBufferBase>> Device::CreateStagingBuffer(size_t size) {
@@ -52,6 +52,8 @@ namespace dawn_native { namespace d3d12 {
 
         CommandBufferBase* CreateCommandBuffer(CommandEncoder* encoder,
                                                const CommandBufferDescriptor* descriptor) override;
+        ObjectPool<CommandBuffer>* GetCommandBufferPool();
+        ObjectPool<TextureView>* GetTextureViewPool();
 
         Serial GetCompletedCommandSerial() const final override;
         Serial GetLastSubmittedCommandSerial() const final override;
@@ -140,6 +142,7 @@ namespace dawn_native { namespace d3d12 {
 
         void Destroy() override;
         MaybeError WaitForIdleForDestruction() override;
+        ResultOrError<bool> WaitForCompletionImpl(Serial serial, uint64_t timeoutNs) override;
 
         Serial mCompletedSerial = 0;
         Serial mLastSubmittedSerial = 0;
@@ -168,6 +171,9 @@ namespace dawn_native { namespace d3d12 {
         std::unique_ptr<ResourceAllocatorManager> mResourceAllocatorManager;
         std::unique_ptr<ResidencyManager> mResidencyManager;
         std::unique_ptr<ShaderVisibleDescriptorAllocator> mShaderVisibleDescriptorAllocator;
+
+        ObjectPool<CommandBuffer> mCommandBufferPool;
+        ObjectPool<TextureView> mTextureViewPool;
     };
 
 }}  // namespace dawn_native::d3d12
@@ -17,6 +17,7 @@
 #include "dawn_native/d3d12/CommandBufferD3D12.h"
 #include "dawn_native/d3d12/D3D12Error.h"
 #include "dawn_native/d3d12/DeviceD3D12.h"
+#include "dawn_native/d3d12/TextureD3D12.h"
 #include "dawn_platform/DawnPlatform.h"
 #include "dawn_platform/tracing/TraceEvent.h"
 
@@ -47,4 +48,18 @@ namespace dawn_native { namespace d3d12 {
         return {};
     }
 
+    MaybeError Queue::LazyClearTexturesImpl(const std::vector<TextureBase*>& textures) {
+        Device* device = ToBackend(GetDevice());
+
+        CommandRecordingContext* commandContext;
+        DAWN_TRY_ASSIGN(commandContext, device->GetPendingCommandContext());
+
+        TRACE_EVENT0(GetDevice()->GetPlatform(), Recording, "Queue::LazyClearTextures");
+        for (TextureBase* texture : textures) {
+            ToBackend(texture)->EnsureSubresourceContentInitialized(
+                commandContext, 0, texture->GetNumMipLevels(), 0, texture->GetArrayLayers());
+        }
+        return {};
+    }
+
 }}  // namespace dawn_native::d3d12
@@ -31,6 +31,7 @@ namespace dawn_native { namespace d3d12 {
 
       private:
         MaybeError SubmitImpl(uint32_t commandCount, CommandBufferBase* const* commands) override;
+        MaybeError LazyClearTexturesImpl(const std::vector<TextureBase*>& textures) override;
     };
 
 }}  // namespace dawn_native::d3d12
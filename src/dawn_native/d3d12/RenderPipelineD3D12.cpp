@@ -16,6 +16,7 @@
 
 #include "common/Assert.h"
 #include "common/Log.h"
+#include "dawn_native/ShaderCompileTracker.h"
 #include "dawn_native/d3d12/D3D12Error.h"
 #include "dawn_native/d3d12/DeviceD3D12.h"
 #include "dawn_native/d3d12/PipelineLayoutD3D12.h"
@@ -341,6 +342,8 @@ namespace dawn_native { namespace d3d12 {
             std::string hlslSource;
             DAWN_TRY_ASSIGN(hlslSource, module->GetHLSLSource(ToBackend(GetLayout())));
 
+            ScopedShaderCompileTimer timer(device, ShaderCompilePhase::BackendCompilation,
+                                           {module});
             const PlatformFunctions* functions = device->GetFunctions();
             MaybeError error = CheckHRESULT(
                 functions->d3dCompile(hlslSource.c_str(), hlslSource.length(), nullptr, nullptr,
@@ -16,6 +16,7 @@
 
 #include "common/Assert.h"
 #include "common/BitSetIterator.h"
+#include "dawn_native/ShaderCompileTracker.h"
 #include "dawn_native/d3d12/BindGroupLayoutD3D12.h"
 #include "dawn_native/d3d12/DeviceD3D12.h"
 #include "dawn_native/d3d12/PipelineLayoutD3D12.h"
@@ -55,19 +56,14 @@ namespace dawn_native { namespace d3d12 {
             DAWN_TRY(CheckSpvcSuccess(
                 mSpvcContext.InitializeForHlsl(descriptor->code, descriptor->codeSize, options),
                 "Unable to initialize instance of spvc"));
-
-            spirv_cross::Compiler* compiler;
-            DAWN_TRY(CheckSpvcSuccess(mSpvcContext.GetCompiler(reinterpret_cast<void**>(&compiler)),
-                                      "Unable to get cross compiler"));
-            DAWN_TRY(ExtractSpirvInfo(*compiler));
-        } else {
-            spirv_cross::CompilerHLSL compiler(descriptor->code, descriptor->codeSize);
-            DAWN_TRY(ExtractSpirvInfo(compiler));
         }
+        DAWN_TRY(ExtractSpirvInfo());
         return {};
     }
 
     ResultOrError<std::string> ShaderModule::GetHLSLSource(PipelineLayout* layout) {
+        ScopedShaderCompileTimer timer(GetDevice(), ShaderCompilePhase::Translation, {this});
+
         std::unique_ptr<spirv_cross::CompilerHLSL> compiler_impl;
         spirv_cross::CompilerHLSL* compiler;
         if (!GetDevice()->IsToggleEnabled(Toggle::UseSpvc)) {
@@ -807,6 +807,10 @@ namespace dawn_native { namespace d3d12 {
         }
     }
 
+    void TextureView::DeleteThis() {
+        ToBackend(GetDevice())->GetTextureViewPool()->Free(this);
+    }
+
     DXGI_FORMAT TextureView::GetD3D12Format() const {
         return D3D12TextureFormat(GetFormat().format);
     }
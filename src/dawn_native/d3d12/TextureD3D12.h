@@ -15,6 +15,7 @@
 #ifndef DAWNNATIVE_D3D12_TEXTURED3D12_H_
 #define DAWNNATIVE_D3D12_TEXTURED3D12_H_
 
+#include "common/PlacementAllocated.h"
 #include "common/Serial.h"
 #include "dawn_native/Texture.h"
 
@@ -108,7 +109,7 @@ namespace dawn_native { namespace d3d12 {
         ComPtr<IDXGIKeyedMutex> mDxgiKeyedMutex;
     };
 
-    class TextureView : public TextureViewBase {
+    class TextureView : public TextureViewBase, public PlacementAllocated {
       public:
         TextureView(TextureBase* texture, const TextureViewDescriptor* descriptor);
 
@@ -119,6 +120,8 @@ namespace dawn_native { namespace d3d12 {
         D3D12_DEPTH_STENCIL_VIEW_DESC GetDSVDescriptor() const;
 
       private:
+        void DeleteThis() override;
+
         D3D12_SHADER_RESOURCE_VIEW_DESC mSrvDesc;
     };
 }}  // namespace dawn_native::d3d12
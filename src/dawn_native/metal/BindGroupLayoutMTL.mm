@@ -15,6 +15,7 @@
 #include "dawn_native/metal/BindGroupLayoutMTL.h"
 
 #include "dawn_native/metal/BindGroupMTL.h"
+#include "dawn_native/metal/DeviceMTL.h"
 
 namespace dawn_native { namespace metal {
 
@@ -26,11 +27,13 @@ namespace dawn_native { namespace metal {
 
     BindGroup* BindGroupLayout::AllocateBindGroup(Device* device,
                                                   const BindGroupDescriptor* descriptor) {
+        device->GetObjectPoolCounters()->AddAllocation(PooledObjectType::BindGroup);
         return mBindGroupAllocator.Allocate(device, descriptor);
     }
 
     void BindGroupLayout::DeallocateBindGroup(BindGroup* bindGroup) {
         mBindGroupAllocator.Deallocate(bindGroup);
+        GetDevice()->GetObjectPoolCounters()->AddDeallocation(PooledObjectType::BindGroup);
     }
 
 }}  // namespace dawn_native::metal
@@ -15,6 +15,7 @@
 #ifndef DAWNNATIVE_METAL_COMMANDBUFFERMTL_H_
 #define DAWNNATIVE_METAL_COMMANDBUFFERMTL_H_
 
+#include "common/PlacementAllocated.h"
 #include "dawn_native/CommandAllocator.h"
 #include "dawn_native/CommandBuffer.h"
 
@@ -29,7 +30,7 @@ namespace dawn_native { namespace metal {
     class CommandRecordingContext;
     class Device;
 
-    class CommandBuffer : public CommandBufferBase {
+    class CommandBuffer : public CommandBufferBase, public PlacementAllocated {
       public:
         CommandBuffer(CommandEncoder* encoder, const CommandBufferDescriptor* descriptor);
         ~CommandBuffer();
@@ -37,6 +38,8 @@ namespace dawn_native { namespace metal {
         void FillCommands(CommandRecordingContext* commandContext);
 
       private:
+        void DeleteThis() override;
+
         void EncodeComputePass(CommandRecordingContext* commandContext);
         void EncodeRenderPass(CommandRecordingContext* commandContext,
                               MTLRenderPassDescriptor* mtlRenderPass,
@@ -680,6 +680,10 @@ namespace dawn_native { namespace metal {
         FreeCommands(&mCommands);
     }
 
+    void CommandBuffer::DeleteThis() {
+        ToBackend(GetDevice())->GetCommandBufferPool()->Free(this);
+    }
+
     void CommandBuffer::FillCommands(CommandRecordingContext* commandContext) {
         const std::vector<PassResourceUsage>& passResourceUsages = GetResourceUsages().perPass;
         size_t nextPassNumber = 0;
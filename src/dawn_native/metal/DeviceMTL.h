@@ -27,6 +27,7 @@
 #import <QuartzCore/QuartzCore.h>
 
 #include <atomic>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 
@@ -41,6 +42,8 @@ namespace dawn_native { namespace metal {
 
         CommandBufferBase* CreateCommandBuffer(CommandEncoder* encoder,
                                                const CommandBufferDescriptor* descriptor) override;
+        ObjectPool<CommandBuffer>* GetCommandBufferPool();
+        ObjectPool<TextureView>* GetTextureViewPool();
 
         Serial GetCompletedCommandSerial() const final override;
         Serial GetLastSubmittedCommandSerial() const final override;
@@ -97,6 +100,7 @@ namespace dawn_native { namespace metal {
         void InitTogglesFromDriver();
         void Destroy() override;
         MaybeError WaitForIdleForDestruction() override;
+        ResultOrError<bool> WaitForCompletionImpl(Serial serial, uint64_t timeoutNs) override;
 
         id<MTLDevice> mMtlDevice = nil;
         id<MTLCommandQueue> mCommandQueue = nil;
@@ -109,10 +113,18 @@ namespace dawn_native { namespace metal {
         // different thread, so it needs to be atomic.
         std::atomic<uint64_t> mCompletedSerial;
 
+        // Signaled by the completion handler so that WaitForCompletionImpl can block until a
+        // serial is completed instead of polling.
+        std::mutex mCompletedSerialMutex;
+        std::condition_variable mCompletedSerialCondition;
+
         // mLastSubmittedCommands will be accessed in a Metal schedule handler that can be fired on
         // a different thread so we guard access to it with a mutex.
         std::mutex mLastSubmittedCommandsMutex;
         id<MTLCommandBuffer> mLastSubmittedCommands = nil;
+
+        ObjectPool<CommandBuffer> mCommandBufferPool;
+        ObjectPool<TextureView> mTextureViewPool;
     };
 
 }}  // namespace dawn_native::metal
@@ -34,6 +34,7 @@
 #include "dawn_platform/DawnPlatform.h"
 #include "dawn_platform/tracing/TraceEvent.h"
 
+#include <chrono>
 #include <type_traits>
 
 namespace dawn_native { namespace metal {
@@ -44,7 +45,9 @@ namespace dawn_native { namespace metal {
         : DeviceBase(adapter, descriptor),
           mMtlDevice([mtlDevice retain]),
           mMapTracker(new MapRequestTracker(this)),
-          mCompletedSerial(0) {
+          mCompletedSerial(0),
+          mCommandBufferPool(GetObjectPoolCounters(), PooledObjectType::CommandBuffer),
+          mTextureViewPool(GetObjectPoolCounters(), PooledObjectType::TextureView) {
         [mMtlDevice retain];
         mCommandQueue = [mMtlDevice newCommandQueue];
 
@@ -105,7 +108,7 @@ namespace dawn_native { namespace metal {
     }
     CommandBufferBase* Device::CreateCommandBuffer(CommandEncoder* encoder,
                                                    const CommandBufferDescriptor* descriptor) {
-        return new CommandBuffer(encoder, descriptor);
+        return mCommandBufferPool.Allocate(encoder, descriptor);
     }
     ResultOrError<ComputePipelineBase*> Device::CreateComputePipelineImpl(
         const ComputePipelineDescriptor* descriptor) {
@@ -145,7 +148,7 @@ namespace dawn_native { namespace metal {
     ResultOrError<TextureViewBase*> Device::CreateTextureViewImpl(
         TextureBase* texture,
         const TextureViewDescriptor* descriptor) {
-        return new TextureView(texture, descriptor);
+        return mTextureViewPool.Allocate(texture, descriptor);
     }
 
     Serial Device::GetCompletedCommandSerial() const {
@@ -235,7 +238,11 @@ namespace dawn_native { namespace metal {
             TRACE_EVENT_ASYNC_END0(GetPlatform(), GPUWork, "DeviceMTL::SubmitPendingCommandBuffer",
                                    pendingSerial);
             ASSERT(pendingSerial > mCompletedSerial.load());
-            this->mCompletedSerial = pendingSerial;
+            {
+                std::lock_guard<std::mutex> lock(mCompletedSerialMutex);
+                this->mCompletedSerial = pendingSerial;
+            }
+            mCompletedSerialCondition.notify_all();
         }];
 
         TRACE_EVENT_ASYNC_BEGIN0(GetPlatform(), GPUWork, "DeviceMTL::SubmitPendingCommandBuffer",
@@ -248,6 +255,14 @@ namespace dawn_native { namespace metal {
         return mMapTracker.get();
     }
 
+    ObjectPool<CommandBuffer>* Device::GetCommandBufferPool() {
+        return &mCommandBufferPool;
+    }
+
+    ObjectPool<TextureView>* Device::GetTextureViewPool() {
+        return &mTextureViewPool;
+    }
+
     ResultOrError<std::unique_ptr<StagingBufferBase>> Device::CreateStagingBuffer(size_t size) {
         std::unique_ptr<StagingBufferBase> stagingBuffer =
             std::make_unique<StagingBuffer>(size, this);
@@ -291,6 +306,18 @@ namespace dawn_native { namespace metal {
         [mLastSubmittedCommands waitUntilScheduled];
     }
 
+    ResultOrError<bool> Device::WaitForCompletionImpl(Serial serial, uint64_t timeoutNs) {
+        auto IsCompleted = [this, serial]() { return mCompletedSerial.load() >= serial; };
+
+        std::unique_lock<std::mutex> lock(mCompletedSerialMutex);
+        if (timeoutNs == kWaitTimeoutInfinite) {
+            mCompletedSerialCondition.wait(lock, IsCompleted);
+            return true;
+        }
+        return mCompletedSerialCondition.wait_for(lock, std::chrono::nanoseconds(timeoutNs),
+                                                  IsCompleted);
+    }
+
     MaybeError Device::WaitForIdleForDestruction() {
         [mCommandContext.AcquireCommands() release];
 
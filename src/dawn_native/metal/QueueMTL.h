@@ -28,6 +28,7 @@ namespace dawn_native { namespace metal {
 
       private:
         MaybeError SubmitImpl(uint32_t commandCount, CommandBufferBase* const* commands) override;
+        MaybeError LazyClearTexturesImpl(const std::vector<TextureBase*>& textures) override;
     };
 
 }}  // namespace dawn_native::metal
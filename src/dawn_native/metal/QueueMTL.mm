@@ -16,6 +16,7 @@
 
 #include "dawn_native/metal/CommandBufferMTL.h"
 #include "dawn_native/metal/DeviceMTL.h"
+#include "dawn_native/metal/TextureMTL.h"
 #include "dawn_platform/DawnPlatform.h"
 #include "dawn_platform/tracing/TraceEvent.h"
 
@@ -39,4 +40,13 @@ namespace dawn_native { namespace metal {
         return {};
     }
 
+    MaybeError Queue::LazyClearTexturesImpl(const std::vector<TextureBase*>& textures) {
+        TRACE_EVENT0(GetDevice()->GetPlatform(), Recording, "Queue::LazyClearTextures");
+        for (TextureBase* texture : textures) {
+            ToBackend(texture)->EnsureSubresourceContentInitialized(
+                0, texture->GetNumMipLevels(), 0, texture->GetArrayLayers());
+        }
+        return {};
+    }
+
 }}  // namespace dawn_native::metal
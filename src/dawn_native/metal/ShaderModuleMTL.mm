@@ -15,6 +15,7 @@
 #include "dawn_native/metal/ShaderModuleMTL.h"
 
 #include "dawn_native/BindGroupLayout.h"
+#include "dawn_native/ShaderCompileTracker.h"
 #include "dawn_native/metal/DeviceMTL.h"
 #include "dawn_native/metal/PipelineLayoutMTL.h"
 
@@ -76,15 +77,8 @@ namespace dawn_native { namespace metal {
             DAWN_TRY(CheckSpvcSuccess(
                 mSpvcContext.InitializeForMsl(descriptor->code, descriptor->codeSize, options),
                 "Unable to initialize instance of spvc"));
-
-            spirv_cross::CompilerMSL* compiler;
-            DAWN_TRY(CheckSpvcSuccess(mSpvcContext.GetCompiler(reinterpret_cast<void**>(&compiler)),
-                                      "Unable to get cross compiler"));
-            DAWN_TRY(ExtractSpirvInfo(*compiler));
-        } else {
-            spirv_cross::CompilerMSL compiler(mSpirv);
-            DAWN_TRY(ExtractSpirvInfo(compiler));
         }
+        DAWN_TRY(ExtractSpirvInfo());
         return {};
     }
 
@@ -186,6 +180,8 @@ namespace dawn_native { namespace metal {
             // by default.
             NSString* mslSource;
             if (GetDevice()->IsToggleEnabled(Toggle::UseSpvc)) {
+                ScopedShaderCompileTimer timer(GetDevice(), ShaderCompilePhase::Translation,
+                                               {this});
                 shaderc_spvc::CompilationResult result;
                 DAWN_TRY(CheckSpvcSuccess(mSpvcContext.CompileShader(&result),
                                           "Unable to compile MSL shader"));
@@ -194,14 +190,19 @@ namespace dawn_native { namespace metal {
                                           "Unable to get MSL shader text"));
                 mslSource = [NSString stringWithFormat:@"%s", result_str.c_str()];
             } else {
+                ScopedShaderCompileTimer timer(GetDevice(), ShaderCompilePhase::Translation,
+                                               {this});
                 std::string msl = compiler->compile();
                 mslSource = [NSString stringWithFormat:@"%s", msl.c_str()];
             }
             auto mtlDevice = ToBackend(GetDevice())->GetMTLDevice();
             NSError* error = nil;
-            id<MTLLibrary> library = [mtlDevice newLibraryWithSource:mslSource
-                                                             options:nil
-                                                               error:&error];
+            id<MTLLibrary> library = nil;
+            {
+                ScopedShaderCompileTimer timer(GetDevice(), ShaderCompilePhase::BackendCompilation,
+                                               {this});
+                library = [mtlDevice newLibraryWithSource:mslSource options:nil error:&error];
+            }
             if (error != nil) {
                 // TODO(cwallez@chromium.org): Switch that NSLog to use dawn::InfoLog or even be
                 // folded in the DAWN_VALIDATION_ERROR
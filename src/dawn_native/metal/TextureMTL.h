@@ -17,6 +17,8 @@
 
 #include "dawn_native/Texture.h"
 
+#include "common/PlacementAllocated.h"
+
 #include <IOSurface/IOSurfaceRef.h>
 #import <Metal/Metal.h>
 #include "dawn_native/DawnNative.h"
@@ -60,7 +62,7 @@ namespace dawn_native { namespace metal {
         id<MTLTexture> mMtlTexture = nil;
     };
 
-    class TextureView : public TextureViewBase {
+    class TextureView : public TextureViewBase, public PlacementAllocated {
       public:
         TextureView(TextureBase* texture, const TextureViewDescriptor* descriptor);
         ~TextureView();
@@ -68,6 +70,8 @@ namespace dawn_native { namespace metal {
         id<MTLTexture> GetMTLTexture();
 
       private:
+        void DeleteThis() override;
+
         id<MTLTexture> mMtlTextureView = nil;
     };
 
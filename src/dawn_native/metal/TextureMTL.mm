@@ -586,6 +586,10 @@ namespace dawn_native { namespace metal {
         [mMtlTextureView release];
     }
 
+    void TextureView::DeleteThis() {
+        ToBackend(GetDevice())->GetTextureViewPool()->Free(this);
+    }
+
     id<MTLTexture> TextureView::GetMTLTexture() {
         ASSERT(mMtlTextureView != nil);
         return mMtlTextureView;
@@ -21,8 +21,6 @@
 #include "dawn_native/Instance.h"
 #include "dawn_native/Surface.h"
 
-#include <spirv_cross.hpp>
-
 namespace dawn_native { namespace null {
 
     // Implementation of pre-Device objects: the null adapter, null backend connection and Connect()
@@ -79,7 +77,9 @@ namespace dawn_native { namespace null {
     // Device
 
     Device::Device(Adapter* adapter, const DeviceDescriptor* descriptor)
-        : DeviceBase(adapter, descriptor) {
+        : DeviceBase(adapter, descriptor),
+          mCommandBufferPool(GetObjectPoolCounters(), PooledObjectType::CommandBuffer),
+          mTextureViewPool(GetObjectPoolCounters(), PooledObjectType::TextureView) {
         // Apply toggle overrides if necessary for test
         if (descriptor != nullptr) {
             ApplyToggleOverrides(descriptor);
@@ -107,7 +107,7 @@ namespace dawn_native { namespace null {
     }
     CommandBufferBase* Device::CreateCommandBuffer(CommandEncoder* encoder,
                                                    const CommandBufferDescriptor* descriptor) {
-        return new CommandBuffer(encoder, descriptor);
+        return mCommandBufferPool.Allocate(encoder, descriptor);
     }
     ResultOrError<ComputePipelineBase*> Device::CreateComputePipelineImpl(
         const ComputePipelineDescriptor* descriptor) {
@@ -140,17 +140,8 @@ namespace dawn_native { namespace null {
             if (status != shaderc_spvc_status_success) {
                 return DAWN_VALIDATION_ERROR("Unable to initialize instance of spvc");
             }
-
-            spirv_cross::Compiler* compiler;
-            status = context->GetCompiler(reinterpret_cast<void**>(&compiler));
-            if (status != shaderc_spvc_status_success) {
-                return DAWN_VALIDATION_ERROR("Unable to get cross compiler");
-            }
-            DAWN_TRY(module->ExtractSpirvInfo(*compiler));
-        } else {
-            spirv_cross::Compiler compiler(descriptor->code, descriptor->codeSize);
-            DAWN_TRY(module->ExtractSpirvInfo(compiler));
         }
+        DAWN_TRY(module->ExtractSpirvInfo());
         return module;
     }
     ResultOrError<SwapChainBase*> Device::CreateSwapChainImpl(
@@ -169,7 +160,7 @@ namespace dawn_native { namespace null {
     ResultOrError<TextureViewBase*> Device::CreateTextureViewImpl(
         TextureBase* texture,
         const TextureViewDescriptor* descriptor) {
-        return new TextureView(texture, descriptor);
+        return mTextureViewPool.Allocate(texture, descriptor);
     }
 
     ResultOrError<std::unique_ptr<StagingBufferBase>> Device::CreateStagingBuffer(size_t size) {
@@ -191,6 +182,15 @@ namespace dawn_native { namespace null {
         return {};
     }
 
+    ResultOrError<bool> Device::WaitForCompletionImpl(Serial serial, uint64_t) {
+        // There is no GPU to wait for: the simulated work completes as soon as the pending
+        // operations are submitted.
+        while (mCompletedSerial < serial) {
+            SubmitPendingOperations();
+        }
+        return true;
+    }
+
     MaybeError Device::CopyFromStagingToBuffer(StagingBufferBase* source,
                                                uint64_t sourceOffset,
                                                BufferBase* destination,
@@ -222,6 +222,14 @@ namespace dawn_native { namespace null {
         mMemoryUsage -= bytes;
     }
 
+    ObjectPool<CommandBuffer>* Device::GetCommandBufferPool() {
+        return &mCommandBufferPool;
+    }
+
+    ObjectPool<TextureView>* Device::GetTextureViewPool() {
+        return &mTextureViewPool;
+    }
+
     Serial Device::GetCompletedCommandSerial() const {
         return mCompletedSerial;
     }
@@ -236,6 +244,7 @@ namespace dawn_native { namespace null {
 
     MaybeError Device::TickImpl() {
         SubmitPendingOperations();
+        mDynamicUploader->Deallocate(mCompletedSerial);
         return {};
     }
 
@@ -243,6 +252,11 @@ namespace dawn_native { namespace null {
         mPendingOperations.emplace_back(std::move(operation));
     }
     void Device::SubmitPendingOperations() {
+        if (mSubmitsPaused) {
+            mCompletedSerial = mLastSubmittedSerial;
+            return;
+        }
+
         for (auto& operation : mPendingOperations) {
             operation->Execute();
         }
@@ -252,6 +266,10 @@ namespace dawn_native { namespace null {
         mLastSubmittedSerial++;
     }
 
+    void Device::SetSubmitsPausedForTesting(bool paused) {
+        mSubmitsPaused = paused;
+    }
+
     // BindGroupDataHolder
 
     BindGroupDataHolder::BindGroupDataHolder(size_t size)
@@ -269,6 +287,11 @@ namespace dawn_native { namespace null {
     BindGroup::BindGroup(DeviceBase* device, const BindGroupDescriptor* descriptor)
         : BindGroupDataHolder(descriptor->layout->GetBindingDataSize()),
           BindGroupBase(device, descriptor, mBindingDataAllocation) {
+        device->GetObjectPoolCounters()->AddAllocation(PooledObjectType::BindGroup);
+    }
+
+    BindGroup::~BindGroup() {
+        GetDevice()->GetObjectPoolCounters()->AddDeallocation(PooledObjectType::BindGroup);
     }
 
     // Buffer
@@ -366,6 +389,24 @@ namespace dawn_native { namespace null {
         FreeCommands(&mCommands);
     }
 
+    CommandIterator* CommandBuffer::GetCommandsForTesting() {
+        return &mCommands;
+    }
+
+    void CommandBuffer::DeleteThis() {
+        ToBackend(GetDevice())->GetCommandBufferPool()->Free(this);
+    }
+
+    // TextureView
+
+    TextureView::TextureView(TextureBase* texture, const TextureViewDescriptor* descriptor)
+        : TextureViewBase(texture, descriptor) {
+    }
+
+    void TextureView::DeleteThis() {
+        ToBackend(GetDevice())->GetTextureViewPool()->Free(this);
+    }
+
     // Queue
 
     Queue::Queue(Device* device) : QueueBase(device) {
@@ -379,6 +420,17 @@ namespace dawn_native { namespace null {
         return {};
     }
 
+    MaybeError Queue::LazyClearTexturesImpl(const std::vector<TextureBase*>& textures) {
+        // There is no texture content to clear, only mark the textures as initialized like the
+        // other backends do after clearing them.
+        for (TextureBase* texture : textures) {
+            texture->SetIsSubresourceContentInitialized(true, 0, texture->GetNumMipLevels(), 0,
+                                                        texture->GetArrayLayers());
+            GetDevice()->IncrementLazyClearCountForTesting();
+        }
+        return {};
+    }
+
     // SwapChain
 
     SwapChain::SwapChain(Device* device,
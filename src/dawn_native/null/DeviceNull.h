@@ -15,6 +15,7 @@
 #ifndef DAWNNATIVE_NULL_DEVICENULL_H_
 #define DAWNNATIVE_NULL_DEVICENULL_H_
 
+#include "common/PlacementAllocated.h"
 #include "dawn_native/Adapter.h"
 #include "dawn_native/BindGroup.h"
 #include "dawn_native/BindGroupLayout.h"
@@ -51,7 +52,7 @@ namespace dawn_native { namespace null {
     using ShaderModule = ShaderModuleBase;
     class SwapChain;
     using Texture = TextureBase;
-    using TextureView = TextureViewBase;
+    class TextureView;
 
     struct NullBackendTraits {
         using AdapterType = Adapter;
@@ -97,6 +98,10 @@ namespace dawn_native { namespace null {
         void AddPendingOperation(std::unique_ptr<PendingOperation> operation);
         void SubmitPendingOperations();
 
+        // While paused, ticks complete the submitted work but submit nothing new, like a backend
+        // that has nothing to submit. Pending operations like map requests stay pending.
+        void SetSubmitsPausedForTesting(bool paused);
+
         ResultOrError<std::unique_ptr<StagingBufferBase>> CreateStagingBuffer(size_t size) override;
         MaybeError CopyFromStagingToBuffer(StagingBufferBase* source,
                                            uint64_t sourceOffset,
@@ -107,6 +112,9 @@ namespace dawn_native { namespace null {
         MaybeError IncrementMemoryUsage(size_t bytes);
         void DecrementMemoryUsage(size_t bytes);
 
+        ObjectPool<CommandBuffer>* GetCommandBufferPool();
+        ObjectPool<TextureView>* GetTextureViewPool();
+
       private:
         ResultOrError<BindGroupBase*> CreateBindGroupImpl(
             const BindGroupDescriptor* descriptor) override;
@@ -136,13 +144,18 @@ namespace dawn_native { namespace null {
 
         void Destroy() override;
         MaybeError WaitForIdleForDestruction() override;
+        ResultOrError<bool> WaitForCompletionImpl(Serial serial, uint64_t timeoutNs) override;
 
         Serial mCompletedSerial = 0;
         Serial mLastSubmittedSerial = 0;
         std::vector<std::unique_ptr<PendingOperation>> mPendingOperations;
+        bool mSubmitsPaused = false;
 
         static constexpr size_t kMaxMemoryUsage = 256 * 1024 * 1024;
         size_t mMemoryUsage = 0;
+
+        ObjectPool<CommandBuffer> mCommandBufferPool;
+        ObjectPool<TextureView> mTextureViewPool;
     };
 
     class Adapter : public AdapterBase {
@@ -169,10 +182,12 @@ namespace dawn_native { namespace null {
 
     // We don't have the complexity of placement-allocation of bind group data in
     // the Null backend. This class, keeps the binding data in a separate allocation for simplicity.
+    // Bind groups are still counted with the pooled objects of the device like in the other
+    // backends, even though they are allocated on the heap.
     class BindGroup : private BindGroupDataHolder, public BindGroupBase {
       public:
         BindGroup(DeviceBase* device, const BindGroupDescriptor* descriptor);
-        ~BindGroup() override = default;
+        ~BindGroup() override;
     };
 
     class Buffer : public BufferBase {
@@ -201,15 +216,28 @@ namespace dawn_native { namespace null {
         std::unique_ptr<uint8_t[]> mBackingData;
     };
 
-    class CommandBuffer : public CommandBufferBase {
+    class CommandBuffer : public CommandBufferBase, public PlacementAllocated {
       public:
         CommandBuffer(CommandEncoder* encoder, const CommandBufferDescriptor* descriptor);
         ~CommandBuffer();
 
+        // Used by tests to inspect the commands other backends would replay.
+        CommandIterator* GetCommandsForTesting();
+
       private:
+        void DeleteThis() override;
+
         CommandIterator mCommands;
     };
 
+    class TextureView : public TextureViewBase, public PlacementAllocated {
+      public:
+        TextureView(TextureBase* texture, const TextureViewDescriptor* descriptor);
+
+      private:
+        void DeleteThis() override;
+    };
+
     class Queue : public QueueBase {
       public:
         Queue(Device* device);
@@ -217,6 +245,7 @@ namespace dawn_native { namespace null {
 
       private:
         MaybeError SubmitImpl(uint32_t commandCount, CommandBufferBase* const* commands) override;
+        MaybeError LazyClearTexturesImpl(const std::vector<TextureBase*>& textures) override;
     };
 
     class SwapChain : public NewSwapChainBase {
@@ -15,6 +15,7 @@
 #include "dawn_native/opengl/BindGroupLayoutGL.h"
 
 #include "dawn_native/opengl/BindGroupGL.h"
+#include "dawn_native/opengl/DeviceGL.h"
 
 namespace dawn_native { namespace opengl {
 
@@ -26,11 +27,13 @@ namespace dawn_native { namespace opengl {
 
     BindGroup* BindGroupLayout::AllocateBindGroup(Device* device,
                                                   const BindGroupDescriptor* descriptor) {
+        device->GetObjectPoolCounters()->AddAllocation(PooledObjectType::BindGroup);
         return mBindGroupAllocator.Allocate(device, descriptor);
     }
 
     void BindGroupLayout::DeallocateBindGroup(BindGroup* bindGroup) {
         mBindGroupAllocator.Deallocate(bindGroup);
+        GetDevice()->GetObjectPoolCounters()->AddDeallocation(PooledObjectType::BindGroup);
     }
 
 }}  // namespace dawn_native::opengl
@@ -411,6 +411,10 @@ namespace dawn_native { namespace opengl {
         FreeCommands(&mCommands);
     }
 
+    void CommandBuffer::DeleteThis() {
+        ToBackend(GetDevice())->GetCommandBufferPool()->Free(this);
+    }
+
     void CommandBuffer::Execute() {
         const OpenGLFunctions& gl = ToBackend(GetDevice())->gl;
 
@@ -15,6 +15,7 @@
 #ifndef DAWNNATIVE_OPENGL_COMMANDBUFFERGL_H_
 #define DAWNNATIVE_OPENGL_COMMANDBUFFERGL_H_
 
+#include "common/PlacementAllocated.h"
 #include "dawn_native/CommandAllocator.h"
 #include "dawn_native/CommandBuffer.h"
 
@@ -26,7 +27,7 @@ namespace dawn_native { namespace opengl {
 
     class Device;
 
-    class CommandBuffer : public CommandBufferBase {
+    class CommandBuffer : public CommandBufferBase, public PlacementAllocated {
       public:
         CommandBuffer(CommandEncoder* encoder, const CommandBufferDescriptor* descriptor);
         ~CommandBuffer();
@@ -34,6 +35,8 @@ namespace dawn_native { namespace opengl {
         void Execute();
 
       private:
+        void DeleteThis() override;
+
         void ExecuteComputePass();
         void ExecuteRenderPass(BeginRenderPassCmd* renderPass);
 
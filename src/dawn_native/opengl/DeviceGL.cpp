@@ -36,7 +36,10 @@ namespace dawn_native { namespace opengl {
     Device::Device(AdapterBase* adapter,
                    const DeviceDescriptor* descriptor,
                    const OpenGLFunctions& functions)
-        : DeviceBase(adapter, descriptor), gl(functions) {
+        : DeviceBase(adapter, descriptor),
+          gl(functions),
+          mCommandBufferPool(GetObjectPoolCounters(), PooledObjectType::CommandBuffer),
+          mTextureViewPool(GetObjectPoolCounters(), PooledObjectType::TextureView) {
         InitTogglesFromDriver();
         if (descriptor != nullptr) {
             ApplyToggleOverrides(descriptor);
@@ -81,6 +84,14 @@ namespace dawn_native { namespace opengl {
         return result;
     }
 
+    ObjectPool<CommandBuffer>* Device::GetCommandBufferPool() {
+        return &mCommandBufferPool;
+    }
+
+    ObjectPool<TextureView>* Device::GetTextureViewPool() {
+        return &mTextureViewPool;
+    }
+
     ResultOrError<BindGroupBase*> Device::CreateBindGroupImpl(
         const BindGroupDescriptor* descriptor) {
         return BindGroup::Create(this, descriptor);
@@ -94,7 +105,7 @@ namespace dawn_native { namespace opengl {
     }
     CommandBufferBase* Device::CreateCommandBuffer(CommandEncoder* encoder,
                                                    const CommandBufferDescriptor* descriptor) {
-        return new CommandBuffer(encoder, descriptor);
+        return mCommandBufferPool.Allocate(encoder, descriptor);
     }
     ResultOrError<ComputePipelineBase*> Device::CreateComputePipelineImpl(
         const ComputePipelineDescriptor* descriptor) {
@@ -134,7 +145,7 @@ namespace dawn_native { namespace opengl {
     ResultOrError<TextureViewBase*> Device::CreateTextureViewImpl(
         TextureBase* texture,
         const TextureViewDescriptor* descriptor) {
-        return new TextureView(texture, descriptor);
+        return mTextureViewPool.Allocate(texture, descriptor);
     }
 
     void Device::SubmitFenceSync() {
@@ -143,6 +154,32 @@ namespace dawn_native { namespace opengl {
         mFencesInFlight.emplace(sync, mLastSubmittedSerial);
     }
 
+    Ref<Program> Device::GetOrCreateProgram(const ProgramKey& key) {
+        auto iter = mPrograms.find(key);
+        if (iter != mPrograms.end()) {
+            mReusedProgramCount++;
+            return iter->second;
+        }
+
+        Ref<Program> program = AcquireRef(new Program(this, key));
+        mPrograms.emplace(key, program.Get());
+        mCreatedProgramCount++;
+        return program;
+    }
+
+    void Device::UncacheProgram(Program* program) {
+        size_t removedCount = mPrograms.erase(program->GetKey());
+        ASSERT(removedCount == 1);
+    }
+
+    uint64_t Device::GetCreatedProgramCount() const {
+        return mCreatedProgramCount;
+    }
+
+    uint64_t Device::GetReusedProgramCount() const {
+        return mReusedProgramCount;
+    }
+
     Serial Device::GetCompletedCommandSerial() const {
         return mCompletedSerial;
     }
@@ -181,6 +218,27 @@ namespace dawn_native { namespace opengl {
         }
     }
 
+    ResultOrError<bool> Device::WaitForCompletionImpl(Serial serial, uint64_t timeoutNs) {
+        if (mCompletedSerial >= serial) {
+            return true;
+        }
+
+        // Fences are signaled in submission order so it is enough to wait for the oldest one
+        // in flight, the caller waits again if |serial| isn't completed after that.
+        ASSERT(!mFencesInFlight.empty());
+        GLsync sync = mFencesInFlight.front().first;
+        GLenum result = gl.ClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, timeoutNs);
+        if (result == GL_TIMEOUT_EXPIRED) {
+            return false;
+        }
+        if (result == GL_WAIT_FAILED) {
+            return DAWN_DEVICE_LOST_ERROR("glClientWaitSync failed");
+        }
+
+        CheckPassedFences();
+        return true;
+    }
+
     ResultOrError<std::unique_ptr<StagingBufferBase>> Device::CreateStagingBuffer(size_t size) {
         return DAWN_UNIMPLEMENTED_ERROR("Device unable to create staging buffer.");
     }
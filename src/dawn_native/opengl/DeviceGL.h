@@ -22,8 +22,10 @@
 #include "dawn_native/opengl/Forward.h"
 #include "dawn_native/opengl/GLFormat.h"
 #include "dawn_native/opengl/OpenGLFunctions.h"
+#include "dawn_native/opengl/ProgramGL.h"
 
 #include <queue>
+#include <unordered_map>
 
 // Remove windows.h macros after glad's include of windows.h
 #if defined(DAWN_PLATFORM_WINDOWS)
@@ -46,9 +48,17 @@ namespace dawn_native { namespace opengl {
 
         void SubmitFenceSync();
 
+        // Pipelines that only differ by their fixed-function state share their program.
+        Ref<Program> GetOrCreateProgram(const ProgramKey& key);
+        void UncacheProgram(Program* program);
+        uint64_t GetCreatedProgramCount() const;
+        uint64_t GetReusedProgramCount() const;
+
         // Dawn API
         CommandBufferBase* CreateCommandBuffer(CommandEncoder* encoder,
                                                const CommandBufferDescriptor* descriptor) override;
+        ObjectPool<CommandBuffer>* GetCommandBufferPool();
+        ObjectPool<TextureView>* GetTextureViewPool();
 
         Serial GetCompletedCommandSerial() const final override;
         Serial GetLastSubmittedCommandSerial() const final override;
@@ -93,12 +103,20 @@ namespace dawn_native { namespace opengl {
         void CheckPassedFences();
         void Destroy() override;
         MaybeError WaitForIdleForDestruction() override;
+        ResultOrError<bool> WaitForCompletionImpl(Serial serial, uint64_t timeoutNs) override;
 
         Serial mCompletedSerial = 0;
         Serial mLastSubmittedSerial = 0;
         std::queue<std::pair<GLsync, Serial>> mFencesInFlight;
 
         GLFormatTable mFormatTable;
+
+        ObjectPool<CommandBuffer> mCommandBufferPool;
+        ObjectPool<TextureView> mTextureViewPool;
+
+        std::unordered_map<ProgramKey, Program*, ProgramKey::HashFunc> mPrograms;
+        uint64_t mCreatedProgramCount = 0;
+        uint64_t mReusedProgramCount = 0;
     };
 
 }}  // namespace dawn_native::opengl
@@ -46,4 +46,14 @@ namespace dawn_native { namespace opengl {
         return static_cast<WGPUTextureFormat>(impl->GetPreferredFormat());
     }
 
+    ProgramCounts GetProgramCountsForTesting(WGPUDevice device) {
+        Device* backendDevice = reinterpret_cast<Device*>(device);
+        std::lock_guard<std::recursive_mutex> lock(*backendDevice->GetApiMutex());
+
+        ProgramCounts counts;
+        counts.created = backendDevice->GetCreatedProgramCount();
+        counts.reused = backendDevice->GetReusedProgramCount();
+        return counts;
+    }
+
 }}  // namespace dawn_native::opengl
@@ -14,204 +14,35 @@
 
 #include "dawn_native/opengl/PipelineGL.h"
 
-#include "common/BitSetIterator.h"
-#include "common/Log.h"
-#include "dawn_native/BindGroupLayout.h"
-#include "dawn_native/opengl/Forward.h"
+#include "dawn_native/opengl/DeviceGL.h"
 #include "dawn_native/opengl/OpenGLFunctions.h"
-#include "dawn_native/opengl/PipelineLayoutGL.h"
-#include "dawn_native/opengl/ShaderModuleGL.h"
-
-#include <set>
 
 namespace dawn_native { namespace opengl {
 
-    namespace {
-
-        GLenum GLShaderType(SingleShaderStage stage) {
-            switch (stage) {
-                case SingleShaderStage::Vertex:
-                    return GL_VERTEX_SHADER;
-                case SingleShaderStage::Fragment:
-                    return GL_FRAGMENT_SHADER;
-                case SingleShaderStage::Compute:
-                    return GL_COMPUTE_SHADER;
-                default:
-                    UNREACHABLE();
-            }
-        }
-
-    }  // namespace
-
     PipelineGL::PipelineGL() {
     }
 
-    void PipelineGL::Initialize(const OpenGLFunctions& gl,
+    void PipelineGL::Initialize(Device* device,
                                 const PipelineLayout* layout,
                                 const PerStage<const ShaderModule*>& modules) {
-        auto CreateShader = [](const OpenGLFunctions& gl, GLenum type,
-                               const char* source) -> GLuint {
-            GLuint shader = gl.CreateShader(type);
-            gl.ShaderSource(shader, 1, &source, nullptr);
-            gl.CompileShader(shader);
-
-            GLint compileStatus = GL_FALSE;
-            gl.GetShaderiv(shader, GL_COMPILE_STATUS, &compileStatus);
-            if (compileStatus == GL_FALSE) {
-                GLint infoLogLength = 0;
-                gl.GetShaderiv(shader, GL_INFO_LOG_LENGTH, &infoLogLength);
-
-                if (infoLogLength > 1) {
-                    std::vector<char> buffer(infoLogLength);
-                    gl.GetShaderInfoLog(shader, infoLogLength, nullptr, &buffer[0]);
-                    dawn::ErrorLog() << source << "\nProgram compilation failed:\n"
-                                     << buffer.data();
-                }
-            }
-            return shader;
-        };
-
-        mProgram = gl.CreateProgram();
-
-        wgpu::ShaderStage activeStages = wgpu::ShaderStage::None;
-        for (SingleShaderStage stage : IterateStages(kAllStages)) {
-            if (modules[stage] != nullptr) {
-                activeStages |= StageBit(stage);
-            }
-        }
-
-        for (SingleShaderStage stage : IterateStages(activeStages)) {
-            GLuint shader = CreateShader(gl, GLShaderType(stage), modules[stage]->GetSource());
-            gl.AttachShader(mProgram, shader);
-        }
-
-        gl.LinkProgram(mProgram);
-
-        GLint linkStatus = GL_FALSE;
-        gl.GetProgramiv(mProgram, GL_LINK_STATUS, &linkStatus);
-        if (linkStatus == GL_FALSE) {
-            GLint infoLogLength = 0;
-            gl.GetProgramiv(mProgram, GL_INFO_LOG_LENGTH, &infoLogLength);
-
-            if (infoLogLength > 1) {
-                std::vector<char> buffer(infoLogLength);
-                gl.GetProgramInfoLog(mProgram, infoLogLength, nullptr, &buffer[0]);
-                dawn::ErrorLog() << "Program link failed:\n" << buffer.data();
-            }
-        }
-
-        gl.UseProgram(mProgram);
-
-        // The uniforms are part of the program state so we can pre-bind buffer units, texture units
-        // etc.
-        const auto& indices = layout->GetBindingIndexInfo();
-
-        for (uint32_t group : IterateBitSet(layout->GetBindGroupLayoutsMask())) {
-            const BindGroupLayoutBase* bgl = layout->GetBindGroupLayout(group);
-
-            for (const auto& it : bgl->GetBindingMap()) {
-                BindingNumber bindingNumber = it.first;
-                BindingIndex bindingIndex = it.second;
-
-                std::string name = GetBindingName(group, bindingNumber);
-                switch (bgl->GetBindingInfo(bindingIndex).type) {
-                    case wgpu::BindingType::UniformBuffer: {
-                        GLint location = gl.GetUniformBlockIndex(mProgram, name.c_str());
-                        if (location != -1) {
-                            gl.UniformBlockBinding(mProgram, location,
-                                                   indices[group][bindingIndex]);
-                        }
-                        break;
-                    }
-
-                    case wgpu::BindingType::StorageBuffer:
-                    case wgpu::BindingType::ReadonlyStorageBuffer: {
-                        GLuint location = gl.GetProgramResourceIndex(
-                            mProgram, GL_SHADER_STORAGE_BLOCK, name.c_str());
-                        if (location != GL_INVALID_INDEX) {
-                            gl.ShaderStorageBlockBinding(mProgram, location,
-                                                         indices[group][bindingIndex]);
-                        }
-                        break;
-                    }
-
-                    case wgpu::BindingType::Sampler:
-                    case wgpu::BindingType::SampledTexture:
-                        // These binding types are handled in the separate sampler and texture
-                        // emulation
-                        break;
-
-                    case wgpu::BindingType::StorageTexture:
-                    case wgpu::BindingType::ReadonlyStorageTexture:
-                    case wgpu::BindingType::WriteonlyStorageTexture:
-                        UNREACHABLE();
-                        break;
-
-                        // TODO(shaobo.yan@intel.com): Implement dynamic buffer offset.
-                }
-            }
-        }
-
-        // Compute links between stages for combined samplers, then bind them to texture units
-        {
-            std::set<CombinedSampler> combinedSamplersSet;
-            for (SingleShaderStage stage : IterateStages(activeStages)) {
-                for (const auto& combined : modules[stage]->GetCombinedSamplerInfo()) {
-                    combinedSamplersSet.insert(combined);
-                }
-            }
-
-            mUnitsForSamplers.resize(layout->GetNumSamplers());
-            mUnitsForTextures.resize(layout->GetNumSampledTextures());
-
-            GLuint textureUnit = layout->GetTextureUnitsUsed();
-            for (const auto& combined : combinedSamplersSet) {
-                std::string name = combined.GetName();
-                GLint location = gl.GetUniformLocation(mProgram, name.c_str());
-
-                if (location == -1) {
-                    continue;
-                }
-
-                gl.Uniform1i(location, textureUnit);
-
-                GLuint textureIndex =
-                    indices[combined.textureLocation.group][combined.textureLocation.binding];
-                mUnitsForTextures[textureIndex].push_back(textureUnit);
-
-                const BindGroupLayoutBase* bgl =
-                    layout->GetBindGroupLayout(combined.textureLocation.group);
-                Format::Type componentType =
-                    bgl->GetBindingInfo(bgl->GetBindingIndex(combined.textureLocation.binding))
-                        .textureComponentType;
-                bool shouldUseFiltering = componentType == Format::Type::Float;
-
-                GLuint samplerIndex =
-                    indices[combined.samplerLocation.group][combined.samplerLocation.binding];
-                mUnitsForSamplers[samplerIndex].push_back({textureUnit, shouldUseFiltering});
-
-                textureUnit++;
-            }
-        }
+        mProgram = device->GetOrCreateProgram({layout, modules});
     }
 
     const std::vector<PipelineGL::SamplerUnit>& PipelineGL::GetTextureUnitsForSampler(
         GLuint index) const {
-        ASSERT(index < mUnitsForSamplers.size());
-        return mUnitsForSamplers[index];
+        return mProgram->GetTextureUnitsForSampler(index);
     }
 
     const std::vector<GLuint>& PipelineGL::GetTextureUnitsForTextureView(GLuint index) const {
-        ASSERT(index < mUnitsForSamplers.size());
-        return mUnitsForTextures[index];
+        return mProgram->GetTextureUnitsForTextureView(index);
     }
 
     GLuint PipelineGL::GetProgramHandle() const {
-        return mProgram;
+        return mProgram->GetHandle();
     }
 
     void PipelineGL::ApplyNow(const OpenGLFunctions& gl) {
-        gl.UseProgram(mProgram);
+        gl.UseProgram(mProgram->GetHandle());
     }
 
 }}  // namespace dawn_native::opengl
@@ -17,12 +17,14 @@
 
 #include "dawn_native/Pipeline.h"
 
+#include "dawn_native/opengl/ProgramGL.h"
 #include "dawn_native/opengl/opengl_platform.h"
 
 #include <vector>
 
 namespace dawn_native { namespace opengl {
 
+    class Device;
     struct OpenGLFunctions;
     class PersistentPipelineState;
     class PipelineLayout;
@@ -32,19 +34,14 @@ namespace dawn_native { namespace opengl {
       public:
         PipelineGL();
 
-        void Initialize(const OpenGLFunctions& gl,
+        void Initialize(Device* device,
                         const PipelineLayout* layout,
                         const PerStage<const ShaderModule*>& modules);
 
         using BindingLocations =
             std::array<std::array<GLint, kMaxBindingsPerGroup>, kMaxBindGroups>;
 
-        // For each unit a sampler is bound to we need to know if we should use filtering or not
-        // because int and uint texture are only complete without filtering.
-        struct SamplerUnit {
-            GLuint unit;
-            bool shouldUseFiltering;
-        };
+        using SamplerUnit = Program::SamplerUnit;
         const std::vector<SamplerUnit>& GetTextureUnitsForSampler(GLuint index) const;
         const std::vector<GLuint>& GetTextureUnitsForTextureView(GLuint index) const;
         GLuint GetProgramHandle() const;
@@ -52,9 +49,8 @@ namespace dawn_native { namespace opengl {
         void ApplyNow(const OpenGLFunctions& gl);
 
       private:
-        GLuint mProgram;
-        std::vector<std::vector<SamplerUnit>> mUnitsForSamplers;
-        std::vector<std::vector<GLuint>> mUnitsForTextures;
+        // Shared with the other pipelines that have the same layout and modules.
+        Ref<Program> mProgram;
     };
 
 }}  // namespace dawn_native::opengl
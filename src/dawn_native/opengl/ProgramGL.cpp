@@ -0,0 +1,450 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn_native/opengl/ProgramGL.h"
+
+#include "common/BitSetIterator.h"
+#include "common/HashUtils.h"
+#include "common/Log.h"
+#include "dawn_native/BindGroupLayout.h"
+#include "dawn_native/PersistentCache.h"
+#include "dawn_native/ShaderCompileTracker.h"
+#include "dawn_native/opengl/DeviceGL.h"
+#include "dawn_native/opengl/Forward.h"
+#include "dawn_native/opengl/OpenGLFunctions.h"
+#include "dawn_native/opengl/PipelineLayoutGL.h"
+#include "dawn_native/opengl/ShaderModuleGL.h"
+
+#include <cstring>
+#include <set>
+
+namespace dawn_native { namespace opengl {
+
+    namespace {
+
+        GLenum GLShaderType(SingleShaderStage stage) {
+            switch (stage) {
+                case SingleShaderStage::Vertex:
+                    return GL_VERTEX_SHADER;
+                case SingleShaderStage::Fragment:
+                    return GL_FRAGMENT_SHADER;
+                case SingleShaderStage::Compute:
+                    return GL_COMPUTE_SHADER;
+                default:
+                    UNREACHABLE();
+            }
+        }
+
+        // Bumped when the format of the cached programs changes.
+        constexpr uint32_t kProgramCacheVersion = 1;
+
+        // The cached programs are the binary of the program preceded by this header and the
+        // locations of the resources of the program, in the order Program::Initialize looks
+        // them up.
+        struct ProgramBinaryHeader {
+            uint32_t binaryFormat;
+            uint32_t binarySize;
+            uint32_t locationCount;
+        };
+
+        std::string GetGLString(const OpenGLFunctions& gl, GLenum name) {
+            const GLubyte* string = gl.GetString(name);
+            if (string == nullptr) {
+                return "";
+            }
+            return reinterpret_cast<const char*>(string);
+        }
+
+        // The program binaries are only valid for the driver that produced them, and the location
+        // of the resources depend on the sources and on the bindings of the layout.
+        PersistentCacheKey ComputeProgramCacheKey(const OpenGLFunctions& gl,
+                                                  const PipelineLayout* layout,
+                                                  const PerStage<const ShaderModule*>& modules,
+                                                  wgpu::ShaderStage activeStages) {
+            PersistentCacheKey key;
+            AppendToCacheKey(&key, "GLProgram");
+            AppendToCacheKey(&key, kProgramCacheVersion);
+            AppendToCacheKey(&key, GetGLString(gl, GL_VENDOR));
+            AppendToCacheKey(&key, GetGLString(gl, GL_RENDERER));
+            AppendToCacheKey(&key, GetGLString(gl, GL_VERSION));
+
+            for (SingleShaderStage stage : IterateStages(activeStages)) {
+                AppendToCacheKey(&key, static_cast<uint32_t>(stage));
+                AppendToCacheKey(&key, modules[stage]->GetSource());
+            }
+
+            const auto& indices = layout->GetBindingIndexInfo();
+            for (uint32_t group : IterateBitSet(layout->GetBindGroupLayoutsMask())) {
+                const BindGroupLayoutBase* bgl = layout->GetBindGroupLayout(group);
+                for (const auto& it : bgl->GetBindingMap()) {
+                    AppendToCacheKey(&key, group);
+                    AppendToCacheKey(&key, it.first);
+                    AppendToCacheKey(&key,
+                                     static_cast<uint32_t>(bgl->GetBindingInfo(it.second).type));
+                    AppendToCacheKey(&key, indices[group][it.second]);
+                }
+            }
+            return key;
+        }
+
+        // Creates a program from a cached binary and returns the locations of its resources, or
+        // returns 0 if the binary can't be used, for example because the driver was updated or
+        // because it doesn't have the number of locations the program is expected to have.
+        GLuint LoadCachedProgram(const OpenGLFunctions& gl,
+                                 const std::vector<uint8_t>& blob,
+                                 size_t expectedLocationCount,
+                                 std::vector<GLint>* locations) {
+            ProgramBinaryHeader header;
+            if (blob.size() < sizeof(header)) {
+                return 0;
+            }
+            memcpy(&header, blob.data(), sizeof(header));
+
+            if (header.locationCount != expectedLocationCount) {
+                return 0;
+            }
+
+            size_t locationsSize = header.locationCount * sizeof(GLint);
+            if (blob.size() != sizeof(header) + locationsSize + header.binarySize) {
+                return 0;
+            }
+
+            GLuint program = gl.CreateProgram();
+            const uint8_t* binary = blob.data() + sizeof(header) + locationsSize;
+            gl.ProgramBinary(program, header.binaryFormat, binary, header.binarySize);
+
+            GLint linkStatus = GL_FALSE;
+            gl.GetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+            if (linkStatus == GL_FALSE) {
+                gl.DeleteProgram(program);
+                return 0;
+            }
+
+            locations->resize(header.locationCount);
+            memcpy(locations->data(), blob.data() + sizeof(header), locationsSize);
+            return program;
+        }
+
+        void StoreProgram(const OpenGLFunctions& gl,
+                          GLuint program,
+                          const std::vector<GLint>& locations,
+                          PersistentCache* cache,
+                          const PersistentCacheKey& key) {
+            GLint binaryLength = 0;
+            gl.GetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+            if (binaryLength <= 0) {
+                return;
+            }
+
+            ProgramBinaryHeader header;
+            header.locationCount = static_cast<uint32_t>(locations.size());
+            size_t locationsSize = locations.size() * sizeof(GLint);
+
+            std::vector<uint8_t> blob(sizeof(header) + locationsSize + binaryLength);
+            GLsizei binarySize = 0;
+            GLenum binaryFormat = 0;
+            gl.GetProgramBinary(program, binaryLength, &binarySize, &binaryFormat,
+                                blob.data() + sizeof(header) + locationsSize);
+            if (binarySize <= 0) {
+                return;
+            }
+
+            header.binaryFormat = binaryFormat;
+            header.binarySize = static_cast<uint32_t>(binarySize);
+            blob.resize(sizeof(header) + locationsSize + binarySize);
+            memcpy(blob.data(), &header, sizeof(header));
+            memcpy(blob.data() + sizeof(header), locations.data(), locationsSize);
+
+            cache->StoreData(key, blob.data(), blob.size());
+        }
+
+    }  // namespace
+
+    size_t ProgramKey::HashFunc::operator()(const ProgramKey& key) const {
+        size_t hash = Hash(key.layout);
+        for (SingleShaderStage stage : IterateStages(kAllStages)) {
+            HashCombine(&hash, key.modules[stage]);
+        }
+        return hash;
+    }
+
+    bool ProgramKey::operator==(const ProgramKey& other) const {
+        if (layout != other.layout) {
+            return false;
+        }
+        for (SingleShaderStage stage : IterateStages(kAllStages)) {
+            if (modules[stage] != other.modules[stage]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    Program::Program(Device* device, const ProgramKey& key) : mDevice(device), mKey(key) {
+        Initialize();
+    }
+
+    Program::~Program() {
+        mDevice->UncacheProgram(this);
+        mDevice->gl.DeleteProgram(mProgram);
+    }
+
+    void Program::Initialize() {
+        const OpenGLFunctions& gl = mDevice->gl;
+        const PipelineLayout* layout = mKey.layout;
+        const PerStage<const ShaderModule*>& modules = mKey.modules;
+
+        auto CreateShader = [](const OpenGLFunctions& gl, GLenum type,
+                               const char* source) -> GLuint {
+            GLuint shader = gl.CreateShader(type);
+            gl.ShaderSource(shader, 1, &source, nullptr);
+            gl.CompileShader(shader);
+
+            GLint compileStatus = GL_FALSE;
+            gl.GetShaderiv(shader, GL_COMPILE_STATUS, &compileStatus);
+            if (compileStatus == GL_FALSE) {
+                GLint infoLogLength = 0;
+                gl.GetShaderiv(shader, GL_INFO_LOG_LENGTH, &infoLogLength);
+
+                if (infoLogLength > 1) {
+                    std::vector<char> buffer(infoLogLength);
+                    gl.GetShaderInfoLog(shader, infoLogLength, nullptr, &buffer[0]);
+                    dawn::ErrorLog() << source << "\nProgram compilation failed:\n"
+                                     << buffer.data();
+                }
+            }
+            return shader;
+        };
+
+        wgpu::ShaderStage activeStages = wgpu::ShaderStage::None;
+        for (SingleShaderStage stage : IterateStages(kAllStages)) {
+            if (modules[stage] != nullptr) {
+                activeStages |= StageBit(stage);
+            }
+        }
+
+        // Compute links between stages for combined samplers.
+        std::set<CombinedSampler> combinedSamplersSet;
+        for (SingleShaderStage stage : IterateStages(activeStages)) {
+            for (const auto& combined : modules[stage]->GetCombinedSamplerInfo()) {
+                combinedSamplersSet.insert(combined);
+            }
+        }
+
+        // The locations of the uniform blocks, storage blocks and combined samplers of the
+        // program, in the order they are bound below. They are cached with the program binary so
+        // that warm starts don't look them up by name.
+        std::vector<GLint> locations;
+
+        PersistentCache* cache = mDevice->GetPersistentCache();
+        GLint binaryFormatCount = 0;
+        gl.GetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormatCount);
+        bool useProgramCache = cache->IsEnabled() && binaryFormatCount > 0;
+
+        PersistentCacheKey cacheKey;
+        mProgram = 0;
+        if (useProgramCache) {
+            // There is one location per buffer binding and per combined sampler.
+            size_t expectedLocationCount = combinedSamplersSet.size();
+            for (uint32_t group : IterateBitSet(layout->GetBindGroupLayoutsMask())) {
+                const BindGroupLayoutBase* bgl = layout->GetBindGroupLayout(group);
+                for (const auto& it : bgl->GetBindingMap()) {
+                    switch (bgl->GetBindingInfo(it.second).type) {
+                        case wgpu::BindingType::UniformBuffer:
+                        case wgpu::BindingType::StorageBuffer:
+                        case wgpu::BindingType::ReadonlyStorageBuffer:
+                            expectedLocationCount++;
+                            break;
+                        default:
+                            break;
+                    }
+                }
+            }
+
+            cacheKey = ComputeProgramCacheKey(gl, layout, modules, activeStages);
+            mProgram = LoadCachedProgram(gl, cache->LoadData(cacheKey), expectedLocationCount,
+                                         &locations);
+        }
+
+        if (mProgram == 0) {
+            ScopedShaderCompileTimer timer(mDevice, ShaderCompilePhase::BackendCompilation,
+                                           {modules[SingleShaderStage::Vertex],
+                                            modules[SingleShaderStage::Fragment],
+                                            modules[SingleShaderStage::Compute]});
+            mProgram = gl.CreateProgram();
+
+            for (SingleShaderStage stage : IterateStages(activeStages)) {
+                GLuint shader = CreateShader(gl, GLShaderType(stage), modules[stage]->GetSource());
+                gl.AttachShader(mProgram, shader);
+            }
+
+            if (useProgramCache) {
+                gl.ProgramParameteri(mProgram, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+            }
+            gl.LinkProgram(mProgram);
+
+            GLint linkStatus = GL_FALSE;
+            gl.GetProgramiv(mProgram, GL_LINK_STATUS, &linkStatus);
+            if (linkStatus == GL_FALSE) {
+                GLint infoLogLength = 0;
+                gl.GetProgramiv(mProgram, GL_INFO_LOG_LENGTH, &infoLogLength);
+
+                if (infoLogLength > 1) {
+                    std::vector<char> buffer(infoLogLength);
+                    gl.GetProgramInfoLog(mProgram, infoLogLength, nullptr, &buffer[0]);
+                    dawn::ErrorLog() << "Program link failed:\n" << buffer.data();
+                }
+            }
+
+            for (uint32_t group : IterateBitSet(layout->GetBindGroupLayoutsMask())) {
+                const BindGroupLayoutBase* bgl = layout->GetBindGroupLayout(group);
+
+                for (const auto& it : bgl->GetBindingMap()) {
+                    std::string name = GetBindingName(group, it.first);
+                    switch (bgl->GetBindingInfo(it.second).type) {
+                        case wgpu::BindingType::UniformBuffer:
+                            locations.push_back(gl.GetUniformBlockIndex(mProgram, name.c_str()));
+                            break;
+
+                        case wgpu::BindingType::StorageBuffer:
+                        case wgpu::BindingType::ReadonlyStorageBuffer:
+                            locations.push_back(static_cast<GLint>(gl.GetProgramResourceIndex(
+                                mProgram, GL_SHADER_STORAGE_BLOCK, name.c_str())));
+                            break;
+
+                        default:
+                            break;
+                    }
+                }
+            }
+
+            for (const auto& combined : combinedSamplersSet) {
+                std::string name = combined.GetName();
+                locations.push_back(gl.GetUniformLocation(mProgram, name.c_str()));
+            }
+
+            if (useProgramCache && linkStatus == GL_TRUE) {
+                StoreProgram(gl, mProgram, locations, cache, cacheKey);
+            }
+        }
+
+        gl.UseProgram(mProgram);
+
+        // The uniforms are part of the program state so we can pre-bind buffer units, texture units
+        // etc. They aren't part of the program binaries so they are set even for cached programs.
+        const auto& indices = layout->GetBindingIndexInfo();
+        auto nextLocation = locations.begin();
+
+        for (uint32_t group : IterateBitSet(layout->GetBindGroupLayoutsMask())) {
+            const BindGroupLayoutBase* bgl = layout->GetBindGroupLayout(group);
+
+            for (const auto& it : bgl->GetBindingMap()) {
+                BindingIndex bindingIndex = it.second;
+
+                switch (bgl->GetBindingInfo(bindingIndex).type) {
+                    case wgpu::BindingType::UniformBuffer: {
+                        ASSERT(nextLocation != locations.end());
+                        GLint location = *nextLocation++;
+                        if (location != -1) {
+                            gl.UniformBlockBinding(mProgram, location,
+                                                   indices[group][bindingIndex]);
+                        }
+                        break;
+                    }
+
+                    case wgpu::BindingType::StorageBuffer:
+                    case wgpu::BindingType::ReadonlyStorageBuffer: {
+                        ASSERT(nextLocation != locations.end());
+                        GLuint location = static_cast<GLuint>(*nextLocation++);
+                        if (location != GL_INVALID_INDEX) {
+                            gl.ShaderStorageBlockBinding(mProgram, location,
+                                                         indices[group][bindingIndex]);
+                        }
+                        break;
+                    }
+
+                    case wgpu::BindingType::Sampler:
+                    case wgpu::BindingType::SampledTexture:
+                        // These binding types are handled in the separate sampler and texture
+                        // emulation
+                        break;
+
+                    case wgpu::BindingType::StorageTexture:
+                    case wgpu::BindingType::ReadonlyStorageTexture:
+                    case wgpu::BindingType::WriteonlyStorageTexture:
+                        UNREACHABLE();
+                        break;
+
+                        // TODO(shaobo.yan@intel.com): Implement dynamic buffer offset.
+                }
+            }
+        }
+
+        // Bind the combined samplers to texture units
+        {
+            mUnitsForSamplers.resize(layout->GetNumSamplers());
+            mUnitsForTextures.resize(layout->GetNumSampledTextures());
+
+            GLuint textureUnit = layout->GetTextureUnitsUsed();
+            for (const auto& combined : combinedSamplersSet) {
+                ASSERT(nextLocation != locations.end());
+                GLint location = *nextLocation++;
+
+                if (location == -1) {
+                    continue;
+                }
+
+                gl.Uniform1i(location, textureUnit);
+
+                GLuint textureIndex =
+                    indices[combined.textureLocation.group][combined.textureLocation.binding];
+                mUnitsForTextures[textureIndex].push_back(textureUnit);
+
+                const BindGroupLayoutBase* bgl =
+                    layout->GetBindGroupLayout(combined.textureLocation.group);
+                Format::Type componentType =
+                    bgl->GetBindingInfo(bgl->GetBindingIndex(combined.textureLocation.binding))
+                        .textureComponentType;
+                bool shouldUseFiltering = componentType == Format::Type::Float;
+
+                GLuint samplerIndex =
+                    indices[combined.samplerLocation.group][combined.samplerLocation.binding];
+                mUnitsForSamplers[samplerIndex].push_back({textureUnit, shouldUseFiltering});
+
+                textureUnit++;
+            }
+        }
+        ASSERT(nextLocation == locations.end());
+    }
+
+    const std::vector<Program::SamplerUnit>& Program::GetTextureUnitsForSampler(
+        GLuint index) const {
+        ASSERT(index < mUnitsForSamplers.size());
+        return mUnitsForSamplers[index];
+    }
+
+    const std::vector<GLuint>& Program::GetTextureUnitsForTextureView(GLuint index) const {
+        ASSERT(index < mUnitsForTextures.size());
+        return mUnitsForTextures[index];
+    }
+
+    GLuint Program::GetHandle() const {
+        return mProgram;
+    }
+
+    const ProgramKey& Program::GetKey() const {
+        return mKey;
+    }
+
+}}  // namespace dawn_native::opengl
@@ -0,0 +1,77 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_OPENGL_PROGRAMGL_H_
+#define DAWNNATIVE_OPENGL_PROGRAMGL_H_
+
+#include "dawn_native/PerStage.h"
+#include "dawn_native/RefCounted.h"
+
+#include "dawn_native/opengl/opengl_platform.h"
+
+#include <vector>
+
+namespace dawn_native { namespace opengl {
+
+    class Device;
+    class PipelineLayout;
+    class ShaderModule;
+
+    // What identifies the program of a pipeline: pipelines with the same layout and modules have
+    // the same program even if their fixed-function state differs. The modules are translated to
+    // GLSL for their single entry point so they also identify the entry points. Pipelines hold
+    // references to their layout and modules so the pointers stay valid while the program lives.
+    struct ProgramKey {
+        const PipelineLayout* layout;
+        PerStage<const ShaderModule*> modules;
+
+        struct HashFunc {
+            size_t operator()(const ProgramKey& key) const;
+        };
+        bool operator==(const ProgramKey& other) const;
+    };
+
+    // A linked GL program shared by all the pipelines with the same ProgramKey, with the texture
+    // units its samplers and textures are bound to. Programs are created and cached by the device.
+    class Program : public RefCounted {
+      public:
+        Program(Device* device, const ProgramKey& key);
+        ~Program() override;
+
+        // For each unit a sampler is bound to we need to know if we should use filtering or not
+        // because int and uint texture are only complete without filtering.
+        struct SamplerUnit {
+            GLuint unit;
+            bool shouldUseFiltering;
+        };
+        const std::vector<SamplerUnit>& GetTextureUnitsForSampler(GLuint index) const;
+        const std::vector<GLuint>& GetTextureUnitsForTextureView(GLuint index) const;
+        GLuint GetHandle() const;
+
+        const ProgramKey& GetKey() const;
+
+      private:
+        void Initialize();
+
+        Device* mDevice;
+        ProgramKey mKey;
+
+        GLuint mProgram = 0;
+        std::vector<std::vector<SamplerUnit>> mUnitsForSamplers;
+        std::vector<std::vector<GLuint>> mUnitsForTextures;
+    };
+
+}}  // namespace dawn_native::opengl
+
+#endif  // DAWNNATIVE_OPENGL_PROGRAMGL_H_
@@ -16,6 +16,7 @@
 
 #include "dawn_native/opengl/CommandBufferGL.h"
 #include "dawn_native/opengl/DeviceGL.h"
+#include "dawn_native/opengl/TextureGL.h"
 #include "dawn_platform/DawnPlatform.h"
 #include "dawn_platform/tracing/TraceEvent.h"
 
@@ -37,4 +38,13 @@ namespace dawn_native { namespace opengl {
         return {};
     }
 
+    MaybeError Queue::LazyClearTexturesImpl(const std::vector<TextureBase*>& textures) {
+        TRACE_EVENT0(GetDevice()->GetPlatform(), Recording, "Queue::LazyClearTextures");
+        for (TextureBase* texture : textures) {
+            ToBackend(texture)->EnsureSubresourceContentInitialized(
+                0, texture->GetNumMipLevels(), 0, texture->GetArrayLayers());
+        }
+        return {};
+    }
+
 }}  // namespace dawn_native::opengl
@@ -16,6 +16,7 @@
 
 #include "common/Assert.h"
 #include "common/Platform.h"
+#include "dawn_native/ShaderCompileTracker.h"
 #include "dawn_native/opengl/DeviceGL.h"
 
 #include <spirv_glsl.hpp>
@@ -121,7 +122,7 @@ namespace dawn_native { namespace opengl {
         compiler->set_common_options(options);
         }
 
-        DAWN_TRY(ExtractSpirvInfo(*compiler));
+        DAWN_TRY(ExtractSpirvInfo());
 
         const ShaderModuleBase::ModuleBindingInfo& bindingInfo = GetBindingInfo();
 
@@ -189,6 +190,7 @@ namespace dawn_native { namespace opengl {
             }
         }
 
+        ScopedShaderCompileTimer timer(GetDevice(), ShaderCompilePhase::Translation, {this});
         if (GetDevice()->IsToggleEnabled(Toggle::UseSpvc)) {
             shaderc_spvc::CompilationResult result;
             DAWN_TRY(CheckSpvcSuccess(mSpvcContext.CompileShader(&result),
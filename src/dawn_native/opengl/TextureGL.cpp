@@ -411,6 +411,10 @@ namespace dawn_native { namespace opengl {
         }
     }
 
+    void TextureView::DeleteThis() {
+        ToBackend(GetDevice())->GetTextureViewPool()->Free(this);
+    }
+
     GLuint TextureView::GetHandle() const {
         ASSERT(mHandle != 0);
         return mHandle;
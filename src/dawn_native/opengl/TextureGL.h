@@ -17,6 +17,7 @@
 
 #include "dawn_native/Texture.h"
 
+#include "common/PlacementAllocated.h"
 #include "dawn_native/opengl/opengl_platform.h"
 
 namespace dawn_native { namespace opengl {
@@ -54,7 +55,7 @@ namespace dawn_native { namespace opengl {
         GLenum mTarget;
     };
 
-    class TextureView : public TextureViewBase {
+    class TextureView : public TextureViewBase, public PlacementAllocated {
       public:
         TextureView(TextureBase* texture, const TextureViewDescriptor* descriptor);
         ~TextureView();
@@ -63,6 +64,8 @@ namespace dawn_native { namespace opengl {
         GLenum GetGLTarget() const;
 
       private:
+        void DeleteThis() override;
+
         GLuint mHandle;
         GLenum mTarget;
         bool mOwnsHandle;
@@ -167,11 +167,13 @@ namespace dawn_native { namespace vulkan {
         const BindGroupDescriptor* descriptor) {
         DescriptorSetAllocation descriptorSetAllocation;
         DAWN_TRY_ASSIGN(descriptorSetAllocation, AllocateOneDescriptorSet());
+        device->GetObjectPoolCounters()->AddAllocation(PooledObjectType::BindGroup);
         return mBindGroupAllocator.Allocate(device, descriptor, descriptorSetAllocation);
     }
 
     void BindGroupLayout::DeallocateBindGroup(BindGroup* bindGroup) {
         mBindGroupAllocator.Deallocate(bindGroup);
+        GetDevice()->GetObjectPoolCounters()->AddDeallocation(PooledObjectType::BindGroup);
     }
 
     ResultOrError<DescriptorSetAllocation> BindGroupLayout::AllocateOneDescriptorSet() {
@@ -293,7 +293,9 @@ namespace dawn_native { namespace vulkan {
     // static
     CommandBuffer* CommandBuffer::Create(CommandEncoder* encoder,
                                          const CommandBufferDescriptor* descriptor) {
-        return new CommandBuffer(encoder, descriptor);
+        return ToBackend(encoder->GetDevice())
+            ->GetCommandBufferPool()
+            ->Allocate(encoder, descriptor);
     }
 
     CommandBuffer::CommandBuffer(CommandEncoder* encoder, const CommandBufferDescriptor* descriptor)
@@ -304,6 +306,10 @@ namespace dawn_native { namespace vulkan {
         FreeCommands(&mCommands);
     }
 
+    void CommandBuffer::DeleteThis() {
+        ToBackend(GetDevice())->GetCommandBufferPool()->Free(this);
+    }
+
     void CommandBuffer::RecordCopyImageWithTemporaryBuffer(
         CommandRecordingContext* recordingContext,
         const TextureCopy& srcCopy,
@@ -19,6 +19,7 @@
 #include "dawn_native/CommandBuffer.h"
 #include "dawn_native/Error.h"
 
+#include "common/PlacementAllocated.h"
 #include "common/vulkan_platform.h"
 
 namespace dawn_native {
@@ -31,16 +32,17 @@ namespace dawn_native { namespace vulkan {
     struct CommandRecordingContext;
     class Device;
 
-    class CommandBuffer : public CommandBufferBase {
+    class CommandBuffer : public CommandBufferBase, public PlacementAllocated {
       public:
         static CommandBuffer* Create(CommandEncoder* encoder,
                                      const CommandBufferDescriptor* descriptor);
+        CommandBuffer(CommandEncoder* encoder, const CommandBufferDescriptor* descriptor);
         ~CommandBuffer();
 
         MaybeError RecordCommands(CommandRecordingContext* recordingContext);
 
       private:
-        CommandBuffer(CommandEncoder* encoder, const CommandBufferDescriptor* descriptor);
+        void DeleteThis() override;
 
         void RecordComputePass(CommandRecordingContext* recordingContext);
         MaybeError RecordRenderPass(CommandRecordingContext* recordingContext,
@@ -30,6 +30,7 @@
 #include "dawn_native/vulkan/ComputePipelineVk.h"
 #include "dawn_native/vulkan/DescriptorSetService.h"
 #include "dawn_native/vulkan/FencedDeleter.h"
+#include "dawn_native/vulkan/PipelineCacheVk.h"
 #include "dawn_native/vulkan/PipelineLayoutVk.h"
 #include "dawn_native/vulkan/QueueVk.h"
 #include "dawn_native/vulkan/RenderPassCache.h"
@@ -45,7 +46,9 @@
 namespace dawn_native { namespace vulkan {
 
     Device::Device(Adapter* adapter, const DeviceDescriptor* descriptor)
-        : DeviceBase(adapter, descriptor) {
+        : DeviceBase(adapter, descriptor),
+          mCommandBufferPool(GetObjectPoolCounters(), PooledObjectType::CommandBuffer),
+          mTextureViewPool(GetObjectPoolCounters(), PooledObjectType::TextureView) {
         InitTogglesFromDriver();
         if (descriptor != nullptr) {
             ApplyToggleOverrides(descriptor);
@@ -77,6 +80,9 @@ namespace dawn_native { namespace vulkan {
         mRenderPassCache = std::make_unique<RenderPassCache>(this);
         mResourceMemoryAllocator = std::make_unique<ResourceMemoryAllocator>(this);
 
+        mPipelineCache = std::make_unique<PipelineCache>(this);
+        DAWN_TRY(mPipelineCache->Initialize());
+
         mExternalMemoryService = std::make_unique<external_memory::Service>(this);
         mExternalSemaphoreService = std::make_unique<external_semaphore::Service>(this);
 
@@ -93,6 +99,7 @@ namespace dawn_native { namespace vulkan {
         BaseDestructor();
 
         mDescriptorSetService = nullptr;
+        mPipelineCache = nullptr;
 
         // The frontend asserts DynamicUploader is destructed by the backend.
         // It is usually destructed in Destroy(), but Destroy isn't always called if device
@@ -176,6 +183,14 @@ namespace dawn_native { namespace vulkan {
         return TextureView::Create(texture, descriptor);
     }
 
+    bool Device::IsShaderModuleCreationThreadSafe() const {
+        // ShaderModule::Create only reflects the module, reads the toggles and format table that
+        // don't change after the device is created, records statistics in the mutex-protected
+        // ShaderCompileTracker, and calls vkCreateShaderModule which has no externally
+        // synchronized parameters.
+        return true;
+    }
+
     Serial Device::GetCompletedCommandSerial() const {
         return mCompletedSerial;
     }
@@ -202,6 +217,7 @@ namespace dawn_native { namespace vulkan {
         mResourceMemoryAllocator->Tick(mCompletedSerial);
 
         mDeleter->Tick(mCompletedSerial);
+        mPipelineCache->Tick(mCompletedSerial);
 
         if (mRecordingContext.used) {
             DAWN_TRY(SubmitPendingCommands());
@@ -238,6 +254,14 @@ namespace dawn_native { namespace vulkan {
         return mMapRequestTracker.get();
     }
 
+    ObjectPool<CommandBuffer>* Device::GetCommandBufferPool() {
+        return &mCommandBufferPool;
+    }
+
+    ObjectPool<TextureView>* Device::GetTextureViewPool() {
+        return &mTextureViewPool;
+    }
+
     DescriptorSetService* Device::GetDescriptorSetService() const {
         return mDescriptorSetService.get();
     }
@@ -246,6 +270,10 @@ namespace dawn_native { namespace vulkan {
         return mDeleter.get();
     }
 
+    PipelineCache* Device::GetPipelineCache() const {
+        return mPipelineCache.get();
+    }
+
     RenderPassCache* Device::GetRenderPassCache() const {
         return mRenderPassCache.get();
     }
@@ -770,6 +798,27 @@ namespace dawn_native { namespace vulkan {
         return {};
     }
 
+    ResultOrError<bool> Device::WaitForCompletionImpl(Serial serial, uint64_t timeoutNs) {
+        CheckPassedFences();
+        if (mCompletedSerial >= serial) {
+            return true;
+        }
+
+        // Fences are signaled in submission order so it is enough to wait for the oldest one
+        // in flight, the caller waits again if |serial| isn't completed after that.
+        ASSERT(!mFencesInFlight.empty());
+        VkFence fence = mFencesInFlight.front().first;
+        VkResult result = VkResult::WrapUnsafe(INJECT_ERROR_OR_RUN(
+            fn.WaitForFences(mVkDevice, 1, &*fence, true, timeoutNs), VK_ERROR_DEVICE_LOST));
+        if (result == VK_TIMEOUT) {
+            return false;
+        }
+        DAWN_TRY(CheckVkSuccessImpl(result, "vkWaitForFences"));
+
+        CheckPassedFences();
+        return true;
+    }
+
     void Device::Destroy() {
         ASSERT(mLossStatus != LossStatus::AlreadyLost);
 
@@ -818,6 +867,13 @@ namespace dawn_native { namespace vulkan {
         // The VkRenderPasses in the cache can be destroyed immediately since all commands referring
         // to them are guaranteed to be finished executing.
         mRenderPassCache = nullptr;
+
+        // Store the pipeline cache one last time so that the next run of the application gets
+        // all the pipelines of this one. The data of a lost device might not be usable.
+        if (mLossStatus == LossStatus::Alive) {
+            mPipelineCache->Store();
+        }
+        mPipelineCache = nullptr;
     }
 
 }}  // namespace dawn_native::vulkan
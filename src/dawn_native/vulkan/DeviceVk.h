@@ -38,6 +38,7 @@ namespace dawn_native { namespace vulkan {
     class DescriptorSetService;
     class FencedDeleter;
     class MapRequestTracker;
+    class PipelineCache;
     class RenderPassCache;
     class ResourceMemoryAllocator;
 
@@ -61,6 +62,7 @@ namespace dawn_native { namespace vulkan {
         DescriptorSetService* GetDescriptorSetService() const;
         FencedDeleter* GetFencedDeleter() const;
         MapRequestTracker* GetMapRequestTracker() const;
+        PipelineCache* GetPipelineCache() const;
         RenderPassCache* GetRenderPassCache() const;
 
         CommandRecordingContext* GetPendingRecordingContext();
@@ -80,6 +82,8 @@ namespace dawn_native { namespace vulkan {
         // Dawn API
         CommandBufferBase* CreateCommandBuffer(CommandEncoder* encoder,
                                                const CommandBufferDescriptor* descriptor) override;
+        ObjectPool<CommandBuffer>* GetCommandBufferPool();
+        ObjectPool<TextureView>* GetTextureViewPool();
 
         Serial GetCompletedCommandSerial() const final override;
         Serial GetLastSubmittedCommandSerial() const final override;
@@ -126,6 +130,7 @@ namespace dawn_native { namespace vulkan {
         ResultOrError<TextureViewBase*> CreateTextureViewImpl(
             TextureBase* texture,
             const TextureViewDescriptor* descriptor) override;
+        bool IsShaderModuleCreationThreadSafe() const override;
 
         ResultOrError<VulkanDeviceKnobs> CreateDevice(VkPhysicalDevice physicalDevice);
         void GatherQueueFromDevice();
@@ -135,6 +140,7 @@ namespace dawn_native { namespace vulkan {
 
         void Destroy() override;
         MaybeError WaitForIdleForDestruction() override;
+        ResultOrError<bool> WaitForCompletionImpl(Serial serial, uint64_t timeoutNs) override;
 
         // To make it easier to use fn it is a public const member. However
         // the Device is allowed to mutate them through these private methods.
@@ -148,6 +154,7 @@ namespace dawn_native { namespace vulkan {
         std::unique_ptr<DescriptorSetService> mDescriptorSetService;
         std::unique_ptr<FencedDeleter> mDeleter;
         std::unique_ptr<MapRequestTracker> mMapRequestTracker;
+        std::unique_ptr<PipelineCache> mPipelineCache;
         std::unique_ptr<ResourceMemoryAllocator> mResourceMemoryAllocator;
         std::unique_ptr<RenderPassCache> mRenderPassCache;
 
@@ -180,6 +187,9 @@ namespace dawn_native { namespace vulkan {
         // There is always a valid recording context stored in mRecordingContext
         CommandRecordingContext mRecordingContext;
 
+        ObjectPool<CommandBuffer> mCommandBufferPool;
+        ObjectPool<TextureView> mTextureViewPool;
+
         MaybeError ImportExternalImage(const ExternalImageDescriptor* descriptor,
                                        ExternalMemoryHandle memoryHandle,
                                        VkImage image,
@@ -0,0 +1,164 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn_native/vulkan/PipelineCacheVk.h"
+
+#include "dawn_native/PersistentCache.h"
+#include "dawn_native/vulkan/DeviceVk.h"
+#include "dawn_native/vulkan/VulkanError.h"
+
+#include <cstring>
+#include <string>
+
+namespace dawn_native { namespace vulkan {
+
+    namespace {
+
+        // Bumped when what is stored for the pipeline cache changes.
+        constexpr uint32_t kPipelineCacheVersion = 1;
+
+        // The minimum number of serials between two periodic stores of the cache, since getting
+        // the data of the cache can be expensive.
+        constexpr Serial kSerialsBetweenStores = 300;
+
+        // The header of the data of pipeline caches, defined by the Vulkan specification.
+        struct PipelineCacheHeader {
+            uint32_t headerSize;
+            uint32_t headerVersion;
+            uint32_t vendorID;
+            uint32_t deviceID;
+            uint8_t pipelineCacheUUID[VK_UUID_SIZE];
+        };
+
+        PersistentCacheKey ComputePipelineCacheKey(const VkPhysicalDeviceProperties& properties) {
+            PersistentCacheKey key;
+            AppendToCacheKey(&key, "VkPipelineCache");
+            AppendToCacheKey(&key, kPipelineCacheVersion);
+            AppendToCacheKey(&key, properties.vendorID);
+            AppendToCacheKey(&key, properties.deviceID);
+            AppendToCacheKey(&key, properties.driverVersion);
+            const char* uuid = reinterpret_cast<const char*>(properties.pipelineCacheUUID);
+            AppendToCacheKey(&key, std::string(uuid, VK_UUID_SIZE));
+            return key;
+        }
+
+    }  // anonymous namespace
+
+    PipelineCache::PipelineCache(Device* device) : mDevice(device) {
+    }
+
+    PipelineCache::~PipelineCache() {
+        if (mHandle != VK_NULL_HANDLE) {
+            mDevice->fn.DestroyPipelineCache(mDevice->GetVkDevice(), mHandle, nullptr);
+            mHandle = VK_NULL_HANDLE;
+        }
+    }
+
+    MaybeError PipelineCache::Initialize() {
+        std::vector<uint8_t> data;
+        PersistentCache* persistentCache = mDevice->GetPersistentCache();
+        if (persistentCache->IsEnabled()) {
+            data = persistentCache->LoadData(
+                ComputePipelineCacheKey(mDevice->GetDeviceInfo().properties));
+            if (!IsCompatibleData(data)) {
+                data.clear();
+            }
+        }
+
+        VkPipelineCacheCreateInfo createInfo;
+        createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = 0;
+
+        if (!data.empty()) {
+            createInfo.initialDataSize = data.size();
+            createInfo.pInitialData = data.data();
+            VkResult result = VkResult::WrapUnsafe(mDevice->fn.CreatePipelineCache(
+                mDevice->GetVkDevice(), &createInfo, nullptr, &*mHandle));
+            if (result == VK_SUCCESS) {
+                mWasLoaded = true;
+                return {};
+            }
+            // The driver rejected the data, start from an empty cache instead.
+        }
+
+        createInfo.initialDataSize = 0;
+        createInfo.pInitialData = nullptr;
+        return CheckVkSuccess(mDevice->fn.CreatePipelineCache(mDevice->GetVkDevice(), &createInfo,
+                                                              nullptr, &*mHandle),
+                              "CreatePipelineCache");
+    }
+
+    VkPipelineCache PipelineCache::GetHandle() {
+        mIsDirty = true;
+        return mHandle;
+    }
+
+    void PipelineCache::Tick(Serial completedSerial) {
+        if (mIsDirty && completedSerial >= mLastStoreSerial + kSerialsBetweenStores) {
+            Store();
+            mLastStoreSerial = completedSerial;
+        }
+    }
+
+    void PipelineCache::Store() {
+        PersistentCache* persistentCache = mDevice->GetPersistentCache();
+        if (!mIsDirty || !persistentCache->IsEnabled()) {
+            return;
+        }
+        mIsDirty = false;
+
+        size_t size = 0;
+        VkResult result = VkResult::WrapUnsafe(
+            mDevice->fn.GetPipelineCacheData(mDevice->GetVkDevice(), mHandle, &size, nullptr));
+        if (result != VK_SUCCESS) {
+            return;
+        }
+
+        std::vector<uint8_t> data(size);
+        // VK_INCOMPLETE is returned if the cache grew since its size was queried, in which case
+        // only complete entries are written and the data is still valid.
+        result = VkResult::WrapUnsafe(
+            mDevice->fn.GetPipelineCacheData(mDevice->GetVkDevice(), mHandle, &size, data.data()));
+        if (result != VK_SUCCESS && result != VK_INCOMPLETE) {
+            return;
+        }
+        data.resize(size);
+
+        if (!IsCompatibleData(data)) {
+            return;
+        }
+        persistentCache->StoreData(ComputePipelineCacheKey(mDevice->GetDeviceInfo().properties),
+                                   data.data(), data.size());
+    }
+
+    bool PipelineCache::WasLoadedForTesting() const {
+        return mWasLoaded;
+    }
+
+    bool PipelineCache::IsCompatibleData(const std::vector<uint8_t>& data) const {
+        PipelineCacheHeader header;
+        if (data.size() < sizeof(header)) {
+            return false;
+        }
+        memcpy(&header, data.data(), sizeof(header));
+
+        const VkPhysicalDeviceProperties& properties = mDevice->GetDeviceInfo().properties;
+        return header.headerSize >= sizeof(header) && header.headerSize <= data.size() &&
+               header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+               header.vendorID == properties.vendorID && header.deviceID == properties.deviceID &&
+               memcmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+    }
+
+}}  // namespace dawn_native::vulkan
@@ -0,0 +1,66 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_VULKAN_PIPELINECACHEVK_H_
+#define DAWNNATIVE_VULKAN_PIPELINECACHEVK_H_
+
+#include "common/Serial.h"
+#include "common/vulkan_platform.h"
+#include "dawn_native/Error.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace dawn_native { namespace vulkan {
+
+    class Device;
+
+    // The VkPipelineCache all the pipelines of the device are created with. Its data is loaded from
+    // the blob store of the platform when the device is created, and stored back periodically
+    // and when the device is destroyed, so that the driver doesn't compile the same pipelines
+    // at every run of the application.
+    class PipelineCache {
+      public:
+        PipelineCache(Device* device);
+        ~PipelineCache();
+
+        MaybeError Initialize();
+
+        // Pipelines created with the handle add to the cache, so it is stored again at the next
+        // periodic store.
+        VkPipelineCache GetHandle();
+
+        // Stores the cache periodically if pipelines were created since the last store.
+        void Tick(Serial completedSerial);
+        void Store();
+
+        // Whether the cache was initialized with data from the blob store.
+        bool WasLoadedForTesting() const;
+
+      private:
+        // Returns whether |data| is the data of a pipeline cache of this device that the driver
+        // can use. Drivers should check it too but not all do.
+        bool IsCompatibleData(const std::vector<uint8_t>& data) const;
+
+        Device* mDevice;
+        VkPipelineCache mHandle = VK_NULL_HANDLE;
+
+        bool mIsDirty = false;
+        bool mWasLoaded = false;
+        Serial mLastStoreSerial = 0;
+    };
+
+}}  // namespace dawn_native::vulkan
+
+#endif  // DAWNNATIVE_VULKAN_PIPELINECACHEVK_H_
@@ -17,6 +17,7 @@
 #include "dawn_native/vulkan/CommandBufferVk.h"
 #include "dawn_native/vulkan/CommandRecordingContext.h"
 #include "dawn_native/vulkan/DeviceVk.h"
+#include "dawn_native/vulkan/TextureVk.h"
 #include "dawn_platform/DawnPlatform.h"
 #include "dawn_platform/tracing/TraceEvent.h"
 
@@ -48,4 +49,16 @@ namespace dawn_native { namespace vulkan {
         return {};
     }
 
+    MaybeError Queue::LazyClearTexturesImpl(const std::vector<TextureBase*>& textures) {
+        Device* device = ToBackend(GetDevice());
+
+        TRACE_EVENT0(GetDevice()->GetPlatform(), Recording, "Queue::LazyClearTextures");
+        CommandRecordingContext* recordingContext = device->GetPendingRecordingContext();
+        for (TextureBase* texture : textures) {
+            ToBackend(texture)->EnsureSubresourceContentInitialized(
+                recordingContext, 0, texture->GetNumMipLevels(), 0, texture->GetArrayLayers());
+        }
+        return {};
+    }
+
 }}  // namespace dawn_native::vulkan
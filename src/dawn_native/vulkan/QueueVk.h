@@ -31,6 +31,7 @@ namespace dawn_native { namespace vulkan {
         using QueueBase::QueueBase;
 
         MaybeError SubmitImpl(uint32_t commandCount, CommandBufferBase* const* commands) override;
+        MaybeError LazyClearTexturesImpl(const std::vector<TextureBase*>& textures) override;
     };
 
 }}  // namespace dawn_native::vulkan
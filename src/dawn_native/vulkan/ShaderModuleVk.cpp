@@ -14,12 +14,11 @@
 
 #include "dawn_native/vulkan/ShaderModuleVk.h"
 
+#include "dawn_native/ShaderCompileTracker.h"
 #include "dawn_native/vulkan/DeviceVk.h"
 #include "dawn_native/vulkan/FencedDeleter.h"
 #include "dawn_native/vulkan/VulkanError.h"
 
-#include <spirv_cross.hpp>
-
 namespace dawn_native { namespace vulkan {
 
     // static
@@ -37,23 +36,16 @@ namespace dawn_native { namespace vulkan {
     }
 
     MaybeError ShaderModule::Initialize(const ShaderModuleDescriptor* descriptor) {
-        // Use SPIRV-Cross to extract info from the SPIRV even if Vulkan consumes SPIRV. We want to
-        // have a translation step eventually anyway.
+        // Reflect the SPIRV even if Vulkan consumes SPIRV. We want to have a translation step
+        // eventually anyway.
         if (GetDevice()->IsToggleEnabled(Toggle::UseSpvc)) {
             shaderc_spvc::CompileOptions options = GetCompileOptions();
 
             DAWN_TRY(CheckSpvcSuccess(
                 mSpvcContext.InitializeForVulkan(descriptor->code, descriptor->codeSize, options),
                 "Unable to initialize instance of spvc"));
-
-            spirv_cross::Compiler* compiler;
-            DAWN_TRY(CheckSpvcSuccess(mSpvcContext.GetCompiler(reinterpret_cast<void**>(&compiler)),
-                                      "Unable to get cross compiler"));
-            DAWN_TRY(ExtractSpirvInfo(*compiler));
-        } else {
-            spirv_cross::Compiler compiler(descriptor->code, descriptor->codeSize);
-            DAWN_TRY(ExtractSpirvInfo(compiler));
         }
+        DAWN_TRY(ExtractSpirvInfo());
 
         VkShaderModuleCreateInfo createInfo;
         createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
@@ -61,6 +53,7 @@ namespace dawn_native { namespace vulkan {
         createInfo.flags = 0;
         std::vector<uint32_t> vulkanSource;
         if (GetDevice()->IsToggleEnabled(Toggle::UseSpvc)) {
+            ScopedShaderCompileTimer timer(GetDevice(), ShaderCompilePhase::Translation, {this});
             shaderc_spvc::CompilationResult result;
             DAWN_TRY(CheckSpvcSuccess(mSpvcContext.CompileShader(&result),
                                       "Unable to generate Vulkan shader"));
@@ -74,6 +67,7 @@ namespace dawn_native { namespace vulkan {
         }
 
         Device* device = ToBackend(GetDevice());
+        ScopedShaderCompileTimer timer(device, ShaderCompilePhase::BackendCompilation, {this});
         return CheckVkSuccess(
             device->fn.CreateShaderModule(device->GetVkDevice(), &createInfo, nullptr, &*mHandle),
             "CreateShaderModule");
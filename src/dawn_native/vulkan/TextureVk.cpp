@@ -803,9 +803,10 @@ namespace dawn_native { namespace vulkan {
     // static
     ResultOrError<TextureView*> TextureView::Create(TextureBase* texture,
                                                     const TextureViewDescriptor* descriptor) {
-        std::unique_ptr<TextureView> view = std::make_unique<TextureView>(texture, descriptor);
+        Ref<TextureView> view = AcquireRef(
+            ToBackend(texture->GetDevice())->GetTextureViewPool()->Allocate(texture, descriptor));
         DAWN_TRY(view->Initialize(descriptor));
-        return view.release();
+        return view.Detach();
     }
 
     MaybeError TextureView::Initialize(const TextureViewDescriptor* descriptor) {
@@ -840,6 +841,10 @@ namespace dawn_native { namespace vulkan {
         }
     }
 
+    void TextureView::DeleteThis() {
+        ToBackend(GetDevice())->GetTextureViewPool()->Free(this);
+    }
+
     VkImageView TextureView::GetHandle() const {
         return mHandle;
     }
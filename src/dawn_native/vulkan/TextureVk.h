@@ -17,6 +17,7 @@
 
 #include "dawn_native/Texture.h"
 
+#include "common/PlacementAllocated.h"
 #include "common/vulkan_platform.h"
 #include "dawn_native/ResourceMemoryAllocation.h"
 #include "dawn_native/vulkan/ExternalHandle.h"
@@ -113,7 +114,7 @@ namespace dawn_native { namespace vulkan {
         wgpu::TextureUsage mLastUsage = wgpu::TextureUsage::None;
     };
 
-    class TextureView : public TextureViewBase {
+    class TextureView : public TextureViewBase, public PlacementAllocated {
       public:
         static ResultOrError<TextureView*> Create(TextureBase* texture,
                                                   const TextureViewDescriptor* descriptor);
@@ -122,6 +123,8 @@ namespace dawn_native { namespace vulkan {
         VkImageView GetHandle() const;
 
       private:
+        void DeleteThis() override;
+
         using TextureViewBase::TextureViewBase;
         MaybeError Initialize(const TextureViewDescriptor* descriptor);
 
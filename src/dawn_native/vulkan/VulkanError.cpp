@@ -77,9 +77,9 @@ namespace dawn_native { namespace vulkan {
         std::string message = std::string(context) + " failed with " + VkResultAsString(result);
 
         if (result == VK_ERROR_DEVICE_LOST) {
-            return DAWN_DEVICE_LOST_ERROR(message);
+            return DAWN_MAKE_ERROR_FROM_STRING(InternalErrorType::DeviceLost, message);
         } else {
-            return DAWN_INTERNAL_ERROR(message);
+            return DAWN_MAKE_ERROR_FROM_STRING(InternalErrorType::Internal, message);
         }
     }
 
@@ -91,11 +91,11 @@ namespace dawn_native { namespace vulkan {
         std::string message = std::string(context) + " failed with " + VkResultAsString(result);
 
         if (result == VK_ERROR_OUT_OF_DEVICE_MEMORY || result == VK_FAKE_DEVICE_OOM_FOR_TESTING) {
-            return DAWN_OUT_OF_MEMORY_ERROR(message);
+            return DAWN_MAKE_ERROR_FROM_STRING(InternalErrorType::OutOfMemory, message);
         } else if (result == VK_ERROR_DEVICE_LOST) {
-            return DAWN_DEVICE_LOST_ERROR(message);
+            return DAWN_MAKE_ERROR_FROM_STRING(InternalErrorType::DeviceLost, message);
         } else {
-            return DAWN_INTERNAL_ERROR(message);
+            return DAWN_MAKE_ERROR_FROM_STRING(InternalErrorType::Internal, message);
         }
     }
 
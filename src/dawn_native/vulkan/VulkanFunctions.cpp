@@ -22,7 +22,7 @@ namespace dawn_native { namespace vulkan {
 #define GET_GLOBAL_PROC(name)                                                          \
     name = reinterpret_cast<decltype(name)>(GetInstanceProcAddr(nullptr, "vk" #name)); \
     if (name == nullptr) {                                                             \
-        return DAWN_INTERNAL_ERROR(std::string("Couldn't get proc vk") + #name);       \
+        return DAWN_INTERNAL_ERROR("Couldn't get proc vk" #name);                      \
     }
 
     MaybeError VulkanFunctions::LoadGlobalProcs(const DynamicLib& vulkanLib) {
@@ -44,7 +44,7 @@ namespace dawn_native { namespace vulkan {
 #define GET_INSTANCE_PROC_BASE(name, procName)                                              \
     name = reinterpret_cast<decltype(name)>(GetInstanceProcAddr(instance, "vk" #procName)); \
     if (name == nullptr) {                                                                  \
-        return DAWN_INTERNAL_ERROR(std::string("Couldn't get proc vk") + #procName);        \
+        return DAWN_INTERNAL_ERROR("Couldn't get proc vk" #procName);                       \
     }
 
 #define GET_INSTANCE_PROC(name) GET_INSTANCE_PROC_BASE(name, name)
@@ -147,7 +147,7 @@ namespace dawn_native { namespace vulkan {
 #define GET_DEVICE_PROC(name)                                                       \
     name = reinterpret_cast<decltype(name)>(GetDeviceProcAddr(device, "vk" #name)); \
     if (name == nullptr) {                                                          \
-        return DAWN_INTERNAL_ERROR(std::string("Couldn't get proc vk") + #name);    \
+        return DAWN_INTERNAL_ERROR("Couldn't get proc vk" #name);                   \
     }
 
     MaybeError VulkanFunctions::LoadDeviceProcs(VkDevice device,
@@ -19,6 +19,7 @@
 #include <dawn/webgpu.h>
 #include <dawn_native/dawn_native_export.h>
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -172,9 +173,103 @@ namespace dawn_native {
     // Query the names of all the toggles that are enabled in device
     DAWN_NATIVE_EXPORT std::vector<const char*> GetTogglesUsed(WGPUDevice device);
 
+    // Timeout for the Wait functions below that never expires.
+    constexpr uint64_t kWaitTimeoutInfinite = UINT64_MAX;
+
+    // Blocks the calling thread until the completed value of |fence| reaches |value| or until
+    // |timeoutNs| nanoseconds pass, using the backend's wait primitives instead of polling. The
+    // device is ticked while waiting so the callbacks that become ready are called. Returns
+    // whether the value was reached. It is an error to wait for a value that isn't signaled.
+    DAWN_NATIVE_EXPORT bool WaitForFence(WGPUFence fence, uint64_t value, uint64_t timeoutNs);
+
+    // Same as WaitForFence but waits until the callbacks of all the buffer map requests made on
+    // |device| before the call were called.
+    DAWN_NATIVE_EXPORT bool WaitForBufferMapping(WGPUDevice device, uint64_t timeoutNs);
+
+    // Delivers the callbacks that became ready on the background tick thread of a device created
+    // with the "tick_on_background_thread" toggle. Any other API call on the device delivers them
+    // too.
+    DAWN_NATIVE_EXPORT void ProcessEvents(WGPUDevice device);
+
+    // Creates |count| shader modules like calling Device::CreateShaderModule for each descriptor,
+    // but runs the SPIR-V validation, reflection and translation of the modules in parallel on
+    // worker threads on the backends that support it (currently Vulkan). The modules are
+    // returned in the order of the descriptors and their errors are reported in that order too.
+    DAWN_NATIVE_EXPORT std::vector<WGPUShaderModule> CreateShaderModules(
+        WGPUDevice device,
+        uint32_t count,
+        const WGPUShaderModuleDescriptor* descriptors);
+
+    // The time spent in one of the phases of the compilation of shaders.
+    struct ShaderCompilePhaseStatistics {
+        uint64_t count = 0;
+        double totalMilliseconds = 0;
+        double maxMilliseconds = 0;
+    };
+
+    // The time spent on all the phases for the shader modules with the same code, including the
+    // creation of the pipelines using them. |codeSize| is in 32-bit words like in the descriptor.
+    struct ShaderModuleCompileStatistics {
+        uint64_t contentHash = 0;
+        uint32_t codeSize = 0;
+        double totalMilliseconds = 0;
+    };
+
+    struct ShaderCompileStatistics {
+        ShaderCompilePhaseStatistics validation;
+        ShaderCompilePhaseStatistics reflection;
+        ShaderCompilePhaseStatistics translation;
+        ShaderCompilePhaseStatistics backendCompilation;
+        ShaderCompilePhaseStatistics pipelineCreation;
+        // Sorted from the module that took the most time to the one that took the least.
+        std::vector<ShaderModuleCompileStatistics> modules;
+    };
+
+    // Returns the time spent compiling shaders on |device| since its creation. Translation is the
+    // generation of GLSL, HLSL or MSL and backend compilation is the work of the driver. The
+    // statistics are only recorded when the "record_shader_compile_statistics" toggle is enabled.
+    DAWN_NATIVE_EXPORT ShaderCompileStatistics GetShaderCompileStatistics(WGPUDevice device);
+
     // Backdoor to get the number of lazy clears for testing
     DAWN_NATIVE_EXPORT size_t GetLazyClearCountForTesting(WGPUDevice device);
 
+    // Backdoor to get the number of batches of lazy clears executed at Queue::Submit for testing
+    DAWN_NATIVE_EXPORT size_t GetLazyClearBatchCountForTesting(WGPUDevice device);
+
+    // Backdoor to get the number of shader modules whose SPIR-V was validated for testing
+    DAWN_NATIVE_EXPORT size_t GetSpirvValidationCountForTesting(WGPUDevice device);
+
+    // Backdoor to get the number of redundant commands dropped by the encoders for testing
+    DAWN_NATIVE_EXPORT size_t GetElidedCommandCountForTesting(WGPUDevice device);
+
+    // Backdoor to get the number of command buffers waiting for coalesced submits for testing
+    DAWN_NATIVE_EXPORT size_t GetPendingCommandBufferCountForTesting(WGPUDevice device);
+
+    // Backdoor to get the size of the staging memory that isn't reclaimed yet for testing
+    DAWN_NATIVE_EXPORT uint64_t GetUsedStagingMemoryForTesting(WGPUDevice device);
+
+    // Backdoor to get the number of callbacks deferred by the background tick thread for testing
+    DAWN_NATIVE_EXPORT size_t GetDeferredCallbackCountForTesting(WGPUDevice device);
+
+    // Backdoor to wait until |count| background ticks that started after the call have finished
+    // for testing
+    DAWN_NATIVE_EXPORT void WaitForBackgroundTicksForTesting(WGPUDevice device, uint32_t count);
+
+    // The number of objects of each of the types allocated from per-device pools.
+    struct PooledObjectCounts {
+        uint64_t bindGroups = 0;
+        uint64_t commandBuffers = 0;
+        uint64_t commandEncoders = 0;
+        uint64_t computePassEncoders = 0;
+        uint64_t renderPassEncoders = 0;
+        uint64_t textureViews = 0;
+    };
+
+    // Backdoors to get the number of pooled objects allocated since the creation of the device,
+    // and the number of them that are still alive, for testing
+    DAWN_NATIVE_EXPORT PooledObjectCounts GetPooledAllocationCountsForTesting(WGPUDevice device);
+    DAWN_NATIVE_EXPORT PooledObjectCounts GetPooledLiveObjectCountsForTesting(WGPUDevice device);
+
     //  Query if texture has been initialized
     DAWN_NATIVE_EXPORT bool IsTextureSubresourceInitialized(WGPUTexture texture,
                                                             uint32_t baseMipLevel,
@@ -32,6 +32,16 @@ namespace dawn_native { namespace opengl {
     DAWN_NATIVE_EXPORT WGPUTextureFormat
     GetNativeSwapChainPreferredFormat(const DawnSwapChainImplementation* swapChain);
 
+    // The number of GL programs created for pipelines, and the number of times a pipeline reused
+    // the program of another pipeline instead, since the creation of the device.
+    struct ProgramCounts {
+        uint64_t created = 0;
+        uint64_t reused = 0;
+    };
+
+    // Backdoor to get the number of programs created and reused for testing
+    DAWN_NATIVE_EXPORT ProgramCounts GetProgramCountsForTesting(WGPUDevice device);
+
 }}  // namespace dawn_native::opengl
 
 #endif  // DAWNNATIVE_OPENGLBACKEND_H_
@@ -17,6 +17,7 @@
 
 #include <dawn_native/dawn_native_export.h>
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace dawn_platform {
@@ -28,6 +29,28 @@ namespace dawn_platform {
         GPUWork,     // Actual GPU work
     };
 
+    // A store of blobs provided by the embedder so that Dawn can persist data between runs of the
+    // application, like compiled shaders. The keys are arbitrary bytes and may be large: the
+    // embedder may hash them but must then make sure that colliding keys don't return the value
+    // of another key.
+    class DAWN_NATIVE_EXPORT CachingInterface {
+      public:
+        virtual ~CachingInterface() {
+        }
+
+        // Returns the size of the value stored for |key|, or 0 if there is none. The value is
+        // copied in |value| if |valueSize| is at least its size, so |value| may be nullptr with
+        // |valueSize| 0 to query the size of the value.
+        virtual size_t LoadData(const void* key, size_t keySize, void* value, size_t valueSize) = 0;
+
+        // Stores |value| for |key|, replacing any previous value. The embedder may drop values at
+        // any time, for example to limit the size of the store.
+        virtual void StoreData(const void* key,
+                               size_t keySize,
+                               const void* value,
+                               size_t valueSize) = 0;
+    };
+
     class DAWN_NATIVE_EXPORT Platform {
       public:
         virtual ~Platform() {
@@ -46,6 +69,12 @@ namespace dawn_platform {
                                        const unsigned char* argTypes,
                                        const uint64_t* argValues,
                                        unsigned char flags) = 0;
+
+        // Returns the store in which Dawn persists data, or nullptr if it shouldn't persist any.
+        // It must stay valid as long as the platform is used by an instance.
+        virtual CachingInterface* GetCachingInterface() {
+            return nullptr;
+        }
     };
 
 }  // namespace dawn_platform
@@ -22,6 +22,7 @@
 #include "common/SystemUtils.h"
 #include "dawn/dawn_proc.h"
 #include "dawn_native/DawnNative.h"
+#include "dawn_platform/DawnPlatform.h"
 #include "dawn_wire/WireClient.h"
 #include "dawn_wire/WireServer.h"
 #include "utils/SystemUtils.h"
@@ -149,7 +150,15 @@ void InitDawnEnd2EndTestEnvironment(int argc, char** argv) {
 DawnTestEnvironment::DawnTestEnvironment(int argc, char** argv) {
     for (int i = 1; i < argc; ++i) {
         if (strcmp("-w", argv[i]) == 0 || strcmp("--use-wire", argv[i]) == 0) {
+#if defined(DAWN_ENABLE_DIRECT_DISPATCH)
+            // The webgpu.h functions always call into dawn_native, they can't be redirected to
+            // the wire client.
+            dawn::WarningLog() << "The wire can't be used when dawn_native is called directly, "
+                                  "ignoring "
+                               << argv[i];
+#else
             mUseWire = true;
+#endif
             continue;
         }
 
@@ -298,6 +307,13 @@ void DawnTestEnvironment::SetUp() {
                        "---------------------\n"
                        "UseWire: "
                     << (mUseWire ? "true" : "false")
+                    << "\n"
+                       "DirectDispatch: "
+#if defined(DAWN_ENABLE_DIRECT_DISPATCH)
+                    << "true"
+#else
+                    << "false"
+#endif
                     << "\n"
                        "EnableBackendValidation: "
                     << (mEnableBackendValidation ? "true" : "false")
@@ -441,7 +457,9 @@ DawnTestBase::~DawnTestBase() {
         backendProcs.deviceRelease(backendDevice);
     }
 
+#if !defined(DAWN_ENABLE_DIRECT_DISPATCH)
     dawnProcSetProcs(nullptr);
+#endif
 }
 
 bool DawnTestBase::IsD3D12() const {
@@ -548,6 +566,10 @@ std::vector<const char*> DawnTestBase::GetRequiredExtensions() {
     return {};
 }
 
+std::unique_ptr<dawn_platform::Platform> DawnTestBase::CreateTestPlatform() {
+    return nullptr;
+}
+
 const wgpu::AdapterProperties& DawnTestBase::GetAdapterProperties() const {
     return mAdapterProperties;
 }
@@ -572,6 +594,11 @@ bool DawnTestBase::SupportsExtensions(const std::vector<const char*>& extensions
 }
 
 void DawnTestBase::SetUp() {
+    mTestPlatform = CreateTestPlatform();
+    if (mTestPlatform != nullptr) {
+        gTestEnv->GetInstance()->SetPlatform(mTestPlatform.get());
+    }
+
     // Initialize mBackendAdapter, and create the device.
     const wgpu::BackendType backendType = mParam.backendType;
     {
@@ -723,7 +750,11 @@ void DawnTestBase::SetUp() {
 
     // Set up the device and queue because all tests need them, and DawnTestBase needs them too for
     // the deferred expectations.
+#if defined(DAWN_ENABLE_DIRECT_DISPATCH)
+    DAWN_UNUSED(procs);
+#else
     dawnProcSetProcs(&procs);
+#endif
     device = wgpu::Device::Acquire(cDevice);
     queue = device.CreateQueue();
 
@@ -740,6 +771,10 @@ void DawnTestBase::TearDown() {
     for (size_t i = 0; i < mReadbackSlots.size(); ++i) {
         mReadbackSlots[i].buffer.Unmap();
     }
+
+    if (mTestPlatform != nullptr) {
+        gTestEnv->GetInstance()->SetPlatform(nullptr);
+    }
 }
 
 bool DawnTestBase::HasAdapter() const {
@@ -247,11 +247,17 @@ class DawnTestBase {
     // code path to handle the situation when not all extensions are supported.
     virtual std::vector<const char*> GetRequiredExtensions();
 
+    // Called in SetUp() to get a platform the instance uses for the duration of the test, for
+    // example to provide a blob store. The instance keeps its platform when it returns nullptr.
+    virtual std::unique_ptr<dawn_platform::Platform> CreateTestPlatform();
+
     const wgpu::AdapterProperties& GetAdapterProperties() const;
 
   private:
     DawnTestParam mParam;
 
+    std::unique_ptr<dawn_platform::Platform> mTestPlatform;
+
     // Things used to set up testing through the Wire.
     std::unique_ptr<dawn_wire::WireServer> mWireServer;
     std::unique_ptr<dawn_wire::WireClient> mWireClient;
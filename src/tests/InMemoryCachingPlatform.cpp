@@ -0,0 +1,94 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/InMemoryCachingPlatform.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+    std::vector<uint8_t> ToBytes(const void* data, size_t size) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        return std::vector<uint8_t>(bytes, bytes + size);
+    }
+
+}  // anonymous namespace
+
+size_t InMemoryCache::LoadData(const void* key, size_t keySize, void* value, size_t valueSize) {
+    auto it = mEntries.find(ToBytes(key, keySize));
+    if (it == mEntries.end()) {
+        return 0;
+    }
+
+    const std::vector<uint8_t>& entry = it->second;
+    if (valueSize >= entry.size()) {
+        memcpy(value, entry.data(), entry.size());
+        mHitCount++;
+    }
+    return entry.size();
+}
+
+void InMemoryCache::StoreData(const void* key,
+                              size_t keySize,
+                              const void* value,
+                              size_t valueSize) {
+    mEntries[ToBytes(key, keySize)] = ToBytes(value, valueSize);
+    mStoreCount++;
+}
+
+size_t InMemoryCache::GetHitCount() const {
+    return mHitCount;
+}
+
+size_t InMemoryCache::GetStoreCount() const {
+    return mStoreCount;
+}
+
+void InMemoryCache::ClobberValues() {
+    for (auto& it : mEntries) {
+        std::fill(it.second.begin(), it.second.end(), 0);
+    }
+}
+
+InMemoryCache* InMemoryCachingPlatform::GetCache() {
+    return &mCache;
+}
+
+dawn_platform::CachingInterface* InMemoryCachingPlatform::GetCachingInterface() {
+    return &mCache;
+}
+
+const unsigned char* InMemoryCachingPlatform::GetTraceCategoryEnabledFlag(
+    dawn_platform::TraceCategory category) {
+    static const unsigned char kDisabled = 0;
+    return &kDisabled;
+}
+
+double InMemoryCachingPlatform::MonotonicallyIncreasingTime() {
+    return 0;
+}
+
+uint64_t InMemoryCachingPlatform::AddTraceEvent(char phase,
+                                                const unsigned char* categoryGroupEnabled,
+                                                const char* name,
+                                                uint64_t id,
+                                                double timestamp,
+                                                int numArgs,
+                                                const char** argNames,
+                                                const unsigned char* argTypes,
+                                                const uint64_t* argValues,
+                                                unsigned char flags) {
+    return 0;
+}
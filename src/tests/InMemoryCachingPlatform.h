@@ -0,0 +1,68 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TESTS_INMEMORYCACHINGPLATFORM_H_
+#define TESTS_INMEMORYCACHINGPLATFORM_H_
+
+#include <dawn_platform/DawnPlatform.h>
+
+#include <map>
+#include <vector>
+
+// A blob store in memory that counts how many times it is used.
+class InMemoryCache : public dawn_platform::CachingInterface {
+  public:
+    size_t LoadData(const void* key, size_t keySize, void* value, size_t valueSize) override;
+    void StoreData(const void* key, size_t keySize, const void* value, size_t valueSize) override;
+
+    // The number of times a value was copied out of the cache, and stored in it.
+    size_t GetHitCount() const;
+    size_t GetStoreCount() const;
+
+    // Overwrites all the values with zeroes of the same size, to test data that isn't valid.
+    void ClobberValues();
+
+  private:
+    std::map<std::vector<uint8_t>, std::vector<uint8_t>> mEntries;
+    size_t mHitCount = 0;
+    size_t mStoreCount = 0;
+};
+
+// A platform that provides an InMemoryCache and doesn't record trace events, for the tests of
+// the data Dawn persists.
+class InMemoryCachingPlatform : public dawn_platform::Platform {
+  public:
+    InMemoryCache* GetCache();
+
+  private:
+    dawn_platform::CachingInterface* GetCachingInterface() override;
+
+    const unsigned char* GetTraceCategoryEnabledFlag(
+        dawn_platform::TraceCategory category) override;
+    double MonotonicallyIncreasingTime() override;
+    uint64_t AddTraceEvent(char phase,
+                           const unsigned char* categoryGroupEnabled,
+                           const char* name,
+                           uint64_t id,
+                           double timestamp,
+                           int numArgs,
+                           const char** argNames,
+                           const unsigned char* argTypes,
+                           const uint64_t* argValues,
+                           unsigned char flags) override;
+
+    InMemoryCache mCache;
+};
+
+#endif  // TESTS_INMEMORYCACHINGPLATFORM_H_
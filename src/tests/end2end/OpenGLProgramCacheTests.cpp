@@ -0,0 +1,130 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/DawnTest.h"
+
+#include "dawn_native/OpenGLBackend.h"
+#include "tests/InMemoryCachingPlatform.h"
+#include "utils/ComboRenderPipelineDescriptor.h"
+#include "utils/WGPUHelpers.h"
+
+#include <memory>
+
+class OpenGLProgramCacheTests : public DawnTest {
+  protected:
+    std::unique_ptr<dawn_platform::Platform> CreateTestPlatform() override {
+        auto platform = std::make_unique<InMemoryCachingPlatform>();
+        mCache = platform->GetCache();
+        return std::move(platform);
+    }
+
+    wgpu::ComputePipeline CreatePipeline() {
+        wgpu::ShaderModule module =
+            utils::CreateShaderModule(device, utils::SingleShaderStage::Compute, R"(
+                #version 450
+                layout(std140, set = 0, binding = 0) uniform Src { uint value; } src;
+                layout(std430, set = 0, binding = 1) buffer Dst { uint value; } dst;
+                void main() {
+                    dst.value = src.value + 1u;
+                })");
+
+        wgpu::ComputePipelineDescriptor descriptor;
+        descriptor.computeStage.module = module;
+        descriptor.computeStage.entryPoint = "main";
+        return device.CreateComputePipeline(&descriptor);
+    }
+
+    InMemoryCache* mCache = nullptr;
+};
+
+// Test that the programs of pipelines created again are loaded from the blob store of the platform
+// and that their bindings still work.
+TEST_P(OpenGLProgramCacheTests, PipelineCreatedAgain) {
+    CreatePipeline();
+    FlushWire();
+
+    // The driver doesn't support program binaries.
+    DAWN_SKIP_TEST_IF(mCache->GetStoreCount() == 0);
+    EXPECT_EQ(1u, mCache->GetStoreCount());
+    EXPECT_EQ(0u, mCache->GetHitCount());
+
+    // The first pipeline was released so the frontend doesn't find this one in its cache.
+    wgpu::ComputePipeline pipeline = CreatePipeline();
+    FlushWire();
+    EXPECT_EQ(1u, mCache->GetStoreCount());
+    EXPECT_EQ(1u, mCache->GetHitCount());
+
+    uint32_t value = 41;
+    wgpu::Buffer src =
+        utils::CreateBufferFromData(device, &value, sizeof(value), wgpu::BufferUsage::Uniform);
+
+    wgpu::BufferDescriptor dstDesc;
+    dstDesc.size = sizeof(uint32_t);
+    dstDesc.usage = wgpu::BufferUsage::Storage | wgpu::BufferUsage::CopySrc;
+    wgpu::Buffer dst = device.CreateBuffer(&dstDesc);
+
+    wgpu::BindGroup bindGroup = utils::MakeBindGroup(device, pipeline.GetBindGroupLayout(0),
+                                                     {
+                                                         {0, src, 0, sizeof(uint32_t)},
+                                                         {1, dst, 0, sizeof(uint32_t)},
+                                                     });
+
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::ComputePassEncoder pass = encoder.BeginComputePass();
+    pass.SetPipeline(pipeline);
+    pass.SetBindGroup(0, bindGroup);
+    pass.Dispatch(1);
+    pass.EndPass();
+    wgpu::CommandBuffer commands = encoder.Finish();
+    queue.Submit(1, &commands);
+
+    EXPECT_BUFFER_U32_EQ(42u, dst, 0);
+}
+
+// Test that pipelines that only differ by their fixed-function state share their program.
+TEST_P(OpenGLProgramCacheTests, PipelinesShareProgram) {
+    wgpu::ShaderModule vsModule =
+        utils::CreateShaderModule(device, utils::SingleShaderStage::Vertex, R"(
+            #version 450
+            void main() {
+                gl_Position = vec4(0.0, 0.0, 0.0, 1.0);
+            })");
+    wgpu::ShaderModule fsModule =
+        utils::CreateShaderModule(device, utils::SingleShaderStage::Fragment, R"(
+            #version 450
+            layout(location = 0) out vec4 fragColor;
+            void main() {
+                fragColor = vec4(0.0, 1.0, 0.0, 1.0);
+            })");
+
+    utils::ComboRenderPipelineDescriptor descriptor(device);
+    descriptor.layout = utils::MakeBasicPipelineLayout(device, nullptr);
+    descriptor.vertexStage.module = vsModule;
+    descriptor.cFragmentStage.module = fsModule;
+    wgpu::RenderPipeline pipeline = device.CreateRenderPipeline(&descriptor);
+
+    descriptor.primitiveTopology = wgpu::PrimitiveTopology::PointList;
+    descriptor.cColorStates[0].colorBlend.operation = wgpu::BlendOperation::Add;
+    descriptor.cColorStates[0].colorBlend.srcFactor = wgpu::BlendFactor::One;
+    descriptor.cColorStates[0].colorBlend.dstFactor = wgpu::BlendFactor::One;
+    wgpu::RenderPipeline otherPipeline = device.CreateRenderPipeline(&descriptor);
+    FlushWire();
+
+    dawn_native::opengl::ProgramCounts counts =
+        dawn_native::opengl::GetProgramCountsForTesting(backendDevice);
+    EXPECT_EQ(1u, counts.created);
+    EXPECT_EQ(1u, counts.reused);
+}
+
+DAWN_INSTANTIATE_TEST(OpenGLProgramCacheTests, OpenGLBackend());
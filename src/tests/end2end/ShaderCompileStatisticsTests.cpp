@@ -0,0 +1,81 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/DawnTest.h"
+
+#include "dawn_native/DawnNative.h"
+#include "utils/WGPUHelpers.h"
+
+class ShaderCompileStatisticsTests : public DawnTest {
+  protected:
+    wgpu::ShaderModule CreateModule() {
+        return utils::CreateShaderModule(device, utils::SingleShaderStage::Compute, R"(
+            #version 450
+            layout(std430, set = 0, binding = 0) buffer Data { uint value; } data;
+            void main() {
+                data.value = 42u;
+            })");
+    }
+
+    wgpu::ComputePipeline CreatePipeline(const wgpu::ShaderModule& module) {
+        wgpu::ComputePipelineDescriptor descriptor;
+        descriptor.computeStage.module = module;
+        descriptor.computeStage.entryPoint = "main";
+        return device.CreateComputePipeline(&descriptor);
+    }
+
+    dawn_native::ShaderCompileStatistics GetStatistics() {
+        FlushWire();
+        return dawn_native::GetShaderCompileStatistics(backendDevice);
+    }
+};
+
+// Test that creating a module and a pipeline is recorded in the phases and for the module.
+TEST_P(ShaderCompileStatisticsTests, ModuleAndPipeline) {
+    wgpu::ShaderModule module = CreateModule();
+    dawn_native::ShaderCompileStatistics statistics = GetStatistics();
+    EXPECT_EQ(1u, statistics.reflection.count);
+    EXPECT_EQ(0u, statistics.pipelineCreation.count);
+    EXPECT_LE(statistics.reflection.maxMilliseconds, statistics.reflection.totalMilliseconds);
+
+    wgpu::ComputePipeline pipeline = CreatePipeline(module);
+    statistics = GetStatistics();
+    EXPECT_EQ(1u, statistics.reflection.count);
+    EXPECT_EQ(1u, statistics.pipelineCreation.count);
+
+    ASSERT_EQ(1u, statistics.modules.size());
+    EXPECT_NE(0u, statistics.modules[0].codeSize);
+    EXPECT_GE(statistics.modules[0].totalMilliseconds,
+              statistics.pipelineCreation.totalMilliseconds);
+}
+
+// Test that modules and pipelines found in the caches of the device aren't recorded again.
+TEST_P(ShaderCompileStatisticsTests, CachedObjectsNotRecorded) {
+    wgpu::ShaderModule module = CreateModule();
+    wgpu::ComputePipeline pipeline = CreatePipeline(module);
+
+    wgpu::ShaderModule sameModule = CreateModule();
+    wgpu::ComputePipeline samePipeline = CreatePipeline(sameModule);
+
+    dawn_native::ShaderCompileStatistics statistics = GetStatistics();
+    EXPECT_EQ(1u, statistics.reflection.count);
+    EXPECT_EQ(1u, statistics.pipelineCreation.count);
+    EXPECT_EQ(1u, statistics.modules.size());
+}
+
+DAWN_INSTANTIATE_TEST(ShaderCompileStatisticsTests,
+                      D3D12Backend({"record_shader_compile_statistics"}),
+                      MetalBackend({"record_shader_compile_statistics"}),
+                      OpenGLBackend({"record_shader_compile_statistics"}),
+                      VulkanBackend({"record_shader_compile_statistics"}));
@@ -0,0 +1,144 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/perf_tests/DawnPerfTest.h"
+
+#include "tests/ParamGenerator.h"
+
+#include <array>
+#include <vector>
+
+namespace {
+
+    constexpr unsigned int kNumBindGroups = 500;
+    constexpr uint32_t kBindingCount = 4;
+    constexpr uint64_t kBufferSize = 256;
+
+    enum class Handles {
+        Owning,    // Build the descriptors with owning handles, referencing every object.
+        Borrowed,  // Build the descriptors with borrowed handles.
+    };
+
+    struct BorrowedHandlesParams : DawnTestParam {
+        BorrowedHandlesParams(const DawnTestParam& param, Handles handles)
+            : DawnTestParam(param), handles(handles) {
+        }
+
+        Handles handles;
+    };
+
+    std::ostream& operator<<(std::ostream& ostream, const BorrowedHandlesParams& param) {
+        ostream << static_cast<const DawnTestParam&>(param);
+
+        switch (param.handles) {
+            case Handles::Owning:
+                ostream << "_Owning";
+                break;
+            case Handles::Borrowed:
+                ostream << "_Borrowed";
+                break;
+        }
+        return ostream;
+    }
+
+}  // anonymous namespace
+
+// Test the cost of building bind group descriptors in a loop with owning handles, which reference
+// and release each object they hold, compared to borrowed handles. Each iteration is the creation
+// of one bind group.
+class BorrowedHandlesPerf : public DawnPerfTestWithParams<BorrowedHandlesParams> {
+  public:
+    BorrowedHandlesPerf() : DawnPerfTestWithParams(kNumBindGroups, 1) {
+    }
+    ~BorrowedHandlesPerf() override = default;
+
+    void TestSetUp() override;
+
+  private:
+    void Step() override;
+
+    wgpu::BindGroupLayout mLayout;
+    std::array<wgpu::Buffer, kBindingCount> mBuffers;
+};
+
+void BorrowedHandlesPerf::TestSetUp() {
+    DawnPerfTestWithParams::TestSetUp();
+
+    std::vector<wgpu::BindGroupLayoutBinding> layoutBindings;
+    for (uint32_t i = 0; i < kBindingCount; ++i) {
+        layoutBindings.push_back(
+            {i, wgpu::ShaderStage::Fragment, wgpu::BindingType::UniformBuffer});
+    }
+
+    wgpu::BindGroupLayoutDescriptor layoutDesc;
+    layoutDesc.bindingCount = kBindingCount;
+    layoutDesc.bindings = layoutBindings.data();
+    mLayout = device.CreateBindGroupLayout(&layoutDesc);
+
+    wgpu::BufferDescriptor bufferDesc;
+    bufferDesc.size = kBufferSize;
+    bufferDesc.usage = wgpu::BufferUsage::Uniform;
+    for (wgpu::Buffer& buffer : mBuffers) {
+        buffer = device.CreateBuffer(&bufferDesc);
+    }
+}
+
+void BorrowedHandlesPerf::Step() {
+    switch (GetParam().handles) {
+        case Handles::Owning: {
+            for (unsigned int i = 0; i < kNumBindGroups; ++i) {
+                std::array<wgpu::BindGroupBinding, kBindingCount> bindings;
+                for (uint32_t j = 0; j < kBindingCount; ++j) {
+                    bindings[j].binding = j;
+                    bindings[j].buffer = mBuffers[j];
+                    bindings[j].size = kBufferSize;
+                }
+
+                wgpu::BindGroupDescriptor descriptor;
+                descriptor.layout = mLayout;
+                descriptor.bindingCount = kBindingCount;
+                descriptor.bindings = bindings.data();
+                device.CreateBindGroup(&descriptor);
+            }
+            break;
+        }
+
+        case Handles::Borrowed: {
+            for (unsigned int i = 0; i < kNumBindGroups; ++i) {
+                std::array<wgpu::BorrowedBindGroupBinding, kBindingCount> bindings;
+                for (uint32_t j = 0; j < kBindingCount; ++j) {
+                    bindings[j].binding = j;
+                    bindings[j].buffer = mBuffers[j];
+                    bindings[j].size = kBufferSize;
+                }
+
+                wgpu::BorrowedBindGroupDescriptor descriptor;
+                descriptor.layout = mLayout;
+                descriptor.bindingCount = kBindingCount;
+                descriptor.bindings = bindings.data();
+                device.CreateBindGroup(&descriptor);
+            }
+            break;
+        }
+    }
+}
+
+TEST_P(BorrowedHandlesPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_PERF_TEST_SUITE_P(BorrowedHandlesPerf,
+                                   {D3D12Backend(), MetalBackend(), NullBackend(), OpenGLBackend(),
+                                    VulkanBackend()},
+                                   {Handles::Owning, Handles::Borrowed});
@@ -0,0 +1,207 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/perf_tests/DawnPerfTest.h"
+
+#include "tests/ParamGenerator.h"
+#include "utils/ComboRenderPipelineDescriptor.h"
+#include "utils/WGPUHelpers.h"
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+    constexpr unsigned int kObjectsPerStep = 10000;
+
+    constexpr char kVertexShader[] = R"(
+        #version 450
+        layout(location = 0) in vec4 pos;
+        void main() {
+            gl_Position = pos;
+        })";
+
+    constexpr char kFragmentShader[] = R"(
+        #version 450
+        layout(location = 0) out vec4 fragColor;
+        void main() {
+            fragColor = vec4(1.0);
+        })";
+
+    enum class ObjectType {
+        Samplers,
+        BindGroupLayouts,
+        PipelineLayouts,
+        RenderPipelines,
+        RenderPasses,
+    };
+
+    struct CachedObjectCreationParams : DawnTestParam {
+        CachedObjectCreationParams(const DawnTestParam& param, ObjectType objectType)
+            : DawnTestParam(param), objectType(objectType) {
+        }
+
+        ObjectType objectType;
+    };
+
+    std::ostream& operator<<(std::ostream& ostream, const CachedObjectCreationParams& param) {
+        ostream << static_cast<const DawnTestParam&>(param);
+
+        switch (param.objectType) {
+            case ObjectType::Samplers:
+                ostream << "_Samplers";
+                break;
+            case ObjectType::BindGroupLayouts:
+                ostream << "_BindGroupLayouts";
+                break;
+            case ObjectType::PipelineLayouts:
+                ostream << "_PipelineLayouts";
+                break;
+            case ObjectType::RenderPipelines:
+                ostream << "_RenderPipelines";
+                break;
+            case ObjectType::RenderPasses:
+                ostream << "_RenderPasses";
+                break;
+        }
+        return ostream;
+    }
+
+}  // anonymous namespace
+
+// Test the cost of creating objects that are found in the caches of the device, which is mostly
+// the cost of hashing the descriptor and comparing it with the cached object. An object created
+// in the set up keeps the cached object alive. Each iteration is the creation of one object.
+// Render passes look up their attachment state in the caches when they begin, so each iteration
+// of the RenderPasses variant begins and ends one pass.
+class CachedObjectCreationPerf : public DawnPerfTestWithParams<CachedObjectCreationParams> {
+  public:
+    CachedObjectCreationPerf() : DawnPerfTestWithParams(kObjectsPerStep, 1) {
+    }
+    ~CachedObjectCreationPerf() override = default;
+
+    void TestSetUp() override;
+
+  private:
+    void Step() override;
+
+    wgpu::SamplerDescriptor mSamplerDesc;
+    std::vector<wgpu::BindGroupLayoutBinding> mBindings;
+    wgpu::BindGroupLayout mBindGroupLayouts[2];
+    std::unique_ptr<utils::ComboRenderPipelineDescriptor> mPipelineDesc;
+
+    wgpu::Sampler mSampler;
+    wgpu::PipelineLayout mPipelineLayout;
+    wgpu::RenderPipeline mPipeline;
+    utils::BasicRenderPass mRenderPass;
+};
+
+void CachedObjectCreationPerf::TestSetUp() {
+    DawnPerfTestWithParams::TestSetUp();
+
+    mSamplerDesc = utils::GetDefaultSamplerDescriptor();
+    mSampler = device.CreateSampler(&mSamplerDesc);
+
+    // Layouts with a few bindings of different types, like the layout of a material.
+    mBindings = {
+        {0, wgpu::ShaderStage::Vertex, wgpu::BindingType::UniformBuffer},
+        {1, wgpu::ShaderStage::Fragment, wgpu::BindingType::UniformBuffer},
+        {2, wgpu::ShaderStage::Fragment, wgpu::BindingType::SampledTexture},
+        {3, wgpu::ShaderStage::Fragment, wgpu::BindingType::SampledTexture},
+        {4, wgpu::ShaderStage::Fragment, wgpu::BindingType::Sampler},
+    };
+    wgpu::BindGroupLayoutDescriptor bindGroupLayoutDesc;
+    bindGroupLayoutDesc.bindingCount = static_cast<uint32_t>(mBindings.size());
+    bindGroupLayoutDesc.bindings = mBindings.data();
+    mBindGroupLayouts[0] = device.CreateBindGroupLayout(&bindGroupLayoutDesc);
+    bindGroupLayoutDesc.bindingCount = 2;
+    mBindGroupLayouts[1] = device.CreateBindGroupLayout(&bindGroupLayoutDesc);
+
+    wgpu::PipelineLayoutDescriptor pipelineLayoutDesc;
+    pipelineLayoutDesc.bindGroupLayoutCount = 2;
+    pipelineLayoutDesc.bindGroupLayouts = mBindGroupLayouts;
+    mPipelineLayout = device.CreatePipelineLayout(&pipelineLayoutDesc);
+
+    mPipelineDesc = std::make_unique<utils::ComboRenderPipelineDescriptor>(device);
+    mPipelineDesc->layout = mPipelineLayout;
+    mPipelineDesc->vertexStage.module =
+        utils::CreateShaderModule(device, utils::SingleShaderStage::Vertex, kVertexShader);
+    mPipelineDesc->cFragmentStage.module =
+        utils::CreateShaderModule(device, utils::SingleShaderStage::Fragment, kFragmentShader);
+    mPipelineDesc->cVertexState.vertexBufferCount = 1;
+    mPipelineDesc->cVertexState.cVertexBuffers[0].arrayStride = 4 * sizeof(float);
+    mPipelineDesc->cVertexState.cVertexBuffers[0].attributeCount = 1;
+    mPipelineDesc->cVertexState.cAttributes[0].format = wgpu::VertexFormat::Float4;
+    mPipelineDesc->depthStencilState = &mPipelineDesc->cDepthStencilState;
+    mPipeline = device.CreateRenderPipeline(mPipelineDesc.get());
+
+    mRenderPass = utils::CreateBasicRenderPass(device, 1, 1);
+}
+
+void CachedObjectCreationPerf::Step() {
+    switch (GetParam().objectType) {
+        case ObjectType::Samplers:
+            for (unsigned int i = 0; i < kObjectsPerStep; ++i) {
+                device.CreateSampler(&mSamplerDesc);
+            }
+            break;
+
+        case ObjectType::BindGroupLayouts: {
+            wgpu::BindGroupLayoutDescriptor descriptor;
+            descriptor.bindingCount = static_cast<uint32_t>(mBindings.size());
+            descriptor.bindings = mBindings.data();
+            for (unsigned int i = 0; i < kObjectsPerStep; ++i) {
+                device.CreateBindGroupLayout(&descriptor);
+            }
+            break;
+        }
+
+        case ObjectType::PipelineLayouts: {
+            wgpu::PipelineLayoutDescriptor descriptor;
+            descriptor.bindGroupLayoutCount = 2;
+            descriptor.bindGroupLayouts = mBindGroupLayouts;
+            for (unsigned int i = 0; i < kObjectsPerStep; ++i) {
+                device.CreatePipelineLayout(&descriptor);
+            }
+            break;
+        }
+
+        case ObjectType::RenderPipelines:
+            for (unsigned int i = 0; i < kObjectsPerStep; ++i) {
+                device.CreateRenderPipeline(mPipelineDesc.get());
+            }
+            break;
+
+        case ObjectType::RenderPasses: {
+            wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+            for (unsigned int i = 0; i < kObjectsPerStep; ++i) {
+                wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&mRenderPass.renderPassInfo);
+                pass.EndPass();
+            }
+            encoder.Finish();
+            break;
+        }
+    }
+}
+
+TEST_P(CachedObjectCreationPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_PERF_TEST_SUITE_P(CachedObjectCreationPerf,
+                                   {D3D12Backend(), MetalBackend(), NullBackend(), OpenGLBackend(),
+                                    VulkanBackend()},
+                                   {ObjectType::Samplers, ObjectType::BindGroupLayouts,
+                                    ObjectType::PipelineLayouts, ObjectType::RenderPipelines,
+                                    ObjectType::RenderPasses});
@@ -0,0 +1,163 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/perf_tests/DawnPerfTest.h"
+
+#include "tests/ParamGenerator.h"
+#include "utils/ComboRenderPipelineDescriptor.h"
+#include "utils/WGPUHelpers.h"
+
+namespace {
+
+    constexpr unsigned int kNumDraws = 2000;
+    constexpr uint32_t kTextureSize = 64;
+
+    constexpr char kVertexShader[] = R"(
+                #version 450
+                void main() {
+                    const vec2 pos[3] = vec2[3](vec2(0.0f, 0.5f), vec2(-0.5f, -0.5f),
+                                                vec2(0.5f, -0.5f));
+                    gl_Position = vec4(pos[gl_VertexIndex], 0.0, 1.0);
+                })";
+
+    constexpr char kFragmentShader[] = R"(
+                #version 450
+                layout (std140, set = 0, binding = 0) uniform Uniforms {
+                    vec3 color;
+                };
+                layout(location = 0) out vec4 fragColor;
+                void main() {
+                    fragColor = vec4(color, 1.0);
+                })";
+
+    enum class Submission {
+        Reencode,  // Encode a new command buffer every step.
+        Reuse,     // Encode a reusable command buffer once and submit it every step.
+    };
+
+    struct CommandBufferReuseParams : DawnTestParam {
+        CommandBufferReuseParams(const DawnTestParam& param, Submission submission)
+            : DawnTestParam(param), submission(submission) {
+        }
+
+        Submission submission;
+    };
+
+    std::ostream& operator<<(std::ostream& ostream, const CommandBufferReuseParams& param) {
+        ostream << static_cast<const DawnTestParam&>(param);
+
+        switch (param.submission) {
+            case Submission::Reencode:
+                ostream << "_Reencode";
+                break;
+            case Submission::Reuse:
+                ostream << "_Reuse";
+                break;
+        }
+        return ostream;
+    }
+
+}  // anonymous namespace
+
+// Test the cost of submitting a static render pass every frame, either by encoding it again or by
+// submitting the same reusable command buffer. Each iteration is one draw of the pass.
+class CommandBufferReusePerf : public DawnPerfTestWithParams<CommandBufferReuseParams> {
+  public:
+    CommandBufferReusePerf() : DawnPerfTestWithParams(kNumDraws, 3) {
+    }
+    ~CommandBufferReusePerf() override = default;
+
+    void TestSetUp() override;
+
+  private:
+    void Step() override;
+
+    wgpu::CommandBuffer Encode(bool reusable);
+
+    wgpu::TextureView mColorAttachment;
+    wgpu::RenderPipeline mPipeline;
+    wgpu::BindGroup mBindGroup;
+    wgpu::CommandBuffer mReusableCommands;
+};
+
+void CommandBufferReusePerf::TestSetUp() {
+    DawnPerfTestWithParams::TestSetUp();
+
+    wgpu::TextureDescriptor textureDesc;
+    textureDesc.dimension = wgpu::TextureDimension::e2D;
+    textureDesc.size = {kTextureSize, kTextureSize, 1};
+    textureDesc.format = wgpu::TextureFormat::RGBA8Unorm;
+    textureDesc.usage = wgpu::TextureUsage::OutputAttachment;
+    mColorAttachment = device.CreateTexture(&textureDesc).CreateView();
+
+    wgpu::BindGroupLayout bgl = utils::MakeBindGroupLayout(
+        device, {{0, wgpu::ShaderStage::Fragment, wgpu::BindingType::UniformBuffer}});
+
+    utils::ComboRenderPipelineDescriptor pipelineDesc(device);
+    pipelineDesc.layout = utils::MakeBasicPipelineLayout(device, &bgl);
+    pipelineDesc.vertexStage.module =
+        utils::CreateShaderModule(device, utils::SingleShaderStage::Vertex, kVertexShader);
+    pipelineDesc.cFragmentStage.module =
+        utils::CreateShaderModule(device, utils::SingleShaderStage::Fragment, kFragmentShader);
+    pipelineDesc.cColorStates[0].format = wgpu::TextureFormat::RGBA8Unorm;
+    mPipeline = device.CreateRenderPipeline(&pipelineDesc);
+
+    constexpr float kUniformData[3] = {0.1f, 0.2f, 0.3f};
+    wgpu::Buffer uniformBuffer = utils::CreateBufferFromData(
+        device, kUniformData, sizeof(kUniformData), wgpu::BufferUsage::Uniform);
+    mBindGroup = utils::MakeBindGroup(device, bgl, {{0, uniformBuffer, 0, sizeof(kUniformData)}});
+
+    if (GetParam().submission == Submission::Reuse) {
+        mReusableCommands = Encode(true);
+    }
+}
+
+wgpu::CommandBuffer CommandBufferReusePerf::Encode(bool reusable) {
+    wgpu::CommandEncoder commands = device.CreateCommandEncoder();
+    utils::ComboRenderPassDescriptor renderPass({mColorAttachment});
+    wgpu::RenderPassEncoder pass = commands.BeginRenderPass(&renderPass);
+    pass.SetPipeline(mPipeline);
+    for (unsigned int i = 0; i < kNumDraws; ++i) {
+        pass.SetBindGroup(0, mBindGroup);
+        pass.Draw(3);
+    }
+    pass.EndPass();
+
+    wgpu::CommandBufferDescriptor descriptor;
+    descriptor.reusable = reusable;
+    return commands.Finish(&descriptor);
+}
+
+void CommandBufferReusePerf::Step() {
+    switch (GetParam().submission) {
+        case Submission::Reencode: {
+            wgpu::CommandBuffer commands = Encode(false);
+            queue.Submit(1, &commands);
+            break;
+        }
+
+        case Submission::Reuse:
+            queue.Submit(1, &mReusableCommands);
+            break;
+    }
+}
+
+TEST_P(CommandBufferReusePerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_PERF_TEST_SUITE_P(CommandBufferReusePerf,
+                                   {D3D12Backend(), MetalBackend(), NullBackend(), OpenGLBackend(),
+                                    VulkanBackend()},
+                                   {Submission::Reencode, Submission::Reuse});
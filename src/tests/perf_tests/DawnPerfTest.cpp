@@ -392,6 +392,12 @@ void DawnPerfTestBase::PrintResultImpl(const std::string& trace,
     std::string story = testInfo->name();
     std::replace(story.begin(), story.end(), '/', '_');
 
+    // Keep the results of builds calling dawn_native directly apart so that the cost of the proc
+    // table, for example in DrawCallPerf, can be compared between the two dispatch modes.
+#if defined(DAWN_ENABLE_DIRECT_DISPATCH)
+    story += "_DirectDispatch";
+#endif
+
     // The results are printed according to the format specified at
     // [chromium]//src/tools/perf/generate_legacy_perf_dashboard_json.py
     dawn::InfoLog() << (important ? "*" : "") << "RESULT " << metric << ": " << story << "= "
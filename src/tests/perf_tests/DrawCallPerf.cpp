@@ -221,6 +221,8 @@ namespace {
 //     precomputed in a render bundle.
 //   - Static/Dynamic data: Updating data for each draw is a common use case. It also tests
 //     the efficiency of resource transitions.
+// The Null backend is included to measure the cost of the frontend's validation and state tracking
+// without any backend recording.
 class DrawCallPerf : public DawnPerfTestWithParams<DrawCallParamForTest> {
   public:
     DrawCallPerf() : DawnPerfTestWithParams(kNumDraws, 3) {
@@ -611,7 +613,7 @@ TEST_P(DrawCallPerf, Run) {
 
 DAWN_INSTANTIATE_PERF_TEST_SUITE_P(
     DrawCallPerf,
-    {D3D12Backend(), MetalBackend(), OpenGLBackend(), VulkanBackend(),
+    {D3D12Backend(), MetalBackend(), NullBackend(), OpenGLBackend(), VulkanBackend(),
      VulkanBackend({"skip_validation"})},
     {
         // Baseline
@@ -629,6 +631,11 @@ DAWN_INSTANTIATE_PERF_TEST_SUITE_P(
         // Redundantly set pipeline / bind groups
         MakeParam(Pipeline::Redundant, BindGroup::Redundant),
 
+        // Switch bind groups every draw while redundantly setting the pipeline. This measures the
+        // cost of validating bind group compatibility on each draw in isolation of pipeline layout
+        // changes.
+        MakeParam(Pipeline::Redundant, BindGroup::Multiple),
+
         // Switch the pipeline every draw to test state tracking and updates to binding points
         MakeParam(Pipeline::Dynamic,
                   BindGroup::Multiple),  // Multiple bind groups w/ dynamic pipeline
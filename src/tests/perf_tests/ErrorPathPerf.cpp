@@ -0,0 +1,116 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/perf_tests/DawnPerfTest.h"
+
+#include "common/Constants.h"
+#include "tests/ParamGenerator.h"
+#include "utils/WGPUHelpers.h"
+
+namespace {
+
+    constexpr unsigned int kNumErrors = 1000;
+
+    enum class FailingCall {
+        CreateBuffer,  // Create buffers with an invalid usage.
+        SetBindGroup,  // Set bind groups at an index over the maximum in a compute pass.
+    };
+
+    struct ErrorPathParams : DawnTestParam {
+        ErrorPathParams(const DawnTestParam& param, FailingCall failingCall)
+            : DawnTestParam(param), failingCall(failingCall) {
+        }
+
+        FailingCall failingCall;
+    };
+
+    std::ostream& operator<<(std::ostream& ostream, const ErrorPathParams& param) {
+        ostream << static_cast<const DawnTestParam&>(param);
+
+        switch (param.failingCall) {
+            case FailingCall::CreateBuffer:
+                ostream << "_CreateBuffer";
+                break;
+            case FailingCall::SetBindGroup:
+                ostream << "_SetBindGroup";
+                break;
+        }
+        return ostream;
+    }
+
+}  // anonymous namespace
+
+// Test the cost of producing and dropping validation errors like applications that probe for
+// support by making invalid calls inside an error scope. Each iteration is one failing call.
+class ErrorPathPerf : public DawnPerfTestWithParams<ErrorPathParams> {
+  public:
+    ErrorPathPerf() : DawnPerfTestWithParams(kNumErrors, 1) {
+    }
+    ~ErrorPathPerf() override = default;
+
+    void TestSetUp() override;
+
+  private:
+    void Step() override;
+
+    wgpu::BindGroup mBindGroup;
+};
+
+void ErrorPathPerf::TestSetUp() {
+    DawnPerfTestWithParams::TestSetUp();
+
+    wgpu::BindGroupLayout bgl = utils::MakeBindGroupLayout(device, {});
+    mBindGroup = utils::MakeBindGroup(device, bgl, {});
+}
+
+void ErrorPathPerf::Step() {
+    device.PushErrorScope(wgpu::ErrorFilter::Validation);
+
+    switch (GetParam().failingCall) {
+        case FailingCall::CreateBuffer: {
+            wgpu::BufferDescriptor descriptor;
+            descriptor.size = 4;
+            descriptor.usage = wgpu::BufferUsage::MapRead | wgpu::BufferUsage::Uniform;
+            for (unsigned int i = 0; i < kNumErrors; ++i) {
+                device.CreateBuffer(&descriptor);
+            }
+            break;
+        }
+
+        case FailingCall::SetBindGroup: {
+            wgpu::CommandEncoder commands = device.CreateCommandEncoder();
+            wgpu::ComputePassEncoder pass = commands.BeginComputePass();
+            for (unsigned int i = 0; i < kNumErrors; ++i) {
+                pass.SetBindGroup(kMaxBindGroups, mBindGroup);
+            }
+            pass.EndPass();
+            commands.Finish();
+            break;
+        }
+    }
+
+    bool popped = device.PopErrorScope(
+        [](WGPUErrorType type, const char*, void*) { ASSERT_EQ(WGPUErrorType_Validation, type); },
+        nullptr);
+    ASSERT_TRUE(popped);
+}
+
+TEST_P(ErrorPathPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_PERF_TEST_SUITE_P(ErrorPathPerf,
+                                   {D3D12Backend(), MetalBackend(), NullBackend(), OpenGLBackend(),
+                                    VulkanBackend()},
+                                   {FailingCall::CreateBuffer, FailingCall::SetBindGroup});
@@ -0,0 +1,181 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/perf_tests/DawnPerfTest.h"
+
+#include "tests/ParamGenerator.h"
+#include "utils/ComboRenderPipelineDescriptor.h"
+#include "utils/WGPUHelpers.h"
+
+#include <vector>
+
+namespace {
+
+    constexpr uint32_t kTextureSize = 64;
+    constexpr size_t kUniformSize = 3 * sizeof(float);
+
+    constexpr char kVertexShader[] = R"(
+                #version 450
+                void main() {
+                    const vec2 pos[3] = vec2[3](vec2(0.0f, 0.5f), vec2(-0.5f, -0.5f),
+                                                vec2(0.5f, -0.5f));
+                    gl_Position = vec4(pos[gl_VertexIndex], 0.0, 1.0);
+                })";
+
+    constexpr char kFragmentShader[] = R"(
+                #version 450
+                layout (std140, set = 0, binding = 0) uniform Uniforms {
+                    vec3 color;
+                };
+                layout(location = 0) out vec4 fragColor;
+                void main() {
+                    fragColor = vec4(color, 1.0);
+                })";
+
+    enum class Pattern {
+        SameBundles,        // Execute the same bundles in a single call every step.
+        ChangingBundles,    // Alternate between two different sets of bundles in a single call.
+        OneBundlePerCall,   // Execute the same bundles with one call per bundle.
+    };
+
+    struct ExecuteBundlesParams : DawnTestParam {
+        ExecuteBundlesParams(const DawnTestParam& param, uint32_t bundleCount, Pattern pattern)
+            : DawnTestParam(param), bundleCount(bundleCount), pattern(pattern) {
+        }
+
+        uint32_t bundleCount;
+        Pattern pattern;
+    };
+
+    std::ostream& operator<<(std::ostream& ostream, const ExecuteBundlesParams& param) {
+        ostream << static_cast<const DawnTestParam&>(param);
+        ostream << "_" << param.bundleCount << "Bundles";
+
+        switch (param.pattern) {
+            case Pattern::SameBundles:
+                ostream << "_SameBundles";
+                break;
+            case Pattern::ChangingBundles:
+                ostream << "_ChangingBundles";
+                break;
+            case Pattern::OneBundlePerCall:
+                ostream << "_OneBundlePerCall";
+                break;
+        }
+        return ostream;
+    }
+
+}  // anonymous namespace
+
+// Test the cost of executing many render bundles in a render pass, in particular of merging their
+// resource usages into the usage of the pass. Each bundle draws with its own uniform buffer so that
+// the bundles don't share resources. Each iteration is the execution of a single bundle.
+class ExecuteBundlesPerf : public DawnPerfTestWithParams<ExecuteBundlesParams> {
+  public:
+    ExecuteBundlesPerf() : DawnPerfTestWithParams(GetParam().bundleCount, 3) {
+    }
+    ~ExecuteBundlesPerf() override = default;
+
+    void TestSetUp() override;
+
+  private:
+    void Step() override;
+
+    wgpu::TextureView mColorAttachment;
+    std::vector<wgpu::RenderBundle> mBundles;
+    uint32_t mStepCount = 0;
+};
+
+void ExecuteBundlesPerf::TestSetUp() {
+    DawnPerfTestWithParams::TestSetUp();
+
+    wgpu::TextureDescriptor textureDesc;
+    textureDesc.dimension = wgpu::TextureDimension::e2D;
+    textureDesc.size = {kTextureSize, kTextureSize, 1};
+    textureDesc.format = wgpu::TextureFormat::RGBA8Unorm;
+    textureDesc.usage = wgpu::TextureUsage::OutputAttachment;
+    mColorAttachment = device.CreateTexture(&textureDesc).CreateView();
+
+    wgpu::BindGroupLayout bgl = utils::MakeBindGroupLayout(
+        device, {{0, wgpu::ShaderStage::Fragment, wgpu::BindingType::UniformBuffer}});
+
+    utils::ComboRenderPipelineDescriptor pipelineDesc(device);
+    pipelineDesc.layout = utils::MakeBasicPipelineLayout(device, &bgl);
+    pipelineDesc.vertexStage.module =
+        utils::CreateShaderModule(device, utils::SingleShaderStage::Vertex, kVertexShader);
+    pipelineDesc.cFragmentStage.module =
+        utils::CreateShaderModule(device, utils::SingleShaderStage::Fragment, kFragmentShader);
+    pipelineDesc.cColorStates[0].format = wgpu::TextureFormat::RGBA8Unorm;
+    wgpu::RenderPipeline pipeline = device.CreateRenderPipeline(&pipelineDesc);
+
+    wgpu::RenderBundleEncoderDescriptor bundleDesc = {};
+    bundleDesc.colorFormatsCount = 1;
+    bundleDesc.colorFormats = &pipelineDesc.cColorStates[0].format;
+
+    constexpr float kUniformData[3] = {0.1f, 0.2f, 0.3f};
+    mBundles.resize(GetParam().bundleCount);
+    for (wgpu::RenderBundle& bundle : mBundles) {
+        wgpu::Buffer uniformBuffer = utils::CreateBufferFromData(
+            device, kUniformData, sizeof(kUniformData), wgpu::BufferUsage::Uniform);
+        wgpu::BindGroup bindGroup =
+            utils::MakeBindGroup(device, bgl, {{0, uniformBuffer, 0, kUniformSize}});
+
+        wgpu::RenderBundleEncoder encoder = device.CreateRenderBundleEncoder(&bundleDesc);
+        encoder.SetPipeline(pipeline);
+        encoder.SetBindGroup(0, bindGroup);
+        encoder.Draw(3);
+        bundle = encoder.Finish();
+    }
+}
+
+void ExecuteBundlesPerf::Step() {
+    wgpu::CommandEncoder commands = device.CreateCommandEncoder();
+    utils::ComboRenderPassDescriptor renderPass({mColorAttachment});
+    wgpu::RenderPassEncoder pass = commands.BeginRenderPass(&renderPass);
+
+    uint32_t bundleCount = static_cast<uint32_t>(mBundles.size());
+    switch (GetParam().pattern) {
+        case Pattern::SameBundles:
+            pass.ExecuteBundles(bundleCount, mBundles.data());
+            break;
+
+        case Pattern::ChangingBundles:
+            // Drop the last bundle every other step so the set of bundles is never the same as
+            // in the previous step.
+            pass.ExecuteBundles(bundleCount - (mStepCount % 2), mBundles.data());
+            break;
+
+        case Pattern::OneBundlePerCall:
+            for (const wgpu::RenderBundle& bundle : mBundles) {
+                pass.ExecuteBundles(1, &bundle);
+            }
+            break;
+    }
+
+    pass.EndPass();
+    wgpu::CommandBuffer commandBuffer = commands.Finish();
+    queue.Submit(1, &commandBuffer);
+    mStepCount++;
+}
+
+TEST_P(ExecuteBundlesPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_PERF_TEST_SUITE_P(ExecuteBundlesPerf,
+                                   {D3D12Backend(), MetalBackend(), NullBackend(), OpenGLBackend(),
+                                    VulkanBackend()},
+                                   {10u, 200u},
+                                   {Pattern::SameBundles, Pattern::ChangingBundles,
+                                    Pattern::OneBundlePerCall});
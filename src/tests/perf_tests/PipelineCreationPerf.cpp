@@ -0,0 +1,166 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/perf_tests/DawnPerfTest.h"
+
+#include "tests/ParamGenerator.h"
+#include "utils/WGPUHelpers.h"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+    constexpr unsigned int kPipelinesPerStep = 1000;
+
+    // The number of different modules the pipelines are created with, all compatible with the
+    // same layout like the permutations of a shader.
+    constexpr unsigned int kModuleCount = 10;
+
+    enum class Layout {
+        Explicit,  // Create the pipelines with a pipeline layout.
+        Implicit,  // Create the pipelines without a layout so that the default one is used.
+    };
+
+    struct PipelineCreationParams : DawnTestParam {
+        PipelineCreationParams(const DawnTestParam& param, uint32_t bindingsPerGroup, Layout layout)
+            : DawnTestParam(param), bindingsPerGroup(bindingsPerGroup), layout(layout) {
+        }
+
+        // The number of uniform buffers in each of the two bind groups used by the modules.
+        uint32_t bindingsPerGroup;
+        Layout layout;
+    };
+
+    std::ostream& operator<<(std::ostream& ostream, const PipelineCreationParams& param) {
+        ostream << static_cast<const DawnTestParam&>(param);
+        ostream << "_" << param.bindingsPerGroup << "BindingsPerGroup";
+
+        switch (param.layout) {
+            case Layout::Explicit:
+                ostream << "_ExplicitLayout";
+                break;
+            case Layout::Implicit:
+                ostream << "_ImplicitLayout";
+                break;
+        }
+        return ostream;
+    }
+
+}  // anonymous namespace
+
+// Test the cost of creating compute pipelines from a few modules and layouts, like when creating
+// all the permutations of a material. After the first pipeline of each module the pipelines are
+// found in the cache so the cost is mostly the validation of the stage against the layout, or the
+// deduction of the default layout when the pipelines are created without one. Each iteration is
+// the creation of one pipeline.
+class PipelineCreationPerf : public DawnPerfTestWithParams<PipelineCreationParams> {
+  public:
+    PipelineCreationPerf() : DawnPerfTestWithParams(kPipelinesPerStep, 1) {
+    }
+    ~PipelineCreationPerf() override = default;
+
+    void TestSetUp() override;
+
+  private:
+    void Step() override;
+
+    wgpu::PipelineLayout mPipelineLayout;
+    std::vector<wgpu::ShaderModule> mModules;
+    std::vector<wgpu::ComputePipeline> mPipelines;
+};
+
+void PipelineCreationPerf::TestSetUp() {
+    DawnPerfTestWithParams::TestSetUp();
+
+    const uint32_t bindingsPerGroup = GetParam().bindingsPerGroup;
+
+    // Both groups have |bindingsPerGroup| uniform buffers and the second one also has the
+    // storage buffer the shader writes to.
+    std::vector<wgpu::BindGroupLayoutBinding> bindings;
+    std::string declarations;
+    std::string sum = "vec4(0.0)";
+    for (uint32_t binding = 0; binding < bindingsPerGroup; ++binding) {
+        bindings.push_back({binding, wgpu::ShaderStage::Compute, wgpu::BindingType::UniformBuffer});
+
+        for (uint32_t group = 0; group < 2; ++group) {
+            std::string name = "u" + std::to_string(group) + "_" + std::to_string(binding);
+            declarations += "layout(std140, set = " + std::to_string(group) +
+                            ", binding = " + std::to_string(binding) + ") uniform Block" + name +
+                            " { vec4 value; } " + name + ";\n";
+            sum += " + " + name + ".value";
+        }
+    }
+
+    wgpu::BindGroupLayout bindGroupLayouts[2];
+    wgpu::BindGroupLayoutDescriptor bindGroupLayoutDesc;
+    bindGroupLayoutDesc.bindingCount = static_cast<uint32_t>(bindings.size());
+    bindGroupLayoutDesc.bindings = bindings.data();
+    bindGroupLayouts[0] = device.CreateBindGroupLayout(&bindGroupLayoutDesc);
+
+    bindings.push_back(
+        {bindingsPerGroup, wgpu::ShaderStage::Compute, wgpu::BindingType::StorageBuffer});
+    bindGroupLayoutDesc.bindingCount = static_cast<uint32_t>(bindings.size());
+    bindGroupLayoutDesc.bindings = bindings.data();
+    bindGroupLayouts[1] = device.CreateBindGroupLayout(&bindGroupLayoutDesc);
+
+    wgpu::PipelineLayoutDescriptor pipelineLayoutDesc;
+    pipelineLayoutDesc.bindGroupLayoutCount = 2;
+    pipelineLayoutDesc.bindGroupLayouts = bindGroupLayouts;
+    mPipelineLayout = device.CreatePipelineLayout(&pipelineLayoutDesc);
+
+    // Each module has a different constant so that they are all different.
+    for (unsigned int i = 0; i < kModuleCount; ++i) {
+        std::string source = "#version 450\n" + declarations + R"(
+            layout(std430, set = 1, binding = )" +
+                             std::to_string(bindingsPerGroup) + R"() buffer Data {
+                vec4 values[];
+            } data;
+            void main() {
+                data.values[gl_GlobalInvocationID.x] = )" +
+                             sum + " + vec4(" + std::to_string(i) + R"(.0);
+            })";
+        mModules.push_back(
+            utils::CreateShaderModule(device, utils::SingleShaderStage::Compute, source.c_str()));
+    }
+
+    mPipelines.reserve(kPipelinesPerStep);
+}
+
+void PipelineCreationPerf::Step() {
+    wgpu::ComputePipelineDescriptor descriptor;
+    if (GetParam().layout == Layout::Explicit) {
+        descriptor.layout = mPipelineLayout;
+    }
+    descriptor.computeStage.entryPoint = "main";
+
+    for (unsigned int i = 0; i < kPipelinesPerStep; ++i) {
+        descriptor.computeStage.module = mModules[i % kModuleCount];
+        mPipelines.push_back(device.CreateComputePipeline(&descriptor));
+    }
+
+    // The pipelines are released at the end of the step so that the first pipeline of each
+    // module is created again at the next one.
+    mPipelines.clear();
+}
+
+TEST_P(PipelineCreationPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_PERF_TEST_SUITE_P(PipelineCreationPerf,
+                                   {D3D12Backend(), MetalBackend(), NullBackend(), OpenGLBackend(),
+                                    VulkanBackend()},
+                                   {1u, 4u},
+                                   {Layout::Explicit, Layout::Implicit});
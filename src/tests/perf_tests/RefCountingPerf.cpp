@@ -0,0 +1,151 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/perf_tests/DawnPerfTest.h"
+
+#include "tests/ParamGenerator.h"
+#include "utils/ComboRenderPipelineDescriptor.h"
+#include "utils/WGPUHelpers.h"
+
+#include <array>
+
+namespace {
+
+    constexpr unsigned int kNumDraws = 2000;
+    constexpr uint32_t kTextureSize = 64;
+
+    constexpr char kVertexShader[] = R"(
+                #version 450
+                void main() {
+                    const vec2 pos[3] = vec2[3](vec2(0.0f, 0.5f), vec2(-0.5f, -0.5f),
+                                                vec2(0.5f, -0.5f));
+                    gl_Position = vec4(pos[gl_VertexIndex], 0.0, 1.0);
+                })";
+
+    constexpr char kFragmentShader[] = R"(
+                #version 450
+                layout (std140, set = 0, binding = 0) uniform Uniforms {
+                    vec3 color;
+                };
+                layout(location = 0) out vec4 fragColor;
+                void main() {
+                    fragColor = vec4(color, 1.0);
+                })";
+
+    enum class RefCounting {
+        Atomic,     // Use the default atomic refcounts.
+        NonAtomic,  // Use the plain integer refcounts of single-threaded devices.
+    };
+
+    struct RefCountingParams : DawnTestParam {
+        RefCountingParams(const DawnTestParam& param, RefCounting refCounting)
+            : DawnTestParam(param), refCounting(refCounting) {
+            if (refCounting == RefCounting::NonAtomic) {
+                forceEnabledWorkarounds.push_back("use_non_atomic_refcounts");
+            }
+        }
+
+        RefCounting refCounting;
+    };
+
+    std::ostream& operator<<(std::ostream& ostream, const RefCountingParams& param) {
+        ostream << static_cast<const DawnTestParam&>(param);
+
+        switch (param.refCounting) {
+            case RefCounting::Atomic:
+                ostream << "_Atomic";
+                break;
+            case RefCounting::NonAtomic:
+                ostream << "_NonAtomic";
+                break;
+        }
+        return ostream;
+    }
+
+}  // anonymous namespace
+
+// Test the cost of encoding a render pass that switches bind groups before every draw. Each
+// command that records an object references it, so this is dominated by refcounting. Each
+// iteration is one draw.
+class RefCountingPerf : public DawnPerfTestWithParams<RefCountingParams> {
+  public:
+    RefCountingPerf() : DawnPerfTestWithParams(kNumDraws, 3) {
+    }
+    ~RefCountingPerf() override = default;
+
+    void TestSetUp() override;
+
+  private:
+    void Step() override;
+
+    wgpu::TextureView mColorAttachment;
+    wgpu::RenderPipeline mPipeline;
+    std::array<wgpu::BindGroup, 2> mBindGroups;
+};
+
+void RefCountingPerf::TestSetUp() {
+    DawnPerfTestWithParams::TestSetUp();
+
+    wgpu::TextureDescriptor textureDesc;
+    textureDesc.dimension = wgpu::TextureDimension::e2D;
+    textureDesc.size = {kTextureSize, kTextureSize, 1};
+    textureDesc.format = wgpu::TextureFormat::RGBA8Unorm;
+    textureDesc.usage = wgpu::TextureUsage::OutputAttachment;
+    mColorAttachment = device.CreateTexture(&textureDesc).CreateView();
+
+    wgpu::BindGroupLayout bgl = utils::MakeBindGroupLayout(
+        device, {{0, wgpu::ShaderStage::Fragment, wgpu::BindingType::UniformBuffer}});
+
+    utils::ComboRenderPipelineDescriptor pipelineDesc(device);
+    pipelineDesc.layout = utils::MakeBasicPipelineLayout(device, &bgl);
+    pipelineDesc.vertexStage.module =
+        utils::CreateShaderModule(device, utils::SingleShaderStage::Vertex, kVertexShader);
+    pipelineDesc.cFragmentStage.module =
+        utils::CreateShaderModule(device, utils::SingleShaderStage::Fragment, kFragmentShader);
+    pipelineDesc.cColorStates[0].format = wgpu::TextureFormat::RGBA8Unorm;
+    mPipeline = device.CreateRenderPipeline(&pipelineDesc);
+
+    constexpr float kUniformData[3] = {0.1f, 0.2f, 0.3f};
+    for (wgpu::BindGroup& bindGroup : mBindGroups) {
+        wgpu::Buffer uniformBuffer = utils::CreateBufferFromData(
+            device, kUniformData, sizeof(kUniformData), wgpu::BufferUsage::Uniform);
+        bindGroup =
+            utils::MakeBindGroup(device, bgl, {{0, uniformBuffer, 0, sizeof(kUniformData)}});
+    }
+}
+
+void RefCountingPerf::Step() {
+    wgpu::CommandEncoder commands = device.CreateCommandEncoder();
+    utils::ComboRenderPassDescriptor renderPass({mColorAttachment});
+    wgpu::RenderPassEncoder pass = commands.BeginRenderPass(&renderPass);
+    pass.SetPipeline(mPipeline);
+    for (unsigned int i = 0; i < kNumDraws; ++i) {
+        // Alternate between the bind groups so that the commands aren't elided as redundant.
+        pass.SetBindGroup(0, mBindGroups[i % 2]);
+        pass.Draw(3);
+    }
+    pass.EndPass();
+
+    wgpu::CommandBuffer commandBuffer = commands.Finish();
+    queue.Submit(1, &commandBuffer);
+}
+
+TEST_P(RefCountingPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_PERF_TEST_SUITE_P(RefCountingPerf,
+                                   {D3D12Backend(), MetalBackend(), NullBackend(), OpenGLBackend(),
+                                    VulkanBackend()},
+                                   {RefCounting::Atomic, RefCounting::NonAtomic});
@@ -0,0 +1,140 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/perf_tests/DawnPerfTest.h"
+
+#include "tests/ParamGenerator.h"
+#include "utils/WGPUHelpers.h"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+    constexpr unsigned int kModuleCount = 500;
+
+    enum class CreationMode {
+        OneByOne,  // Each module is created with Device::CreateShaderModule.
+        Batch,     // All the modules are created with one call to dawn_native::CreateShaderModules.
+    };
+
+    struct ShaderModuleBatchCreationParams : DawnTestParam {
+        ShaderModuleBatchCreationParams(const DawnTestParam& param, CreationMode creationMode)
+            : DawnTestParam(param), creationMode(creationMode) {
+        }
+
+        CreationMode creationMode;
+    };
+
+    std::ostream& operator<<(std::ostream& ostream, const ShaderModuleBatchCreationParams& param) {
+        ostream << static_cast<const DawnTestParam&>(param);
+
+        switch (param.creationMode) {
+            case CreationMode::OneByOne:
+                ostream << "_OneByOne";
+                break;
+            case CreationMode::Batch:
+                ostream << "_Batch";
+                break;
+        }
+        return ostream;
+    }
+
+}  // anonymous namespace
+
+// Test the cost of creating many different shader modules at once, like when loading a level.
+// Each iteration is the creation of one module.
+class ShaderModuleBatchCreationPerf
+    : public DawnPerfTestWithParams<ShaderModuleBatchCreationParams> {
+  public:
+    ShaderModuleBatchCreationPerf() : DawnPerfTestWithParams(kModuleCount, 1) {
+    }
+    ~ShaderModuleBatchCreationPerf() override = default;
+
+    void TestSetUp() override;
+
+  private:
+    void Step() override;
+
+    std::vector<std::vector<uint32_t>> mSpirv;
+    std::vector<wgpu::ShaderModuleDescriptor> mDescriptors;
+};
+
+void ShaderModuleBatchCreationPerf::TestSetUp() {
+    DawnPerfTestWithParams::TestSetUp();
+
+    // Each module has a different constant so that they are all different.
+    mSpirv.reserve(kModuleCount);
+    for (unsigned int i = 0; i < kModuleCount; ++i) {
+        std::string source = R"(
+            #version 450
+            layout(std140, set = 0, binding = 0) uniform Uniforms {
+                vec4 scale;
+            } uniforms;
+            layout(std430, set = 0, binding = 1) buffer Data {
+                vec4 values[];
+            } data;
+            void main() {
+                uint index = gl_GlobalInvocationID.x;
+                data.values[index] = data.values[index] * uniforms.scale + vec4()" +
+                             std::to_string(i) + R"(.0);
+            })";
+        mSpirv.push_back(
+            utils::CompileGLSLToSpirv(utils::SingleShaderStage::Compute, source.c_str()));
+        ASSERT_FALSE(mSpirv.back().empty());
+
+        wgpu::ShaderModuleDescriptor descriptor;
+        descriptor.code = mSpirv.back().data();
+        descriptor.codeSize = static_cast<uint32_t>(mSpirv.back().size());
+        mDescriptors.push_back(descriptor);
+    }
+}
+
+void ShaderModuleBatchCreationPerf::Step() {
+    // The modules are released at the end of the step so that they are created again at the
+    // next one.
+    switch (GetParam().creationMode) {
+        case CreationMode::OneByOne: {
+            std::vector<wgpu::ShaderModule> modules;
+            modules.reserve(kModuleCount);
+            for (const wgpu::ShaderModuleDescriptor& descriptor : mDescriptors) {
+                modules.push_back(device.CreateShaderModule(&descriptor));
+            }
+            break;
+        }
+
+        case CreationMode::Batch: {
+            std::vector<WGPUShaderModule> modules = dawn_native::CreateShaderModules(
+                device.Get(), kModuleCount,
+                reinterpret_cast<const WGPUShaderModuleDescriptor*>(mDescriptors.data()));
+            for (WGPUShaderModule module : modules) {
+                wgpu::ShaderModule::Acquire(module);
+            }
+            break;
+        }
+    }
+}
+
+TEST_P(ShaderModuleBatchCreationPerf, Run) {
+    // The batch creation is only available to in-process users of dawn_native.
+    DAWN_SKIP_TEST_IF(UsesWire() && GetParam().creationMode == CreationMode::Batch);
+    RunTest();
+}
+
+// Without validation, most of the creation is the reflection of the modules so that the cost of
+// the SPIR-V reflector can be compared with the one of spirv_cross.
+DAWN_INSTANTIATE_PERF_TEST_SUITE_P(ShaderModuleBatchCreationPerf,
+                                   {NullBackend(), NullBackend({"skip_validation"}),
+                                    NullBackend({"skip_validation", "use_spirv_cross_reflection"})},
+                                   {CreationMode::OneByOne, CreationMode::Batch});
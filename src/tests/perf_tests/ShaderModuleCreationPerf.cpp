@@ -0,0 +1,119 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/perf_tests/DawnPerfTest.h"
+
+#include "tests/ParamGenerator.h"
+#include "utils/WGPUHelpers.h"
+
+#include <vector>
+
+namespace {
+
+    constexpr unsigned int kModulesPerStep = 100;
+
+    constexpr char kComputeShader[] = R"(
+        #version 450
+        layout(std140, set = 0, binding = 0) uniform Uniforms {
+            vec4 scale;
+        } uniforms;
+        layout(std430, set = 0, binding = 1) buffer Data {
+            vec4 values[];
+        } data;
+        void main() {
+            uint index = gl_GlobalInvocationID.x;
+            data.values[index] = data.values[index] * uniforms.scale + vec4(float(index));
+        })";
+
+    enum class ModuleLifetime {
+        Alive,     // Another reference keeps the module alive so it is found in the cache.
+        Released,  // The module is released after each creation.
+    };
+
+    struct ShaderModuleCreationParams : DawnTestParam {
+        ShaderModuleCreationParams(const DawnTestParam& param, ModuleLifetime lifetime)
+            : DawnTestParam(param), lifetime(lifetime) {
+        }
+
+        ModuleLifetime lifetime;
+    };
+
+    std::ostream& operator<<(std::ostream& ostream, const ShaderModuleCreationParams& param) {
+        ostream << static_cast<const DawnTestParam&>(param);
+
+        switch (param.lifetime) {
+            case ModuleLifetime::Alive:
+                ostream << "_Alive";
+                break;
+            case ModuleLifetime::Released:
+                ostream << "_Released";
+                break;
+        }
+        return ostream;
+    }
+
+}  // anonymous namespace
+
+// Test the cost of creating shader modules with code the device has already seen, like material
+// systems that re-create the same modules all the time. Each iteration is one module creation.
+class ShaderModuleCreationPerf : public DawnPerfTestWithParams<ShaderModuleCreationParams> {
+  public:
+    ShaderModuleCreationPerf() : DawnPerfTestWithParams(kModulesPerStep, 1) {
+    }
+    ~ShaderModuleCreationPerf() override = default;
+
+    void TestSetUp() override;
+
+  private:
+    void Step() override;
+
+    std::vector<uint32_t> mSpirv;
+    wgpu::ShaderModule mAliveModule;
+};
+
+void ShaderModuleCreationPerf::TestSetUp() {
+    DawnPerfTestWithParams::TestSetUp();
+
+    mSpirv = utils::CompileGLSLToSpirv(utils::SingleShaderStage::Compute, kComputeShader);
+    ASSERT_FALSE(mSpirv.empty());
+
+    wgpu::ShaderModuleDescriptor descriptor;
+    descriptor.code = mSpirv.data();
+    descriptor.codeSize = static_cast<uint32_t>(mSpirv.size());
+    if (GetParam().lifetime == ModuleLifetime::Alive) {
+        mAliveModule = device.CreateShaderModule(&descriptor);
+    } else {
+        // Create the module once so that it is known to the device.
+        device.CreateShaderModule(&descriptor);
+    }
+}
+
+void ShaderModuleCreationPerf::Step() {
+    wgpu::ShaderModuleDescriptor descriptor;
+    descriptor.code = mSpirv.data();
+    descriptor.codeSize = static_cast<uint32_t>(mSpirv.size());
+
+    for (unsigned int i = 0; i < kModulesPerStep; ++i) {
+        device.CreateShaderModule(&descriptor);
+    }
+}
+
+TEST_P(ShaderModuleCreationPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_PERF_TEST_SUITE_P(ShaderModuleCreationPerf,
+                                   {D3D12Backend(), MetalBackend(), NullBackend(), OpenGLBackend(),
+                                    VulkanBackend()},
+                                   {ModuleLifetime::Alive, ModuleLifetime::Released});
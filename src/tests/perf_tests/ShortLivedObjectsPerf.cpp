@@ -0,0 +1,135 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/perf_tests/DawnPerfTest.h"
+
+#include "tests/ParamGenerator.h"
+#include "utils/WGPUHelpers.h"
+
+#include <vector>
+
+namespace {
+
+    constexpr unsigned int kObjectsPerStep = 10000;
+
+    enum class ObjectType {
+        Encoders,    // Each object is a command encoder with a pass, finished in a command buffer.
+        BindGroups,  // Each object is a bind group of a new texture view, set in a pass.
+    };
+
+    struct ShortLivedObjectsParams : DawnTestParam {
+        ShortLivedObjectsParams(const DawnTestParam& param, ObjectType objectType)
+            : DawnTestParam(param), objectType(objectType) {
+        }
+
+        ObjectType objectType;
+    };
+
+    std::ostream& operator<<(std::ostream& ostream, const ShortLivedObjectsParams& param) {
+        ostream << static_cast<const DawnTestParam&>(param);
+
+        switch (param.objectType) {
+            case ObjectType::Encoders:
+                ostream << "_Encoders";
+                break;
+            case ObjectType::BindGroups:
+                ostream << "_BindGroups";
+                break;
+        }
+        return ostream;
+    }
+
+}  // anonymous namespace
+
+// Test the cost of creating, submitting and releasing many objects that only live for one frame,
+// which is dominated by their allocation. Each iteration is the lifetime of one object.
+class ShortLivedObjectsPerf : public DawnPerfTestWithParams<ShortLivedObjectsParams> {
+  public:
+    ShortLivedObjectsPerf() : DawnPerfTestWithParams(kObjectsPerStep, 3) {
+    }
+    ~ShortLivedObjectsPerf() override = default;
+
+    void TestSetUp() override;
+
+  private:
+    void Step() override;
+
+    void StepEncoders();
+    void StepBindGroups();
+
+    wgpu::Texture mTexture;
+    wgpu::BindGroupLayout mBindGroupLayout;
+    std::vector<wgpu::CommandBuffer> mCommandBuffers;
+};
+
+void ShortLivedObjectsPerf::TestSetUp() {
+    DawnPerfTestWithParams::TestSetUp();
+
+    wgpu::TextureDescriptor textureDesc;
+    textureDesc.dimension = wgpu::TextureDimension::e2D;
+    textureDesc.size = {4, 4, 1};
+    textureDesc.format = wgpu::TextureFormat::RGBA8Unorm;
+    textureDesc.usage = wgpu::TextureUsage::Sampled;
+    mTexture = device.CreateTexture(&textureDesc);
+
+    mBindGroupLayout = utils::MakeBindGroupLayout(
+        device, {{0, wgpu::ShaderStage::Compute, wgpu::BindingType::SampledTexture}});
+
+    mCommandBuffers.reserve(kObjectsPerStep);
+}
+
+void ShortLivedObjectsPerf::Step() {
+    switch (GetParam().objectType) {
+        case ObjectType::Encoders:
+            StepEncoders();
+            break;
+        case ObjectType::BindGroups:
+            StepBindGroups();
+            break;
+    }
+}
+
+void ShortLivedObjectsPerf::StepEncoders() {
+    for (unsigned int i = 0; i < kObjectsPerStep; ++i) {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::ComputePassEncoder pass = encoder.BeginComputePass();
+        pass.EndPass();
+        mCommandBuffers.push_back(encoder.Finish());
+    }
+
+    queue.Submit(static_cast<uint32_t>(mCommandBuffers.size()), mCommandBuffers.data());
+    mCommandBuffers.clear();
+}
+
+void ShortLivedObjectsPerf::StepBindGroups() {
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::ComputePassEncoder pass = encoder.BeginComputePass();
+    for (unsigned int i = 0; i < kObjectsPerStep; ++i) {
+        pass.SetBindGroup(
+            0, utils::MakeBindGroup(device, mBindGroupLayout, {{0, mTexture.CreateView()}}));
+    }
+    pass.EndPass();
+
+    wgpu::CommandBuffer commandBuffer = encoder.Finish();
+    queue.Submit(1, &commandBuffer);
+}
+
+TEST_P(ShortLivedObjectsPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_PERF_TEST_SUITE_P(ShortLivedObjectsPerf,
+                                   {D3D12Backend(), MetalBackend(), NullBackend(), OpenGLBackend(),
+                                    VulkanBackend()},
+                                   {ObjectType::Encoders, ObjectType::BindGroups});
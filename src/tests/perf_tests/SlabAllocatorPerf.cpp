@@ -0,0 +1,162 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/perf_tests/DawnPerfTest.h"
+
+#include "common/ConcurrentSlabAllocator.h"
+#include "common/SlabAllocator.h"
+#include "tests/ParamGenerator.h"
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    // Number of objects allocated then deallocated by each thread in a step.
+    constexpr unsigned int kNumAllocations = 256;
+    // Number of times each thread allocates and deallocates |kNumAllocations| objects in a step.
+    constexpr unsigned int kNumIterations = 100;
+
+    // Mimics a small command-tracking object.
+    struct TrackedObject : PlacementAllocated {
+        TrackedObject(uint64_t value) : value(value) {
+        }
+
+        uint64_t value;
+        void* pointers[3];
+    };
+
+    enum class AllocatorType {
+        LockedSlabAllocator,  // A SlabAllocator protected by a single mutex.
+        ConcurrentSlabAllocator,
+    };
+
+    struct SlabAllocatorParams : DawnTestParam {
+        SlabAllocatorParams(const DawnTestParam& param,
+                            AllocatorType allocatorType,
+                            uint32_t threadCount)
+            : DawnTestParam(param), allocatorType(allocatorType), threadCount(threadCount) {
+        }
+
+        AllocatorType allocatorType;
+        uint32_t threadCount;
+    };
+
+    std::ostream& operator<<(std::ostream& ostream, const SlabAllocatorParams& param) {
+        ostream << static_cast<const DawnTestParam&>(param);
+
+        switch (param.allocatorType) {
+            case AllocatorType::LockedSlabAllocator:
+                ostream << "_LockedSlabAllocator";
+                break;
+            case AllocatorType::ConcurrentSlabAllocator:
+                ostream << "_ConcurrentSlabAllocator";
+                break;
+        }
+
+        ostream << "_Threads_" << param.threadCount;
+        return ostream;
+    }
+
+    class LockedSlabAllocator {
+      public:
+        LockedSlabAllocator(size_t totalObjectBytes) : mAllocator(totalObjectBytes) {
+        }
+
+        TrackedObject* Allocate(uint64_t value) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            return mAllocator.Allocate(value);
+        }
+
+        void Deallocate(TrackedObject* object) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mAllocator.Deallocate(object);
+        }
+
+      private:
+        std::mutex mMutex;
+        SlabAllocator<TrackedObject> mAllocator;
+    };
+
+    template <typename Allocator>
+    void AllocateAndDeallocate(Allocator* allocator) {
+        std::vector<TrackedObject*> objects(kNumAllocations);
+        for (unsigned int iteration = 0; iteration < kNumIterations; ++iteration) {
+            for (unsigned int i = 0; i < kNumAllocations; ++i) {
+                objects[i] = allocator->Allocate(i);
+            }
+            for (TrackedObject* object : objects) {
+                allocator->Deallocate(object);
+            }
+        }
+    }
+
+}  // namespace
+
+// Test allocating and deallocating small objects from multiple threads at the same time. Each
+// iteration is a single allocation followed by a single deallocation on one thread.
+class SlabAllocatorPerf : public DawnPerfTestWithParams<SlabAllocatorParams> {
+  public:
+    SlabAllocatorPerf()
+        : DawnPerfTestWithParams(kNumIterations * kNumAllocations * GetParam().threadCount, 1) {
+    }
+    ~SlabAllocatorPerf() override = default;
+
+  private:
+    void Step() override;
+
+    template <typename Allocator>
+    void RunThreads(Allocator* allocator);
+};
+
+template <typename Allocator>
+void SlabAllocatorPerf::RunThreads(Allocator* allocator) {
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < GetParam().threadCount; ++i) {
+        threads.emplace_back([allocator]() { AllocateAndDeallocate(allocator); });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+void SlabAllocatorPerf::Step() {
+    constexpr size_t kSlabSize = 4096;
+
+    switch (GetParam().allocatorType) {
+        case AllocatorType::LockedSlabAllocator: {
+            LockedSlabAllocator allocator(kSlabSize);
+            RunThreads(&allocator);
+            break;
+        }
+
+        case AllocatorType::ConcurrentSlabAllocator: {
+            ConcurrentSlabAllocator<TrackedObject> allocator(kSlabSize);
+            RunThreads(&allocator);
+            break;
+        }
+    }
+}
+
+TEST_P(SlabAllocatorPerf, Run) {
+    RunTest();
+}
+
+// The allocators don't depend on the backend so only the Null backend is used.
+DAWN_INSTANTIATE_PERF_TEST_SUITE_P(SlabAllocatorPerf,
+                                   {NullBackend()},
+                                   {AllocatorType::LockedSlabAllocator,
+                                    AllocatorType::ConcurrentSlabAllocator},
+                                   {1u, 4u, 8u});
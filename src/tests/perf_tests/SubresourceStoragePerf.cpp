@@ -0,0 +1,205 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/perf_tests/DawnPerfTest.h"
+
+#include "dawn_native/SubresourceStorage.h"
+#include "tests/ParamGenerator.h"
+
+#include <vector>
+
+namespace {
+
+    using dawn_native::SubresourceRange;
+    using dawn_native::SubresourceStorage;
+
+    constexpr unsigned int kNumIterations = 100;
+
+    // A 2048-layer array with a full mip chain for a 2048x2048 texture.
+    constexpr uint32_t kArrayLayers = 2048;
+    constexpr uint32_t kMipLevels = 12;
+
+    enum class Storage {
+        PerSubresource,  // One bool per subresource, the previous TextureBase implementation.
+        Compressed,      // SubresourceStorage.
+    };
+
+    enum class Pattern {
+        WholeTexture,   // Query and set the whole texture.
+        LayerByLayer,   // Query and set all the mip levels of each layer, one layer at a time.
+        SingleLevel,    // Query and set a single mip level of each layer.
+    };
+
+    struct SubresourceStorageParams : DawnTestParam {
+        SubresourceStorageParams(const DawnTestParam& param, Storage storage, Pattern pattern)
+            : DawnTestParam(param), storage(storage), pattern(pattern) {
+        }
+
+        Storage storage;
+        Pattern pattern;
+    };
+
+    std::ostream& operator<<(std::ostream& ostream, const SubresourceStorageParams& param) {
+        ostream << static_cast<const DawnTestParam&>(param);
+
+        switch (param.storage) {
+            case Storage::PerSubresource:
+                ostream << "_PerSubresource";
+                break;
+            case Storage::Compressed:
+                ostream << "_Compressed";
+                break;
+        }
+
+        switch (param.pattern) {
+            case Pattern::WholeTexture:
+                ostream << "_WholeTexture";
+                break;
+            case Pattern::LayerByLayer:
+                ostream << "_LayerByLayer";
+                break;
+            case Pattern::SingleLevel:
+                ostream << "_SingleLevel";
+                break;
+        }
+        return ostream;
+    }
+
+    class PerSubresourceStorage {
+      public:
+        PerSubresourceStorage() : mData(kArrayLayers * kMipLevels, false) {
+        }
+
+        bool IsSet(const SubresourceRange& range) const {
+            for (uint32_t level = range.baseMipLevel;
+                 level < range.baseMipLevel + range.levelCount; ++level) {
+                for (uint32_t layer = range.baseArrayLayer;
+                     layer < range.baseArrayLayer + range.layerCount; ++layer) {
+                    if (!mData[layer * kMipLevels + level]) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        void Set(const SubresourceRange& range, bool value) {
+            for (uint32_t level = range.baseMipLevel;
+                 level < range.baseMipLevel + range.levelCount; ++level) {
+                for (uint32_t layer = range.baseArrayLayer;
+                     layer < range.baseArrayLayer + range.layerCount; ++layer) {
+                    mData[layer * kMipLevels + level] = value;
+                }
+            }
+        }
+
+      private:
+        std::vector<bool> mData;
+    };
+
+    class CompressedStorage {
+      public:
+        CompressedStorage() : mStorage(kArrayLayers, kMipLevels, false) {
+        }
+
+        bool IsSet(const SubresourceRange& range) const {
+            bool isSet = true;
+            mStorage.Iterate(range,
+                             [&isSet](const SubresourceRange&, bool value) { isSet &= value; });
+            return isSet;
+        }
+
+        void Set(const SubresourceRange& range, bool value) {
+            mStorage.Fill(range, value);
+        }
+
+      private:
+        SubresourceStorage<bool> mStorage;
+    };
+
+}  // namespace
+
+// Test tracking per-subresource state, like lazy-clear state, for a large texture array. Each
+// iteration is a query and an update of the whole texture in the given access pattern, followed
+// by a reset of the whole texture.
+class SubresourceStoragePerf : public DawnPerfTestWithParams<SubresourceStorageParams> {
+  public:
+    SubresourceStoragePerf() : DawnPerfTestWithParams(kNumIterations, 1) {
+    }
+    ~SubresourceStoragePerf() override = default;
+
+  private:
+    void Step() override;
+
+    template <typename StorageType>
+    void RunIterations();
+
+    // Prevents the compiler from optimizing away the queries.
+    uint32_t mSetCount = 0;
+};
+
+template <typename StorageType>
+void SubresourceStoragePerf::RunIterations() {
+    StorageType storage;
+    const SubresourceRange fullRange = {0, kMipLevels, 0, kArrayLayers};
+
+    for (unsigned int i = 0; i < kNumIterations; ++i) {
+        switch (GetParam().pattern) {
+            case Pattern::WholeTexture:
+                mSetCount += storage.IsSet(fullRange);
+                storage.Set(fullRange, true);
+                break;
+
+            case Pattern::LayerByLayer:
+                for (uint32_t layer = 0; layer < kArrayLayers; ++layer) {
+                    SubresourceRange range = {0, kMipLevels, layer, 1};
+                    mSetCount += storage.IsSet(range);
+                    storage.Set(range, true);
+                }
+                break;
+
+            case Pattern::SingleLevel:
+                for (uint32_t layer = 0; layer < kArrayLayers; ++layer) {
+                    SubresourceRange range = SubresourceRange::SingleSubresource(0, layer);
+                    mSetCount += storage.IsSet(range);
+                    storage.Set(range, true);
+                }
+                break;
+        }
+
+        storage.Set(fullRange, false);
+    }
+}
+
+void SubresourceStoragePerf::Step() {
+    switch (GetParam().storage) {
+        case Storage::PerSubresource:
+            RunIterations<PerSubresourceStorage>();
+            break;
+        case Storage::Compressed:
+            RunIterations<CompressedStorage>();
+            break;
+    }
+}
+
+TEST_P(SubresourceStoragePerf, Run) {
+    RunTest();
+}
+
+// The storage doesn't depend on the backend so only the Null backend is used.
+DAWN_INSTANTIATE_PERF_TEST_SUITE_P(SubresourceStoragePerf,
+                                   {NullBackend()},
+                                   {Storage::PerSubresource, Storage::Compressed},
+                                   {Pattern::WholeTexture, Pattern::LayerByLayer,
+                                    Pattern::SingleLevel});
@@ -0,0 +1,135 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "dawn/dawn_proc.h"
+#include "dawn/webgpu_cpp.h"
+
+#include <vector>
+
+namespace {
+
+    // Counts the reference and release calls made on buffers, samplers and bind group layouts
+    // while building bind groups like a hot rendering loop would.
+    uint32_t gReferenceCount = 0;
+    uint32_t gReleaseCount = 0;
+
+    constexpr uint32_t kBindingCount = 4;
+    constexpr uint32_t kBindGroupCount = 100;
+
+    class BorrowedHandleTests : public testing::Test {
+      protected:
+        void SetUp() override {
+            gReferenceCount = 0;
+            gReleaseCount = 0;
+
+            DawnProcTable procs = {};
+            procs.bufferReference = [](WGPUBuffer) { gReferenceCount++; };
+            procs.bufferRelease = [](WGPUBuffer) { gReleaseCount++; };
+            procs.samplerReference = [](WGPUSampler) { gReferenceCount++; };
+            procs.samplerRelease = [](WGPUSampler) { gReleaseCount++; };
+            procs.bindGroupLayoutReference = [](WGPUBindGroupLayout) { gReferenceCount++; };
+            procs.bindGroupLayoutRelease = [](WGPUBindGroupLayout) { gReleaseCount++; };
+            procs.bindGroupRelease = [](WGPUBindGroup) {};
+            procs.deviceRelease = [](WGPUDevice) {};
+            procs.deviceCreateBindGroup = [](WGPUDevice,
+                                             WGPUBindGroupDescriptor const* descriptor) {
+                // Check the C structure sees the handles of the borrowed structures.
+                EXPECT_NE(nullptr, descriptor->layout);
+                EXPECT_NE(nullptr, descriptor->bindings[0].buffer);
+                return reinterpret_cast<WGPUBindGroup>(1);
+            };
+            dawnProcSetProcs(&procs);
+
+            // The fake handles are never dereferenced.
+            device = wgpu::Device::Acquire(reinterpret_cast<WGPUDevice>(1));
+            layout = wgpu::BindGroupLayout::Acquire(reinterpret_cast<WGPUBindGroupLayout>(1));
+            for (uint32_t i = 0; i < kBindingCount; ++i) {
+                buffers.push_back(wgpu::Buffer::Acquire(reinterpret_cast<WGPUBuffer>(i + 1)));
+            }
+        }
+
+        void TearDown() override {
+            buffers.clear();
+            layout = nullptr;
+            device = nullptr;
+            dawnProcSetProcs(nullptr);
+        }
+
+        wgpu::Device device;
+        wgpu::BindGroupLayout layout;
+        std::vector<wgpu::Buffer> buffers;
+    };
+
+    // Test that a Borrowed handle refers to the object without referencing it.
+    TEST_F(BorrowedHandleTests, BorrowDoesNotReference) {
+        wgpu::Borrowed<wgpu::Buffer> borrowed = buffers[0];
+        ASSERT_EQ(buffers[0].Get(), borrowed.Get());
+        ASSERT_TRUE(borrowed);
+
+        wgpu::Borrowed<wgpu::Buffer> copy = borrowed;
+        ASSERT_EQ(buffers[0].Get(), copy.Get());
+
+        wgpu::Borrowed<wgpu::Buffer> null = nullptr;
+        ASSERT_FALSE(null);
+        ASSERT_TRUE(null == nullptr);
+
+        ASSERT_EQ(0u, gReferenceCount);
+        ASSERT_EQ(0u, gReleaseCount);
+    }
+
+    // Test that building descriptors with owning handles references every object they hold.
+    TEST_F(BorrowedHandleTests, OwningDescriptorsReferenceObjects) {
+        for (uint32_t i = 0; i < kBindGroupCount; ++i) {
+            wgpu::BindGroupBinding bindings[kBindingCount];
+            for (uint32_t j = 0; j < kBindingCount; ++j) {
+                bindings[j].binding = j;
+                bindings[j].buffer = buffers[j];
+                bindings[j].size = 4;
+            }
+
+            wgpu::BindGroupDescriptor descriptor;
+            descriptor.layout = layout;
+            descriptor.bindingCount = kBindingCount;
+            descriptor.bindings = bindings;
+            device.CreateBindGroup(&descriptor);
+        }
+
+        ASSERT_EQ(kBindGroupCount * (kBindingCount + 1), gReferenceCount);
+        ASSERT_EQ(gReferenceCount, gReleaseCount);
+    }
+
+    // Test that building descriptors with borrowed handles doesn't reference any object.
+    TEST_F(BorrowedHandleTests, BorrowedDescriptorsDoNotReferenceObjects) {
+        for (uint32_t i = 0; i < kBindGroupCount; ++i) {
+            wgpu::BorrowedBindGroupBinding bindings[kBindingCount];
+            for (uint32_t j = 0; j < kBindingCount; ++j) {
+                bindings[j].binding = j;
+                bindings[j].buffer = buffers[j];
+                bindings[j].size = 4;
+            }
+
+            wgpu::BorrowedBindGroupDescriptor descriptor;
+            descriptor.layout = layout;
+            descriptor.bindingCount = kBindingCount;
+            descriptor.bindings = bindings;
+            device.CreateBindGroup(&descriptor);
+        }
+
+        ASSERT_EQ(0u, gReferenceCount);
+        ASSERT_EQ(0u, gReleaseCount);
+    }
+
+}  // anonymous namespace
@@ -0,0 +1,168 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "common/HashUtils.h"
+#include "dawn_native/CacheKey.h"
+#include "dawn_native/CacheKeys_autogen.h"
+
+#include <unordered_set>
+#include <vector>
+
+using namespace dawn_native;
+
+namespace {
+
+    void RecordSamplerKey(CacheKey* key, const SamplerDescriptor& descriptor) {
+        SamplerDescriptorCacheKey packed;
+        PackCacheKey(&packed, descriptor);
+
+        key->RecordPacked(packed);
+        key->Seal();
+    }
+
+}  // anonymous namespace
+
+// Test that HashBytes depends on every byte, including the ones after the last 8-byte word.
+TEST(CacheKeyTests, HashBytesUsesAllBytes) {
+    std::vector<uint8_t> bytes(13, 0);
+    uint64_t hash = HashBytes(bytes.data(), bytes.size());
+    EXPECT_EQ(hash, HashBytes(bytes.data(), bytes.size()));
+
+    std::unordered_set<uint64_t> hashes = {hash};
+    for (size_t i = 0; i < bytes.size(); ++i) {
+        bytes[i] = 1;
+        EXPECT_TRUE(hashes.insert(HashBytes(bytes.data(), bytes.size())).second);
+        bytes[i] = 0;
+    }
+
+    // Trailing zeros change the hash since the size is hashed.
+    EXPECT_NE(HashBytes(bytes.data(), 12), HashBytes(bytes.data(), 13));
+    EXPECT_NE(HashBytes(bytes.data(), 0), HashBytes(bytes.data(), 8));
+}
+
+// Test that the hashes of many keys that only differ a little don't collide, including in the
+// low bits used to choose the buckets of the caches.
+TEST(CacheKeyTests, NoCollisions) {
+    constexpr uint32_t kKeyCount = 1 << 16;
+    constexpr uint64_t kLowBitsMask = (1 << 20) - 1;
+
+    std::unordered_set<uint64_t> hashes;
+    std::unordered_set<uint64_t> lowBits;
+    for (uint32_t i = 0; i < kKeyCount; ++i) {
+        SamplerDescriptor descriptor;
+        descriptor.magFilter = static_cast<wgpu::FilterMode>(i & 1);
+        descriptor.minFilter = static_cast<wgpu::FilterMode>((i >> 1) & 1);
+        descriptor.mipmapFilter = static_cast<wgpu::FilterMode>((i >> 2) & 1);
+        descriptor.addressModeU = static_cast<wgpu::AddressMode>((i >> 3) % 3);
+        descriptor.lodMaxClamp = static_cast<float>(i >> 3);
+
+        CacheKey key;
+        RecordSamplerKey(&key, descriptor);
+        uint64_t hash = key.GetHash();
+        EXPECT_TRUE(hashes.insert(hash).second);
+        lowBits.insert(hash & kLowBitsMask);
+    }
+
+    // Randomly distributed hashes would have about 2000 collisions of their low 20 bits.
+    EXPECT_GT(lowBits.size(), kKeyCount - 2500);
+}
+
+// Test that keys are equal when the descriptors are equal, even if their bits differ.
+TEST(CacheKeyTests, NegativeZeroIsZero) {
+    SamplerDescriptor descriptor;
+    descriptor.lodMinClamp = 0.0f;
+    CacheKey zeroKey;
+    RecordSamplerKey(&zeroKey, descriptor);
+
+    descriptor.lodMinClamp = -0.0f;
+    CacheKey negativeZeroKey;
+    RecordSamplerKey(&negativeZeroKey, descriptor);
+    EXPECT_TRUE(zeroKey == negativeZeroKey);
+    EXPECT_EQ(zeroKey.GetHash(), negativeZeroKey.GetHash());
+
+    descriptor.lodMinClamp = 1.0f;
+    CacheKey oneKey;
+    RecordSamplerKey(&oneKey, descriptor);
+    EXPECT_FALSE(zeroKey == oneKey);
+}
+
+// Test that labels aren't part of the keys.
+TEST(CacheKeyTests, LabelIsIgnored) {
+    SamplerDescriptor descriptor;
+    CacheKey key;
+    RecordSamplerKey(&key, descriptor);
+
+    descriptor.label = "sampler";
+    CacheKey labeledKey;
+    RecordSamplerKey(&labeledKey, descriptor);
+    EXPECT_TRUE(key == labeledKey);
+}
+
+// Test that the boundaries between strings are part of the keys.
+TEST(CacheKeyTests, StringsAreDelimited) {
+    CacheKey a;
+    a.Record(std::string("ab"));
+    a.Record(std::string("c"));
+    a.Seal();
+
+    CacheKey b;
+    b.Record(std::string("a"));
+    b.Record(std::string("bc"));
+    b.Seal();
+
+    EXPECT_FALSE(a == b);
+}
+
+// Test that keys larger than the inline storage keep all their bytes when they move to the heap.
+TEST(CacheKeyTests, LargeKeys) {
+    CacheKey a;
+    CacheKey b;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        a.Record(i);
+        b.Record(i);
+    }
+    a.Seal();
+    b.Seal();
+    EXPECT_TRUE(a == b);
+    EXPECT_EQ(a.GetHash(), b.GetHash());
+
+    CacheKey c;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        c.Record(i == 10 ? 0 : i);
+    }
+    c.Seal();
+    EXPECT_FALSE(a == c);
+}
+
+// Test that the nested structures and 64-bit members are packed.
+TEST(CacheKeyTests, PackedMembers) {
+    ColorStateDescriptor colorState;
+    colorState.format = wgpu::TextureFormat::RGBA8Unorm;
+    ColorStateDescriptorCacheKey packed;
+    PackCacheKey(&packed, colorState);
+    EXPECT_EQ(static_cast<uint32_t>(wgpu::BlendFactor::One), packed.alphaBlend.srcFactor);
+
+    colorState.alphaBlend.srcFactor = wgpu::BlendFactor::Zero;
+    PackCacheKey(&packed, colorState);
+    EXPECT_EQ(static_cast<uint32_t>(wgpu::BlendFactor::Zero), packed.alphaBlend.srcFactor);
+
+    VertexAttributeDescriptor attribute;
+    attribute.offset = 0x100000002ull;
+    VertexAttributeDescriptorCacheKey packedAttribute;
+    PackCacheKey(&packedAttribute, attribute);
+    EXPECT_EQ(2u, packedAttribute.offset[0]);
+    EXPECT_EQ(1u, packedAttribute.offset[1]);
+}
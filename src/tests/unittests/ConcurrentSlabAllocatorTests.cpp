@@ -0,0 +1,271 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "common/ConcurrentSlabAllocator.h"
+#include "common/Math.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    struct Foo : public PlacementAllocated {
+        Foo(int value) : value(value) {
+        }
+
+        int value;
+    };
+
+    struct alignas(256) AlignedFoo : public Foo {
+        using Foo::Foo;
+    };
+
+    constexpr uint32_t kNumThreads = 8;
+
+}  // namespace
+
+// Test that a concurrent slab allocator of a single object works.
+TEST(ConcurrentSlabAllocatorTests, Single) {
+    ConcurrentSlabAllocator<Foo> allocator(1 * sizeof(Foo));
+
+    Foo* obj = allocator.Allocate(4);
+    EXPECT_EQ(obj->value, 4);
+
+    allocator.Deallocate(obj);
+}
+
+// Allocate multiple objects on a single thread and check their data and alignment are correct.
+TEST(ConcurrentSlabAllocatorTests, AllocateSequential) {
+    ConcurrentSlabAllocator<AlignedFoo> allocator(9 * sizeof(AlignedFoo));
+
+    std::set<AlignedFoo*> objects;
+    std::vector<AlignedFoo*> orderedObjects;
+    for (int i = 0; i < 200; ++i) {
+        AlignedFoo* ptr = allocator.Allocate(i);
+        EXPECT_TRUE(objects.insert(ptr).second);
+        orderedObjects.push_back(ptr);
+    }
+
+    for (int i = 0; i < 200; ++i) {
+        // Check that the value is correct and hasn't been trampled.
+        EXPECT_EQ(orderedObjects[i]->value, i);
+
+        // Check that the alignment is correct.
+        EXPECT_TRUE(IsPtrAligned(orderedObjects[i], 256));
+    }
+
+    for (AlignedFoo* object : orderedObjects) {
+        allocator.Deallocate(object);
+    }
+}
+
+// Test that blocks deallocated on a thread are reused for allocations on the same thread.
+TEST(ConcurrentSlabAllocatorTests, ReusesFreedMemoryOnSameThread) {
+    ConcurrentSlabAllocator<Foo> allocator(17 * sizeof(Foo));
+
+    std::set<Foo*> objects;
+    for (int i = 0; i < 17; ++i) {
+        EXPECT_TRUE(objects.insert(allocator.Allocate(i)).second);
+    }
+    for (Foo* object : objects) {
+        allocator.Deallocate(object);
+    }
+
+    // Allocating again should only return blocks from the thread's magazine.
+    std::set<Foo*> reallocatedObjects;
+    for (int i = 0; i < 17; ++i) {
+        Foo* ptr = allocator.Allocate(i);
+        EXPECT_TRUE(reallocatedObjects.insert(ptr).second);
+        EXPECT_TRUE(objects.find(ptr) != objects.end());
+    }
+
+    for (Foo* object : reallocatedObjects) {
+        allocator.Deallocate(object);
+    }
+}
+
+// Test that flushing the thread cache returns blocks to the depot, and that they can be reused by
+// another thread.
+TEST(ConcurrentSlabAllocatorTests, FlushThreadCache) {
+    ConcurrentSlabAllocator<Foo> allocator(
+        ConcurrentSlabAllocatorImpl::kMagazineBatchSize * sizeof(Foo));
+
+    std::set<Foo*> objects;
+    for (uint32_t i = 0; i < ConcurrentSlabAllocatorImpl::kMagazineBatchSize; ++i) {
+        EXPECT_TRUE(objects.insert(allocator.Allocate(i)).second);
+    }
+    for (Foo* object : objects) {
+        allocator.Deallocate(object);
+    }
+    allocator.FlushThreadCache();
+
+    // The depot now has a single free slab, so the other thread's first batch comes from it.
+    std::vector<Foo*> otherThreadObjects;
+    std::thread thread([&]() {
+        for (uint32_t i = 0; i < ConcurrentSlabAllocatorImpl::kMagazineBatchSize; ++i) {
+            otherThreadObjects.push_back(allocator.Allocate(i));
+        }
+    });
+    thread.join();
+
+    for (Foo* object : otherThreadObjects) {
+        EXPECT_TRUE(objects.find(object) != objects.end());
+        allocator.Deallocate(object);
+    }
+}
+
+// Test many threads allocating and deallocating concurrently.
+TEST(ConcurrentSlabAllocatorTests, ConcurrentAllocateDeallocate) {
+    ConcurrentSlabAllocator<Foo> allocator(17 * sizeof(Foo));
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kNumThreads; ++t) {
+        threads.emplace_back([&allocator, t]() {
+            std::vector<Foo*> objects;
+            for (uint32_t round = 0; round < 10; ++round) {
+                for (uint32_t i = 0; i < 300; ++i) {
+                    objects.push_back(allocator.Allocate(static_cast<int>(t * 1000 + i)));
+                }
+
+                // Check no other thread trampled our objects.
+                for (uint32_t i = 0; i < 300; ++i) {
+                    EXPECT_EQ(objects[i]->value, static_cast<int>(t * 1000 + i));
+                }
+
+                // Deallocate every other object, then the rest, to interleave partially full
+                // magazines with batch transfers.
+                for (uint32_t i = 0; i < objects.size(); i += 2) {
+                    allocator.Deallocate(objects[i]);
+                }
+                for (uint32_t i = 1; i < objects.size(); i += 2) {
+                    allocator.Deallocate(objects[i]);
+                }
+                objects.clear();
+            }
+        });
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+// Test that objects can be deallocated on a different thread than they were allocated on.
+TEST(ConcurrentSlabAllocatorTests, CrossThreadDeallocate) {
+    ConcurrentSlabAllocator<Foo> allocator(17 * sizeof(Foo));
+
+    std::vector<std::vector<Foo*>> objectsPerThread(kNumThreads);
+
+    // Allocate objects on each thread.
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kNumThreads; ++t) {
+        threads.emplace_back([&allocator, &objectsPerThread, t]() {
+            for (uint32_t i = 0; i < 500; ++i) {
+                objectsPerThread[t].push_back(allocator.Allocate(static_cast<int>(i)));
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    threads.clear();
+
+    // Check all allocations are unique.
+    std::set<Foo*> allObjects;
+    for (const std::vector<Foo*>& objects : objectsPerThread) {
+        for (Foo* object : objects) {
+            EXPECT_TRUE(allObjects.insert(object).second);
+        }
+    }
+
+    // Deallocate each thread's objects on the "next" thread.
+    for (uint32_t t = 0; t < kNumThreads; ++t) {
+        threads.emplace_back([&allocator, &objectsPerThread, t]() {
+            for (Foo* object : objectsPerThread[(t + 1) % kNumThreads]) {
+                allocator.Deallocate(object);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+// Test that a thread can use multiple allocators and outlive some of them.
+TEST(ConcurrentSlabAllocatorTests, MultipleAllocators) {
+    ConcurrentSlabAllocator<Foo> allocatorA(17 * sizeof(Foo));
+
+    Foo* a = allocatorA.Allocate(1);
+    {
+        ConcurrentSlabAllocator<Foo> allocatorB(17 * sizeof(Foo));
+        Foo* b = allocatorB.Allocate(2);
+        EXPECT_NE(a, b);
+        EXPECT_EQ(a->value, 1);
+        EXPECT_EQ(b->value, 2);
+        allocatorB.Deallocate(b);
+    }
+
+    // Magazines for allocatorB are gone and allocatorA still works.
+    Foo* c = allocatorA.Allocate(3);
+    EXPECT_EQ(a->value, 1);
+    EXPECT_EQ(c->value, 3);
+    allocatorA.Deallocate(a);
+    allocatorA.Deallocate(c);
+}
+
+// Test that an allocator can be destroyed while other threads that used it are still alive.
+TEST(ConcurrentSlabAllocatorTests, DestroyWhileOtherThreadHoldsMagazine) {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool threadUsedAllocator = false;
+    bool allocatorDestroyed = false;
+
+    auto allocator = std::make_unique<ConcurrentSlabAllocator<Foo>>(17 * sizeof(Foo));
+
+    std::thread thread([&]() {
+        // Leave a non-empty magazine for |allocator| in this thread's cache.
+        allocator->Deallocate(allocator->Allocate(0));
+
+        std::unique_lock<std::mutex> lock(mutex);
+        threadUsedAllocator = true;
+        cv.notify_one();
+        cv.wait(lock, [&]() { return allocatorDestroyed; });
+        lock.unlock();
+
+        // Using another allocator prunes the magazine of the destroyed one.
+        ConcurrentSlabAllocator<Foo> other(17 * sizeof(Foo));
+        other.Deallocate(other.Allocate(1));
+    });
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&]() { return threadUsedAllocator; });
+    }
+
+    allocator->Deallocate(allocator->Allocate(2));
+    allocator = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        allocatorDestroyed = true;
+    }
+    cv.notify_one();
+    thread.join();
+}
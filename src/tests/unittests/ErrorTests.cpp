@@ -22,7 +22,9 @@ using namespace dawn_native;
 namespace {
 
 int dummySuccess = 0xbeef;
-const char* dummyErrorMessage = "I am an error message :3";
+// The error macros only take string literals as messages.
+#define DUMMY_ERROR_MESSAGE "I am an error message :3"
+const char* dummyErrorMessage = DUMMY_ERROR_MESSAGE;
 
 // Check returning a success MaybeError with {};
 TEST(ErrorTests, Error_Success) {
@@ -37,7 +39,7 @@ TEST(ErrorTests, Error_Success) {
 // Check returning an error MaybeError with "return DAWN_VALIDATION_ERROR"
 TEST(ErrorTests, Error_Error) {
     auto ReturnError = []() -> MaybeError {
-        return DAWN_VALIDATION_ERROR(dummyErrorMessage);
+        return DAWN_VALIDATION_ERROR(DUMMY_ERROR_MESSAGE);
     };
 
     MaybeError result = ReturnError();
@@ -61,7 +63,7 @@ TEST(ErrorTests, ResultOrError_Success) {
 // Check returning an error ResultOrError with "return DAWN_VALIDATION_ERROR"
 TEST(ErrorTests, ResultOrError_Error) {
     auto ReturnError = []() -> ResultOrError<int*> {
-        return DAWN_VALIDATION_ERROR(dummyErrorMessage);
+        return DAWN_VALIDATION_ERROR(DUMMY_ERROR_MESSAGE);
     };
 
     ResultOrError<int*> result = ReturnError();
@@ -94,7 +96,7 @@ TEST(ErrorTests, TRY_Success) {
 // Check DAWN_TRY handles errors correctly.
 TEST(ErrorTests, TRY_Error) {
     auto ReturnError = []() -> MaybeError {
-        return DAWN_VALIDATION_ERROR(dummyErrorMessage);
+        return DAWN_VALIDATION_ERROR(DUMMY_ERROR_MESSAGE);
     };
 
     auto Try = [ReturnError]() -> MaybeError {
@@ -114,7 +116,7 @@ TEST(ErrorTests, TRY_Error) {
 // Check DAWN_TRY adds to the backtrace.
 TEST(ErrorTests, TRY_AddsToBacktrace) {
     auto ReturnError = []() -> MaybeError {
-        return DAWN_VALIDATION_ERROR(dummyErrorMessage);
+        return DAWN_VALIDATION_ERROR(DUMMY_ERROR_MESSAGE);
     };
 
     auto SingleTry = [ReturnError]() -> MaybeError {
@@ -166,7 +168,7 @@ TEST(ErrorTests, TRY_RESULT_Success) {
 // Check DAWN_TRY_ASSIGN handles errors correctly.
 TEST(ErrorTests, TRY_RESULT_Error) {
     auto ReturnError = []() -> ResultOrError<int*> {
-        return DAWN_VALIDATION_ERROR(dummyErrorMessage);
+        return DAWN_VALIDATION_ERROR(DUMMY_ERROR_MESSAGE);
     };
 
     auto Try = [ReturnError]() -> ResultOrError<int*> {
@@ -189,7 +191,7 @@ TEST(ErrorTests, TRY_RESULT_Error) {
 // Check DAWN_TRY_ASSIGN adds to the backtrace.
 TEST(ErrorTests, TRY_RESULT_AddsToBacktrace) {
     auto ReturnError = []() -> ResultOrError<int*> {
-        return DAWN_VALIDATION_ERROR(dummyErrorMessage);
+        return DAWN_VALIDATION_ERROR(DUMMY_ERROR_MESSAGE);
     };
 
     auto SingleTry = [ReturnError]() -> ResultOrError<int*> {
@@ -217,7 +219,7 @@ TEST(ErrorTests, TRY_RESULT_AddsToBacktrace) {
 // Check a ResultOrError can be DAWN_TRY_ASSIGNED in a function that returns an Error
 TEST(ErrorTests, TRY_RESULT_ConversionToError) {
     auto ReturnError = []() -> ResultOrError<int*> {
-        return DAWN_VALIDATION_ERROR(dummyErrorMessage);
+        return DAWN_VALIDATION_ERROR(DUMMY_ERROR_MESSAGE);
     };
 
     auto Try = [ReturnError]() -> MaybeError {
@@ -239,7 +241,7 @@ TEST(ErrorTests, TRY_RESULT_ConversionToError) {
 // Version without Result<E*, T*>
 TEST(ErrorTests, TRY_RESULT_ConversionToErrorNonPointer) {
     auto ReturnError = []() -> ResultOrError<int> {
-        return DAWN_VALIDATION_ERROR(dummyErrorMessage);
+        return DAWN_VALIDATION_ERROR(DUMMY_ERROR_MESSAGE);
     };
 
     auto Try = [ReturnError]() -> MaybeError {
@@ -261,7 +263,7 @@ TEST(ErrorTests, TRY_RESULT_ConversionToErrorNonPointer) {
 // Check DAWN_TRY handles errors correctly.
 TEST(ErrorTests, TRY_ConversionToErrorOrResult) {
     auto ReturnError = []() -> MaybeError {
-        return DAWN_VALIDATION_ERROR(dummyErrorMessage);
+        return DAWN_VALIDATION_ERROR(DUMMY_ERROR_MESSAGE);
     };
 
     auto Try = [ReturnError]() -> ResultOrError<int*>{
@@ -280,7 +282,7 @@ TEST(ErrorTests, TRY_ConversionToErrorOrResult) {
 // Check DAWN_TRY handles errors correctly. Version without Result<E*, T*>
 TEST(ErrorTests, TRY_ConversionToErrorOrResultNonPointer) {
     auto ReturnError = []() -> MaybeError {
-        return DAWN_VALIDATION_ERROR(dummyErrorMessage);
+        return DAWN_VALIDATION_ERROR(DUMMY_ERROR_MESSAGE);
     };
 
     auto Try = [ReturnError]() -> ResultOrError<int>{
@@ -295,4 +297,40 @@ TEST(ErrorTests, TRY_ConversionToErrorOrResultNonPointer) {
     ASSERT_EQ(errorData->GetMessage(), dummyErrorMessage);
 }
 
+// Check that the arguments of an error replace the "{}" in its message
+TEST(ErrorTests, Error_FormatsArguments) {
+    auto ReturnError = []() -> MaybeError {
+        return DAWN_VALIDATION_ERROR("Index {} is over the max of {}", 7u, 4u);
+    };
+
+    MaybeError result = ReturnError();
+    ASSERT_TRUE(result.IsError());
+
+    std::unique_ptr<ErrorData> errorData = result.AcquireError();
+    ASSERT_EQ(errorData->GetMessage(), "Index 7 is over the max of 4");
+}
+
+// Check that messages built at runtime are copied in the error
+TEST(ErrorTests, Error_CopiesRuntimeMessage) {
+    std::unique_ptr<ErrorData> errorData;
+    {
+        std::string message = std::string("Binding ") + std::to_string(3) + " is invalid";
+        errorData = DAWN_MAKE_ERROR_FROM_STRING(InternalErrorType::Validation, message);
+        message.assign(message.size(), 'x');
+    }
+
+    ASSERT_EQ(errorData->GetMessage(), "Binding 3 is invalid");
+}
+
+// Check that the backtrace is bounded and keeps the innermost records
+TEST(ErrorTests, TRY_BacktraceIsBounded) {
+    std::unique_ptr<ErrorData> errorData = DAWN_VALIDATION_ERROR(DUMMY_ERROR_MESSAGE);
+    for (size_t i = 0; i < 2 * ErrorData::kMaxBacktraceSize; ++i) {
+        errorData->AppendBacktrace(__FILE__, __func__, __LINE__);
+    }
+
+    ASSERT_EQ(errorData->GetBacktrace().size(), ErrorData::kMaxBacktraceSize);
+    ASSERT_EQ(errorData->GetMessage(), dummyErrorMessage);
+}
+
 }  // anonymous namespace
@@ -16,6 +16,8 @@
 
 #include "dawn/webgpu_cpp.h"
 
+#include <type_traits>
+
 class Object : public wgpu::ObjectBase<Object, int*> {
   public:
     using ObjectBase::ObjectBase;
@@ -52,6 +54,12 @@ TEST(ObjectBase, AcquireConstruction) {
     ASSERT_EQ(0, refcount);
 }
 
+// Test that moves are noexcept so that containers move objects instead of copying them.
+TEST(ObjectBase, MovesAreNoexcept) {
+    static_assert(std::is_nothrow_move_constructible<Object>::value, "");
+    static_assert(std::is_nothrow_move_assignable<Object>::value, "");
+}
+
 // Test .Get().
 TEST(ObjectBase, Get) {
     int refcount = 1;
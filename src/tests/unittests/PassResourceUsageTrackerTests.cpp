@@ -0,0 +1,111 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "dawn_native/PassResourceUsageTracker.h"
+
+using namespace dawn_native;
+
+namespace {
+
+    // The tracker only uses resources as keys so fake pointers can be used.
+    BufferBase* FakeBuffer(uintptr_t id) {
+        return reinterpret_cast<BufferBase*>(id * 16);
+    }
+
+    TextureBase* FakeTexture(uintptr_t id) {
+        return reinterpret_cast<TextureBase*>(id * 16);
+    }
+
+}  // anonymous namespace
+
+// Test that usages tracked one by one come out sorted and deduplicated.
+TEST(PassResourceUsageTrackerTests, SortedAndUnique) {
+    PassResourceUsageTracker tracker;
+    tracker.BufferUsedAs(FakeBuffer(3), wgpu::BufferUsage::Vertex);
+    tracker.BufferUsedAs(FakeBuffer(1), wgpu::BufferUsage::Uniform);
+    tracker.BufferUsedAs(FakeBuffer(3), wgpu::BufferUsage::Index);
+    tracker.TextureUsedAs(FakeTexture(2), wgpu::TextureUsage::Sampled);
+
+    PassResourceUsage usage = tracker.AcquireResourceUsage();
+    ASSERT_EQ(2u, usage.buffers.size());
+    EXPECT_EQ(FakeBuffer(1), usage.buffers[0]);
+    EXPECT_EQ(wgpu::BufferUsage::Uniform, usage.bufferUsages[0]);
+    EXPECT_EQ(FakeBuffer(3), usage.buffers[1]);
+    EXPECT_EQ(wgpu::BufferUsage::Vertex | wgpu::BufferUsage::Index, usage.bufferUsages[1]);
+    ASSERT_EQ(1u, usage.textures.size());
+    EXPECT_EQ(FakeTexture(2), usage.textures[0]);
+}
+
+// Test that merged usages are combined with the ones tracked one by one.
+TEST(PassResourceUsageTrackerTests, AddResourceUsage) {
+    PassResourceUsage added;
+    added.buffers = {FakeBuffer(1), FakeBuffer(4)};
+    added.bufferUsages = {wgpu::BufferUsage::Uniform, wgpu::BufferUsage::Storage};
+    added.textures = {FakeTexture(2)};
+    added.textureUsages = {wgpu::TextureUsage::Sampled};
+
+    PassResourceUsageTracker tracker;
+    tracker.BufferUsedAs(FakeBuffer(4), wgpu::BufferUsage::Vertex);
+    tracker.BufferUsedAs(FakeBuffer(2), wgpu::BufferUsage::Index);
+    tracker.AddResourceUsage(added);
+    tracker.AddResourceUsage(added);
+    tracker.TextureUsedAs(FakeTexture(1), wgpu::TextureUsage::OutputAttachment);
+
+    PassResourceUsage usage = tracker.AcquireResourceUsage();
+    ASSERT_EQ(3u, usage.buffers.size());
+    EXPECT_EQ(FakeBuffer(1), usage.buffers[0]);
+    EXPECT_EQ(wgpu::BufferUsage::Uniform, usage.bufferUsages[0]);
+    EXPECT_EQ(FakeBuffer(2), usage.buffers[1]);
+    EXPECT_EQ(wgpu::BufferUsage::Index, usage.bufferUsages[1]);
+    EXPECT_EQ(FakeBuffer(4), usage.buffers[2]);
+    EXPECT_EQ(wgpu::BufferUsage::Vertex | wgpu::BufferUsage::Storage, usage.bufferUsages[2]);
+
+    ASSERT_EQ(2u, usage.textures.size());
+    EXPECT_EQ(FakeTexture(1), usage.textures[0]);
+    EXPECT_EQ(wgpu::TextureUsage::OutputAttachment, usage.textureUsages[0]);
+    EXPECT_EQ(FakeTexture(2), usage.textures[1]);
+    EXPECT_EQ(wgpu::TextureUsage::Sampled, usage.textureUsages[1]);
+
+    // Acquiring the usage resets the tracker.
+    usage = tracker.AcquireResourceUsage();
+    EXPECT_TRUE(usage.buffers.empty());
+    EXPECT_TRUE(usage.textures.empty());
+}
+
+// Test merging a list of usages with shared resources.
+TEST(PassResourceUsageTrackerTests, MergeResourceUsages) {
+    PassResourceUsage a;
+    a.buffers = {FakeBuffer(1), FakeBuffer(3)};
+    a.bufferUsages = {wgpu::BufferUsage::Uniform, wgpu::BufferUsage::Vertex};
+
+    PassResourceUsage b;
+    b.buffers = {FakeBuffer(2), FakeBuffer(3)};
+    b.bufferUsages = {wgpu::BufferUsage::Storage, wgpu::BufferUsage::Index};
+    b.textures = {FakeTexture(5)};
+    b.textureUsages = {wgpu::TextureUsage::Storage};
+
+    PassResourceUsage merged = MergeResourceUsages({&a, &b, &a});
+    ASSERT_EQ(3u, merged.buffers.size());
+    EXPECT_EQ(FakeBuffer(1), merged.buffers[0]);
+    EXPECT_EQ(wgpu::BufferUsage::Uniform, merged.bufferUsages[0]);
+    EXPECT_EQ(FakeBuffer(2), merged.buffers[1]);
+    EXPECT_EQ(wgpu::BufferUsage::Storage, merged.bufferUsages[1]);
+    EXPECT_EQ(FakeBuffer(3), merged.buffers[2]);
+    EXPECT_EQ(wgpu::BufferUsage::Vertex | wgpu::BufferUsage::Index, merged.bufferUsages[2]);
+    ASSERT_EQ(1u, merged.textures.size());
+    EXPECT_EQ(FakeTexture(5), merged.textures[0]);
+    EXPECT_EQ(wgpu::TextureUsage::Storage, merged.textureUsages[0]);
+}
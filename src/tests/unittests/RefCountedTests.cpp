@@ -29,6 +29,10 @@ struct RCTest : public RefCounted {
     RCTest(bool* deleted) : deleted(deleted) {
     }
 
+    RCTest(bool* deleted, uint64_t payload, RefCountMode mode)
+        : RefCounted(payload, mode), deleted(deleted) {
+    }
+
     ~RCTest() override {
         if (deleted != nullptr) {
             *deleted = true;
@@ -64,6 +68,21 @@ TEST(RefCounted, AddingRefKeepsAlive) {
     ASSERT_TRUE(deleted);
 }
 
+// Test that non-atomic refcounts keep the RC alive and destroy it like atomic ones.
+TEST(RefCounted, NonAtomicAddingRefKeepsAlive) {
+    bool deleted = false;
+    auto test = new RCTest(&deleted, 0, RefCountMode::NonAtomic);
+    ASSERT_EQ(1u, test->GetRefCountForTesting());
+
+    test->Reference();
+    ASSERT_EQ(2u, test->GetRefCountForTesting());
+    test->Release();
+    ASSERT_FALSE(deleted);
+
+    test->Release();
+    ASSERT_TRUE(deleted);
+}
+
 // Test that Reference and Release atomically change the refcount.
 TEST(RefCounted, RaceOnReferenceRelease) {
     bool deleted = false;
@@ -238,3 +257,18 @@ TEST(Ref, PayloadUnchangedByRefCounting) {
 
     test->Release();
 }
+
+// Test that the payload of non-atomic RCs isn't mixed with their refcounting mode
+TEST(Ref, NonAtomicPayloadUnchangedByRefCounting) {
+    bool deleted = false;
+    RCTest* test = new RCTest(&deleted, 1ull, RefCountMode::NonAtomic);
+    ASSERT_EQ(test->GetRefCountPayload(), 1u);
+
+    test->Reference();
+    ASSERT_EQ(test->GetRefCountPayload(), 1u);
+    test->Release();
+    ASSERT_EQ(test->GetRefCountPayload(), 1u);
+
+    test->Release();
+    ASSERT_TRUE(deleted);
+}
@@ -0,0 +1,323 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "dawn_native/ErrorData.h"
+#include "dawn_native/SpirvReflector.h"
+#include "utils/WGPUHelpers.h"
+
+#include <spirv_cross.hpp>
+
+#include <algorithm>
+
+using namespace dawn_native;
+
+namespace {
+
+    using VariableKind = SpirvReflector::VariableKind;
+
+    Format::Type ToFormatType(spirv_cross::SPIRType::BaseType baseType) {
+        switch (baseType) {
+            case spirv_cross::SPIRType::Float:
+                return Format::Type::Float;
+            case spirv_cross::SPIRType::Int:
+                return Format::Type::Sint;
+            case spirv_cross::SPIRType::UInt:
+                return Format::Type::Uint;
+            default:
+                return Format::Type::Other;
+        }
+    }
+
+    class SpirvReflectorTests : public testing::Test {
+      protected:
+        // Reflects the shader with the SpirvReflector and checks that the variables it finds are
+        // the resources spirv_cross finds, with the same properties.
+        void CheckMatchesSpirvCross(utils::SingleShaderStage stage, const char* source) {
+            std::vector<uint32_t> spirv = utils::CompileGLSLToSpirv(stage, source);
+            ASSERT_FALSE(spirv.empty());
+
+            SpirvReflector reflector;
+            MaybeError result = reflector.Reflect(spirv.data(), spirv.size());
+            ASSERT_TRUE(result.IsSuccess());
+
+            spirv_cross::Compiler compiler(spirv);
+            switch (compiler.get_execution_model()) {
+                case spv::ExecutionModelVertex:
+                    EXPECT_EQ(SingleShaderStage::Vertex, reflector.GetExecutionModel());
+                    break;
+                case spv::ExecutionModelFragment:
+                    EXPECT_EQ(SingleShaderStage::Fragment, reflector.GetExecutionModel());
+                    break;
+                case spv::ExecutionModelGLCompute:
+                    EXPECT_EQ(SingleShaderStage::Compute, reflector.GetExecutionModel());
+                    break;
+                default:
+                    FAIL();
+            }
+
+            spirv_cross::ShaderResources resources = compiler.get_shader_resources();
+            CheckResources(compiler, reflector, resources.uniform_buffers,
+                           VariableKind::UniformBuffer);
+            CheckResources(compiler, reflector, resources.storage_buffers,
+                           VariableKind::StorageBuffer);
+            CheckResources(compiler, reflector, resources.separate_images,
+                           VariableKind::SampledTexture);
+            CheckResources(compiler, reflector, resources.separate_samplers,
+                           VariableKind::Sampler);
+            CheckResources(compiler, reflector, resources.storage_images,
+                           VariableKind::StorageTexture);
+            CheckResources(compiler, reflector, resources.push_constant_buffers,
+                           VariableKind::PushConstant);
+            CheckResources(compiler, reflector, resources.stage_inputs, VariableKind::StageInput);
+            CheckResources(compiler, reflector, resources.stage_outputs,
+                           VariableKind::StageOutput);
+        }
+
+        // Reflects the code and returns the error message, or an empty string on success.
+        std::string GetReflectionError(const std::vector<uint32_t>& spirv) {
+            SpirvReflector reflector;
+            MaybeError result = reflector.Reflect(spirv.data(), spirv.size());
+            if (result.IsSuccess()) {
+                return "";
+            }
+            return result.AcquireError()->GetMessage();
+        }
+
+      private:
+        void CheckResources(const spirv_cross::Compiler& compiler,
+                            const SpirvReflector& reflector,
+                            const spirv_cross::SmallVector<spirv_cross::Resource>& resources,
+                            VariableKind kind) {
+            std::vector<const SpirvReflector::Variable*> variables;
+            for (const SpirvReflector::Variable& variable : reflector.GetVariables()) {
+                if (variable.kind == kind) {
+                    variables.push_back(&variable);
+                }
+            }
+            ASSERT_EQ(resources.size(), variables.size());
+
+            for (const spirv_cross::Resource& resource : resources) {
+                uint32_t id = resource.id;
+                auto it = std::find_if(variables.begin(), variables.end(),
+                                       [id](const SpirvReflector::Variable* variable) {
+                                           return variable->id == id;
+                                       });
+                ASSERT_NE(variables.end(), it);
+                const SpirvReflector::Variable& variable = **it;
+
+                EXPECT_EQ(static_cast<uint32_t>(resource.base_type_id), variable.baseTypeId);
+
+                const spirv_cross::Bitset& decorations =
+                    compiler.get_decoration_bitset(resource.id);
+                EXPECT_EQ(decorations.get(spv::DecorationBinding), variable.hasBinding);
+                EXPECT_EQ(compiler.get_decoration(resource.id, spv::DecorationBinding),
+                          variable.binding);
+                EXPECT_EQ(decorations.get(spv::DecorationDescriptorSet),
+                          variable.hasDescriptorSet);
+                EXPECT_EQ(compiler.get_decoration(resource.id, spv::DecorationDescriptorSet),
+                          variable.descriptorSet);
+                EXPECT_EQ(decorations.get(spv::DecorationLocation), variable.hasLocation);
+                EXPECT_EQ(compiler.get_decoration(resource.id, spv::DecorationLocation),
+                          variable.location);
+                EXPECT_EQ(decorations.get(spv::DecorationNonReadable), variable.nonReadable);
+
+                const spirv_cross::SPIRType& type = compiler.get_type(resource.base_type_id);
+                switch (kind) {
+                    case VariableKind::StorageBuffer:
+                        EXPECT_EQ(compiler.get_buffer_block_flags(resource.id)
+                                      .get(spv::DecorationNonWritable),
+                                  variable.nonWritable);
+                        break;
+                    case VariableKind::SampledTexture:
+                    case VariableKind::StorageTexture:
+                        EXPECT_EQ(decorations.get(spv::DecorationNonWritable),
+                                  variable.nonWritable);
+                        EXPECT_EQ(type.image.dim, variable.dimension);
+                        EXPECT_EQ(type.image.arrayed, variable.arrayed);
+                        EXPECT_EQ(type.image.ms, variable.multisampled);
+                        EXPECT_EQ(type.image.format, variable.imageFormat);
+                        EXPECT_EQ(ToFormatType(compiler.get_type(type.image.type).basetype),
+                                  variable.componentType);
+                        break;
+                    case VariableKind::StageInput:
+                    case VariableKind::StageOutput:
+                        EXPECT_EQ(ToFormatType(type.basetype), variable.componentType);
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+    };
+
+}  // anonymous namespace
+
+// Test a vertex shader with vertex attributes, a uniform buffer and builtin outputs.
+TEST_F(SpirvReflectorTests, VertexShader) {
+    CheckMatchesSpirvCross(utils::SingleShaderStage::Vertex, R"(
+        #version 450
+        layout(set = 0, binding = 0) uniform Uniforms {
+            mat4 transform;
+            vec4 color;
+        } uniforms;
+        layout(location = 0) in vec4 position;
+        layout(location = 1) in ivec2 index;
+        layout(location = 3) in uvec4 mask;
+        layout(location = 0) out vec4 color;
+        layout(location = 1) flat out int outIndex;
+        void main() {
+            color = uniforms.color * vec4(mask);
+            outIndex = index.x;
+            gl_PointSize = 1.0;
+            gl_Position = uniforms.transform * position;
+        })");
+}
+
+// Test a vertex shader using gl_VertexIndex, which is a builtin input.
+TEST_F(SpirvReflectorTests, VertexShaderWithBuiltinInputs) {
+    CheckMatchesSpirvCross(utils::SingleShaderStage::Vertex, R"(
+        #version 450
+        void main() {
+            const vec2 pos[3] = vec2[3](vec2(-1.0, -1.0), vec2(3.0, -1.0), vec2(-1.0, 3.0));
+            gl_Position = vec4(pos[gl_VertexIndex], 0.0, float(gl_InstanceIndex));
+        })");
+}
+
+// Test a fragment shader with separate textures and samplers and outputs of each type.
+TEST_F(SpirvReflectorTests, FragmentShader) {
+    CheckMatchesSpirvCross(utils::SingleShaderStage::Fragment, R"(
+        #version 450
+        layout(set = 0, binding = 0) uniform sampler samp;
+        layout(set = 0, binding = 1) uniform texture2D tex2D;
+        layout(set = 1, binding = 0) uniform itexture2DArray tex2DArray;
+        layout(set = 1, binding = 1) uniform utextureCube texCube;
+        layout(set = 2, binding = 3) uniform texture3D tex3D;
+        layout(set = 2, binding = 4) uniform texture2DMS tex2DMS;
+        layout(location = 0) in vec2 uv;
+        layout(location = 0) out vec4 fragColor;
+        layout(location = 1) out ivec4 fragInt;
+        layout(location = 2) out uvec4 fragUint;
+        void main() {
+            fragColor = texture(sampler2D(tex2D, samp), uv) +
+                        texture(sampler3D(tex3D, samp), vec3(uv, 0.0)) +
+                        texelFetch(sampler2DMS(tex2DMS, samp), ivec2(uv), 0);
+            fragInt = texture(isampler2DArray(tex2DArray, samp), vec3(uv, 0.0));
+            fragUint = texture(usamplerCube(texCube, samp), vec3(uv, 0.0));
+        })");
+}
+
+// Test a fragment shader reading builtin inputs.
+TEST_F(SpirvReflectorTests, FragmentShaderWithBuiltinInputs) {
+    CheckMatchesSpirvCross(utils::SingleShaderStage::Fragment, R"(
+        #version 450
+        layout(location = 0) out vec4 fragColor;
+        void main() {
+            fragColor = vec4(gl_FragCoord.xy, gl_FrontFacing ? 1.0 : 0.0, 1.0);
+        })");
+}
+
+// Test a compute shader with readonly and writable storage buffers.
+TEST_F(SpirvReflectorTests, StorageBuffers) {
+    CheckMatchesSpirvCross(utils::SingleShaderStage::Compute, R"(
+        #version 450
+        layout(set = 0, binding = 0) readonly buffer ReadonlyBuffer {
+            uint data[];
+        } src;
+        layout(set = 0, binding = 1) buffer PartiallyReadonlyBuffer {
+            readonly uint count;
+            uint data[];
+        } partial;
+        layout(std430, set = 0, binding = 2) buffer WritableBuffer {
+            uint data[];
+        } dst;
+        layout(set = 1, binding = 0) uniform Params {
+            uint offset;
+        } params;
+        void main() {
+            dst.data[gl_GlobalInvocationID.x] = src.data[params.offset] + partial.count;
+            partial.data[0] = 0u;
+        })");
+}
+
+// Test a compute shader with readonly, writeonly and read-write storage textures.
+TEST_F(SpirvReflectorTests, StorageTextures) {
+    CheckMatchesSpirvCross(utils::SingleShaderStage::Compute, R"(
+        #version 450
+        layout(set = 0, binding = 0, rgba8) uniform readonly image2D srcImage;
+        layout(set = 0, binding = 1, r32ui) uniform writeonly uimage2DArray dstImage;
+        layout(set = 0, binding = 2, rgba32i) uniform iimage3D rwImage;
+        layout(set = 0, binding = 3, r32f) uniform image1D image1D;
+        void main() {
+            vec4 color = imageLoad(srcImage, ivec2(gl_GlobalInvocationID.xy));
+            imageStore(dstImage, ivec3(gl_GlobalInvocationID), uvec4(color * 255.0));
+            imageStore(rwImage, ivec3(0), imageLoad(rwImage, ivec3(1)));
+            imageStore(image1D, 0, vec4(1.0));
+        })");
+}
+
+// Test resources without set or binding decorations, and arrays of resources.
+TEST_F(SpirvReflectorTests, MissingDecorationsAndArrays) {
+    CheckMatchesSpirvCross(utils::SingleShaderStage::Fragment, R"(
+        #version 450
+        layout(binding = 2) uniform sampler samplers[2];
+        layout(set = 1, binding = 0) uniform texture2D textures[3];
+        layout(location = 0) out vec4 fragColor;
+        void main() {
+            fragColor = texture(sampler2D(textures[1], samplers[0]), vec2(0.0));
+        })");
+}
+
+// Test that push constants are reflected so that the frontend can reject them.
+TEST_F(SpirvReflectorTests, PushConstants) {
+    CheckMatchesSpirvCross(utils::SingleShaderStage::Compute, R"(
+        #version 450
+        layout(push_constant) uniform PushConstants {
+            uint value;
+        } pushConstants;
+        layout(set = 0, binding = 0) buffer Buffer {
+            uint data[];
+        } buf;
+        void main() {
+            buf.data[0] = pushConstants.value;
+        })");
+}
+
+// Test that code without a valid SPIR-V header is rejected.
+TEST_F(SpirvReflectorTests, InvalidHeader) {
+    EXPECT_EQ("Invalid SPIR-V header", GetReflectionError({}));
+    EXPECT_EQ("Invalid SPIR-V header", GetReflectionError({spv::MagicNumber, 0x10000, 0, 1}));
+    EXPECT_EQ("Invalid SPIR-V header", GetReflectionError({0xDEADBEEF, 0x10000, 0, 1, 0}));
+}
+
+// Test that an id bound bigger than the code is rejected instead of being allocated.
+TEST_F(SpirvReflectorTests, InvalidIdBound) {
+    EXPECT_EQ("Invalid SPIR-V id bound",
+              GetReflectionError({spv::MagicNumber, 0x10000, 0, 0xFFFFFFFF, 0}));
+}
+
+// Test that instructions going past the end of the code are rejected.
+TEST_F(SpirvReflectorTests, TruncatedInstruction) {
+    // An OpCapability claiming three words when there is only one left.
+    EXPECT_EQ("Invalid SPIR-V instruction size",
+              GetReflectionError({spv::MagicNumber, 0x10000, 0, 1, 0,
+                                  (3u << spv::WordCountShift) | spv::OpCapability}));
+}
+
+// Test that modules without entry points are rejected.
+TEST_F(SpirvReflectorTests, NoEntryPoint) {
+    EXPECT_EQ("No entry point in the SPIR-V",
+              GetReflectionError({spv::MagicNumber, 0x10000, 0, 1, 0}));
+}
@@ -0,0 +1,250 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "dawn_native/SubresourceStorage.h"
+
+#include <vector>
+
+using namespace dawn_native;
+
+namespace {
+
+    // A reference implementation of SubresourceStorage that stores one value per subresource.
+    template <typename T>
+    class FakeStorage {
+      public:
+        FakeStorage(uint32_t arrayLayerCount, uint32_t mipLevelCount, T initialValue = {})
+            : mArrayLayerCount(arrayLayerCount),
+              mMipLevelCount(mipLevelCount),
+              mData(arrayLayerCount * mipLevelCount, initialValue) {
+        }
+
+        template <typename F>
+        void Update(const SubresourceRange& range, F&& updateFunc) {
+            for (uint32_t layer = range.baseArrayLayer;
+                 layer < range.baseArrayLayer + range.layerCount; ++layer) {
+                for (uint32_t level = range.baseMipLevel;
+                     level < range.baseMipLevel + range.levelCount; ++level) {
+                    updateFunc(SubresourceRange::SingleSubresource(level, layer),
+                               &mData[layer * mMipLevelCount + level]);
+                }
+            }
+        }
+
+        const T& Get(uint32_t mipLevel, uint32_t arrayLayer) const {
+            return mData[arrayLayer * mMipLevelCount + mipLevel];
+        }
+
+        uint32_t mArrayLayerCount;
+        uint32_t mMipLevelCount;
+        std::vector<T> mData;
+    };
+
+    // Checks that |real| and |reference| contain the same data, both through Get and Iterate, and
+    // that Iterate visits each subresource exactly once.
+    template <typename T>
+    void CheckEqual(const SubresourceStorage<T>& real, const FakeStorage<T>& reference) {
+        for (uint32_t layer = 0; layer < reference.mArrayLayerCount; ++layer) {
+            for (uint32_t level = 0; level < reference.mMipLevelCount; ++level) {
+                ASSERT_EQ(real.Get(level, layer), reference.Get(level, layer))
+                    << "for layer " << layer << " level " << level;
+            }
+        }
+
+        std::vector<uint32_t> visitCount(reference.mData.size(), 0);
+        real.Iterate([&](const SubresourceRange& range, const T& data) {
+            for (uint32_t layer = range.baseArrayLayer;
+                 layer < range.baseArrayLayer + range.layerCount; ++layer) {
+                for (uint32_t level = range.baseMipLevel;
+                     level < range.baseMipLevel + range.levelCount; ++level) {
+                    ASSERT_EQ(data, reference.Get(level, layer))
+                        << "for layer " << layer << " level " << level;
+                    visitCount[layer * reference.mMipLevelCount + level]++;
+                }
+            }
+        });
+        for (uint32_t count : visitCount) {
+            ASSERT_EQ(count, 1u);
+        }
+    }
+
+    // Applies |updateFunc| to both storages and checks they are still equal.
+    template <typename T, typename F>
+    void CallUpdateOnBoth(SubresourceStorage<T>* real,
+                          FakeStorage<T>* reference,
+                          const SubresourceRange& range,
+                          F&& updateFunc) {
+        real->Update(range, updateFunc);
+        reference->Update(range, updateFunc);
+        CheckEqual(*real, *reference);
+    }
+
+    void CheckLayerCompressed(const SubresourceStorage<int>& s,
+                              uint32_t layer,
+                              bool expectCompressed) {
+        EXPECT_EQ(s.IsLayerCompressedForTesting(layer), expectCompressed) << "for layer " << layer;
+    }
+
+}  // namespace
+
+// Test that a default storage is fully compressed and returns the initial value everywhere.
+TEST(SubresourceStorageTests, DefaultValue) {
+    SubresourceStorage<int> s(10, 5, 42);
+    FakeStorage<int> f(10, 5, 42);
+
+    EXPECT_TRUE(s.IsFullyCompressedForTesting());
+    CheckEqual(s, f);
+
+    uint32_t callCount = 0;
+    s.Iterate([&](const SubresourceRange& range, const int& data) {
+        callCount++;
+        EXPECT_EQ(range.baseMipLevel, 0u);
+        EXPECT_EQ(range.levelCount, 5u);
+        EXPECT_EQ(range.baseArrayLayer, 0u);
+        EXPECT_EQ(range.layerCount, 10u);
+        EXPECT_EQ(data, 42);
+    });
+    EXPECT_EQ(callCount, 1u);
+}
+
+// Test that updating the whole texture doesn't decompress it and calls the functor once.
+TEST(SubresourceStorageTests, FullUpdateStaysCompressed) {
+    SubresourceStorage<int> s(10, 5);
+    FakeStorage<int> f(10, 5);
+
+    uint32_t callCount = 0;
+    s.Update({0, 5, 0, 10}, [&](const SubresourceRange&, int* data) {
+        callCount++;
+        *data += 3;
+    });
+    f.Update({0, 5, 0, 10}, [](const SubresourceRange&, int* data) { *data += 3; });
+
+    CheckEqual(s, f);
+    EXPECT_EQ(callCount, 1u);
+    EXPECT_TRUE(s.IsFullyCompressedForTesting());
+}
+
+// Test that updating whole layers only decompresses the texture, not the layers.
+TEST(SubresourceStorageTests, FullLayerUpdates) {
+    SubresourceStorage<int> s(10, 5);
+    FakeStorage<int> f(10, 5);
+
+    CallUpdateOnBoth(&s, &f, {0, 5, 3, 4}, [](const SubresourceRange&, int* data) { *data = 1; });
+    EXPECT_FALSE(s.IsFullyCompressedForTesting());
+    for (uint32_t layer = 0; layer < 10; ++layer) {
+        CheckLayerCompressed(s, layer, true);
+    }
+
+    // Setting the rest of the layers to the same value recompresses the whole texture.
+    CallUpdateOnBoth(&s, &f, {0, 5, 0, 10}, [](const SubresourceRange&, int* data) { *data = 1; });
+    EXPECT_TRUE(s.IsFullyCompressedForTesting());
+}
+
+// Test that updating a single subresource decompresses only its layer, and that setting it back
+// recompresses the storage.
+TEST(SubresourceStorageTests, SingleSubresourceUpdate) {
+    SubresourceStorage<int> s(10, 5);
+    FakeStorage<int> f(10, 5);
+
+    CallUpdateOnBoth(&s, &f, SubresourceRange::SingleSubresource(2, 7),
+                     [](const SubresourceRange&, int* data) { *data = 9; });
+    EXPECT_FALSE(s.IsFullyCompressedForTesting());
+    for (uint32_t layer = 0; layer < 10; ++layer) {
+        CheckLayerCompressed(s, layer, layer != 7);
+    }
+
+    // Setting the subresource back to the layer's value recompresses the layer but not the texture
+    // because the update doesn't cover all the layers.
+    CallUpdateOnBoth(&s, &f, SubresourceRange::SingleSubresource(2, 7),
+                     [](const SubresourceRange&, int* data) { *data = 0; });
+    CheckLayerCompressed(s, 7, true);
+    EXPECT_FALSE(s.IsFullyCompressedForTesting());
+
+    // A no-op update covering all layers recompresses the texture.
+    CallUpdateOnBoth(&s, &f, {1, 2, 0, 10}, [](const SubresourceRange&, int*) {});
+    EXPECT_TRUE(s.IsFullyCompressedForTesting());
+}
+
+// Test that a layer with a single mip level is always compressed.
+TEST(SubresourceStorageTests, SingleMipLevel) {
+    SubresourceStorage<int> s(6, 1);
+    FakeStorage<int> f(6, 1);
+
+    for (uint32_t layer = 0; layer < 6; ++layer) {
+        CallUpdateOnBoth(&s, &f, SubresourceRange::SingleSubresource(0, layer),
+                         [layer](const SubresourceRange&, int* data) { *data = layer; });
+        CheckLayerCompressed(s, layer, true);
+    }
+}
+
+// Test that Iterate over a range only visits subresources of that range and coalesces compressed
+// layers.
+TEST(SubresourceStorageTests, IterateRange) {
+    SubresourceStorage<int> s(10, 5);
+    FakeStorage<int> f(10, 5);
+
+    CallUpdateOnBoth(&s, &f, SubresourceRange::SingleSubresource(3, 4),
+                     [](const SubresourceRange&, int* data) { *data = 1; });
+
+    uint32_t callCount = 0;
+    s.Iterate({1, 3, 3, 3}, [&](const SubresourceRange& range, const int& data) {
+        callCount++;
+        EXPECT_GE(range.baseArrayLayer, 3u);
+        EXPECT_LE(range.baseArrayLayer + range.layerCount, 6u);
+        EXPECT_GE(range.baseMipLevel, 1u);
+        EXPECT_LE(range.baseMipLevel + range.levelCount, 4u);
+        EXPECT_EQ(data, f.Get(range.baseMipLevel, range.baseArrayLayer));
+    });
+    // Layers 3 and 5 are compressed and visited once each, layer 4 is visited once per level.
+    EXPECT_EQ(callCount, 1u + 3u + 1u);
+}
+
+// Test a sequence of overlapping updates against the reference implementation.
+TEST(SubresourceStorageTests, RandomizedUpdates) {
+    constexpr uint32_t kLayers = 13;
+    constexpr uint32_t kLevels = 7;
+    SubresourceStorage<int> s(kLayers, kLevels);
+    FakeStorage<int> f(kLayers, kLevels);
+
+    uint32_t seed = 1;
+    auto next = [&seed](uint32_t max) {
+        seed = seed * 1103515245u + 12345u;
+        return (seed >> 16) % max;
+    };
+
+    for (uint32_t i = 0; i < 300; ++i) {
+        SubresourceRange range;
+        range.baseArrayLayer = next(kLayers);
+        range.layerCount = 1 + next(kLayers - range.baseArrayLayer);
+        range.baseMipLevel = next(kLevels);
+        range.levelCount = 1 + next(kLevels - range.baseMipLevel);
+
+        int value = static_cast<int>(next(3));
+        bool add = next(2) == 0;
+        CallUpdateOnBoth(&s, &f, range, [value, add](const SubresourceRange&, int* data) {
+            if (add) {
+                *data = (*data + value) % 3;
+            } else {
+                *data = value;
+            }
+        });
+    }
+
+    // Setting everything to a single value always recompresses.
+    CallUpdateOnBoth(&s, &f, {0, kLevels, 0, kLayers},
+                     [](const SubresourceRange&, int* data) { *data = 2; });
+    EXPECT_TRUE(s.IsFullyCompressedForTesting());
+}
@@ -0,0 +1,152 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/unittests/validation/ValidationTest.h"
+
+namespace {
+
+    // The null device completes the work of a serial on the tick after the one that submits it.
+    constexpr uint32_t kTicksToCompleteWork = 2;
+
+}  // anonymous namespace
+
+class BackgroundTickTest : public ValidationTest {
+  protected:
+    void SetUp() override {
+        ValidationTest::SetUp();
+
+        dawn_native::DeviceDescriptor descriptor;
+        descriptor.forceEnabledToggles.push_back("tick_on_background_thread");
+        tickedDevice = wgpu::Device::Acquire(adapter.CreateDevice(&descriptor));
+        queue = tickedDevice.CreateQueue();
+    }
+
+    // Writes to a buffer that isn't mappable which uses staging memory.
+    void UploadWithStagingBuffer(const wgpu::Device& targetDevice) {
+        wgpu::BufferDescriptor descriptor;
+        descriptor.size = 1024;
+        descriptor.usage = wgpu::BufferUsage::CopyDst;
+        wgpu::CreateBufferMappedResult result = targetDevice.CreateBufferMapped(&descriptor);
+        memset(result.data, 0, result.dataLength);
+        result.buffer.Unmap();
+    }
+
+    uint64_t GetUsedStagingMemory(const wgpu::Device& targetDevice) {
+        return dawn_native::GetUsedStagingMemoryForTesting(targetDevice.Get());
+    }
+
+    size_t GetDeferredCallbackCount() {
+        return dawn_native::GetDeferredCallbackCountForTesting(tickedDevice.Get());
+    }
+
+    void WaitForBackgroundTicks(uint32_t count) {
+        dawn_native::WaitForBackgroundTicksForTesting(tickedDevice.Get(), count);
+    }
+
+    wgpu::Device tickedDevice;
+    wgpu::Queue queue;
+};
+
+// Test that staging memory is only reclaimed when the device is ticked by default.
+TEST_F(BackgroundTickTest, StagingMemoryReclaimedOnTickByDefault) {
+    UploadWithStagingBuffer(device);
+    EXPECT_LT(0u, GetUsedStagingMemory(device));
+
+    // The background ticks of another device don't tick this one.
+    WaitForBackgroundTicks(kTicksToCompleteWork);
+    EXPECT_LT(0u, GetUsedStagingMemory(device));
+
+    device.Tick();
+    device.Tick();
+    EXPECT_EQ(0u, GetUsedStagingMemory(device));
+}
+
+// Test that staging memory is reclaimed without the application ticking the device.
+TEST_F(BackgroundTickTest, StagingMemoryReclaimedWithoutTick) {
+    UploadWithStagingBuffer(tickedDevice);
+    WaitForBackgroundTicks(kTicksToCompleteWork);
+    EXPECT_EQ(0u, GetUsedStagingMemory(tickedDevice));
+}
+
+// Test that map callbacks aren't called on the background thread but by ProcessEvents.
+TEST_F(BackgroundTickTest, MapCallbackDeferredUntilProcessEvents) {
+    wgpu::BufferDescriptor descriptor;
+    descriptor.size = 4;
+    descriptor.usage = wgpu::BufferUsage::MapRead;
+    wgpu::Buffer buffer = tickedDevice.CreateBuffer(&descriptor);
+
+    bool called = false;
+    buffer.MapReadAsync(
+        [](WGPUBufferMapAsyncStatus status, const void* data, uint64_t, void* userdata) {
+            EXPECT_EQ(WGPUBufferMapAsyncStatus_Success, status);
+            EXPECT_NE(nullptr, data);
+            *static_cast<bool*>(userdata) = true;
+        },
+        &called);
+
+    WaitForBackgroundTicks(kTicksToCompleteWork);
+    ASSERT_EQ(1u, GetDeferredCallbackCount());
+    EXPECT_FALSE(called);
+
+    dawn_native::ProcessEvents(tickedDevice.Get());
+    EXPECT_TRUE(called);
+    EXPECT_EQ(0u, GetDeferredCallbackCount());
+}
+
+// Test that the callbacks deferred in the background are delivered at the next API call.
+TEST_F(BackgroundTickTest, CallbacksDeliveredAtNextApiCall) {
+    wgpu::BufferDescriptor descriptor;
+    descriptor.size = 4;
+    descriptor.usage = wgpu::BufferUsage::MapWrite;
+    wgpu::Buffer buffer = tickedDevice.CreateBuffer(&descriptor);
+
+    bool called = false;
+    buffer.MapWriteAsync(
+        [](WGPUBufferMapAsyncStatus status, void*, uint64_t, void* userdata) {
+            EXPECT_EQ(WGPUBufferMapAsyncStatus_Success, status);
+            *static_cast<bool*>(userdata) = true;
+        },
+        &called);
+
+    WaitForBackgroundTicks(kTicksToCompleteWork);
+    ASSERT_EQ(1u, GetDeferredCallbackCount());
+    EXPECT_FALSE(called);
+
+    tickedDevice.CreateQueue();
+    EXPECT_TRUE(called);
+}
+
+// Test that fences complete without the application ticking the device.
+TEST_F(BackgroundTickTest, FenceCompletesWithoutTick) {
+    wgpu::FenceDescriptor fenceDescriptor;
+    wgpu::Fence fence = queue.CreateFence(&fenceDescriptor);
+    queue.Signal(fence, 1);
+
+    bool called = false;
+    fence.OnCompletion(
+        1,
+        [](WGPUFenceCompletionStatus status, void* userdata) {
+            EXPECT_EQ(WGPUFenceCompletionStatus_Success, status);
+            *static_cast<bool*>(userdata) = true;
+        },
+        &called);
+
+    WaitForBackgroundTicks(kTicksToCompleteWork);
+    EXPECT_FALSE(called);
+
+    // ProcessEvents doesn't tick the device, it only delivers the callbacks.
+    dawn_native::ProcessEvents(tickedDevice.Get());
+    EXPECT_TRUE(called);
+    EXPECT_EQ(1u, fence.GetCompletedValue());
+}
@@ -1194,6 +1194,64 @@ TEST_F(SetBindGroupPersistenceValidationTest, NotVulkanInheritance) {
     commandEncoder.Finish();
 }
 
+// Test that changing a bind group after a successful draw is validated again on the next draw, even
+// if the pipeline doesn't change.
+TEST_F(SetBindGroupPersistenceValidationTest, BindGroupChangeAfterDraw) {
+    std::vector<wgpu::BindGroupLayout> bindGroupLayoutsA;
+    wgpu::RenderPipeline pipelineA;
+    std::tie(bindGroupLayoutsA, pipelineA) = SetUpLayoutsAndPipeline({{
+        {{
+            wgpu::BindingType::UniformBuffer,
+        }},
+    }});
+
+    std::vector<wgpu::BindGroupLayout> bindGroupLayoutsB;
+    wgpu::RenderPipeline pipelineB;
+    std::tie(bindGroupLayoutsB, pipelineB) = SetUpLayoutsAndPipeline({{
+        {{
+            wgpu::BindingType::StorageBuffer,
+        }},
+    }});
+
+    wgpu::Buffer uniformBuffer = CreateBuffer(kBufferSize, wgpu::BufferUsage::Uniform);
+    wgpu::Buffer storageBuffer = CreateBuffer(kBufferSize, wgpu::BufferUsage::Storage);
+
+    wgpu::BindGroup bindGroupA =
+        utils::MakeBindGroup(device, bindGroupLayoutsA[0], {{0, uniformBuffer, 0, kBindingSize}});
+    wgpu::BindGroup bindGroupB =
+        utils::MakeBindGroup(device, bindGroupLayoutsB[0], {{0, storageBuffer, 0, kBindingSize}});
+
+    DummyRenderPass renderPass(device);
+
+    // Setting an incompatible bind group after a valid draw is an error.
+    {
+        wgpu::CommandEncoder commandEncoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder renderPassEncoder = commandEncoder.BeginRenderPass(&renderPass);
+        renderPassEncoder.SetPipeline(pipelineA);
+        renderPassEncoder.SetBindGroup(0, bindGroupA);
+        renderPassEncoder.Draw(3);
+        renderPassEncoder.SetBindGroup(0, bindGroupB);
+        renderPassEncoder.Draw(3);
+        renderPassEncoder.EndPass();
+        ASSERT_DEVICE_ERROR(commandEncoder.Finish());
+    }
+
+    // Setting a compatible bind group again makes the draw valid.
+    {
+        wgpu::CommandEncoder commandEncoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder renderPassEncoder = commandEncoder.BeginRenderPass(&renderPass);
+        renderPassEncoder.SetPipeline(pipelineA);
+        renderPassEncoder.SetBindGroup(0, bindGroupB);
+        renderPassEncoder.SetBindGroup(0, bindGroupA);
+        renderPassEncoder.Draw(3);
+        renderPassEncoder.SetPipeline(pipelineB);
+        renderPassEncoder.SetBindGroup(0, bindGroupB);
+        renderPassEncoder.Draw(3);
+        renderPassEncoder.EndPass();
+        commandEncoder.Finish();
+    }
+}
+
 class BindGroupLayoutCompatibilityTest : public ValidationTest {
   public:
     wgpu::Buffer CreateBuffer(uint64_t bufferSize, wgpu::BufferUsage usage) {
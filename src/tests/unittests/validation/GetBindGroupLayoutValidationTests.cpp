@@ -470,6 +470,66 @@ TEST_F(GetBindGroupLayoutTests, DuplicateBinding) {
     device.CreateRenderPipeline(&descriptor);
 }
 
+// Test that the default layouts of pipelines with the same vertex module depend on their fragment
+// module, including when the default layout of the vertex module with another one is memoized.
+TEST_F(GetBindGroupLayoutTests, DefaultLayoutDependsOnAllModules) {
+    wgpu::ShaderModule vsModule =
+        utils::CreateShaderModule(device, utils::SingleShaderStage::Vertex, R"(
+        #version 450
+        layout(set = 0, binding = 0) uniform UniformBuffer {
+            vec4 pos;
+        };
+
+        void main() {})");
+
+    wgpu::ShaderModule fsModuleWithBuffer =
+        utils::CreateShaderModule(device, utils::SingleShaderStage::Fragment, R"(
+        #version 450
+        layout(set = 0, binding = 1) buffer StorageBuffer {
+            vec4 pos;
+        };
+
+        void main() {})");
+
+    wgpu::ShaderModule fsModuleWithoutBuffer =
+        utils::CreateShaderModule(device, utils::SingleShaderStage::Fragment, R"(
+        #version 450
+        void main() {})");
+
+    wgpu::ShaderModule fsModuleWithConflict =
+        utils::CreateShaderModule(device, utils::SingleShaderStage::Fragment, R"(
+        #version 450
+        layout(set = 0, binding = 0) buffer StorageBuffer {
+            vec4 pos;
+        };
+
+        void main() {})");
+
+    utils::ComboRenderPipelineDescriptor descriptor(device);
+    descriptor.layout = nullptr;
+    descriptor.vertexStage.module = vsModule;
+
+    descriptor.cFragmentStage.module = fsModuleWithBuffer;
+    wgpu::RenderPipeline pipelineWithBuffer = device.CreateRenderPipeline(&descriptor);
+
+    descriptor.cFragmentStage.module = fsModuleWithoutBuffer;
+    wgpu::RenderPipeline pipelineWithoutBuffer = device.CreateRenderPipeline(&descriptor);
+
+    EXPECT_NE(pipelineWithBuffer.GetBindGroupLayout(0).Get(),
+              pipelineWithoutBuffer.GetBindGroupLayout(0).Get());
+
+    // The pipelines are different so they aren't found in the pipeline cache.
+    descriptor.cFragmentStage.module = fsModuleWithBuffer;
+    descriptor.primitiveTopology = wgpu::PrimitiveTopology::PointList;
+    wgpu::RenderPipeline otherPipelineWithBuffer = device.CreateRenderPipeline(&descriptor);
+
+    EXPECT_EQ(pipelineWithBuffer.GetBindGroupLayout(0).Get(),
+              otherPipelineWithBuffer.GetBindGroupLayout(0).Get());
+
+    descriptor.cFragmentStage.module = fsModuleWithConflict;
+    ASSERT_DEVICE_ERROR(device.CreateRenderPipeline(&descriptor));
+}
+
 // Test it is invalid to have conflicting binding types in the shaders.
 TEST_F(GetBindGroupLayoutTests, ConflictingBindingType) {
     wgpu::ShaderModule vsModule =
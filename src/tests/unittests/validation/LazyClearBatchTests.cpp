@@ -0,0 +1,126 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/unittests/validation/ValidationTest.h"
+
+#include "utils/WGPUHelpers.h"
+
+class LazyClearBatchTest : public ValidationTest {
+  protected:
+    void SetUp() override {
+        ValidationTest::SetUp();
+        mLayout = MakeLayout(device);
+    }
+
+    static wgpu::BindGroupLayout MakeLayout(const wgpu::Device& device) {
+        return utils::MakeBindGroupLayout(
+            device, {{0, wgpu::ShaderStage::Compute, wgpu::BindingType::SampledTexture}});
+    }
+
+    static wgpu::Texture CreateSampledTexture(const wgpu::Device& device,
+                                              uint32_t mipLevelCount = 1,
+                                              uint32_t arrayLayerCount = 1) {
+        wgpu::TextureDescriptor descriptor;
+        descriptor.dimension = wgpu::TextureDimension::e2D;
+        descriptor.size = {16, 16, 1};
+        descriptor.arrayLayerCount = arrayLayerCount;
+        descriptor.sampleCount = 1;
+        descriptor.format = wgpu::TextureFormat::RGBA8Unorm;
+        descriptor.mipLevelCount = mipLevelCount;
+        descriptor.usage = wgpu::TextureUsage::Sampled;
+        return device.CreateTexture(&descriptor);
+    }
+
+    // Encodes a command buffer with a compute pass that uses each of |textures| as a sampled
+    // texture.
+    static wgpu::CommandBuffer EncodeSampling(const wgpu::Device& device,
+                                              const wgpu::BindGroupLayout& layout,
+                                              const std::vector<wgpu::Texture>& textures) {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::ComputePassEncoder pass = encoder.BeginComputePass();
+        for (const wgpu::Texture& texture : textures) {
+            pass.SetBindGroup(0, utils::MakeBindGroup(device, layout, {{0, texture.CreateView()}}));
+        }
+        pass.EndPass();
+        return encoder.Finish();
+    }
+
+    static bool IsFullyInitialized(const wgpu::Texture& texture,
+                                   uint32_t mipLevelCount = 1,
+                                   uint32_t arrayLayerCount = 1) {
+        return dawn_native::IsTextureSubresourceInitialized(texture.Get(), 0, mipLevelCount, 0,
+                                                            arrayLayerCount);
+    }
+
+    wgpu::BindGroupLayout mLayout;
+};
+
+// Test that textures used in several command buffers of a submit are cleared in a single batch.
+TEST_F(LazyClearBatchTest, SingleBatchPerSubmit) {
+    wgpu::Texture textureA = CreateSampledTexture(device);
+    wgpu::Texture textureB = CreateSampledTexture(device, 3, 2);
+
+    wgpu::CommandBuffer commands[2] = {
+        EncodeSampling(device, mLayout, {textureA}),
+        EncodeSampling(device, mLayout, {textureB, textureA}),
+    };
+    device.CreateQueue().Submit(2, commands);
+
+    EXPECT_EQ(1u, dawn_native::GetLazyClearBatchCountForTesting(device.Get()));
+    EXPECT_EQ(2u, dawn_native::GetLazyClearCountForTesting(device.Get()));
+    EXPECT_TRUE(IsFullyInitialized(textureA));
+    EXPECT_TRUE(IsFullyInitialized(textureB, 3, 2));
+}
+
+// Test that initialized textures aren't cleared again and don't produce an empty batch.
+TEST_F(LazyClearBatchTest, NoBatchForInitializedTextures) {
+    wgpu::Texture texture = CreateSampledTexture(device);
+    wgpu::CommandBuffer commands = EncodeSampling(device, mLayout, {texture});
+
+    device.CreateQueue().Submit(1, &commands);
+    EXPECT_EQ(1u, dawn_native::GetLazyClearBatchCountForTesting(device.Get()));
+
+    commands = EncodeSampling(device, mLayout, {texture});
+    device.CreateQueue().Submit(1, &commands);
+    EXPECT_EQ(1u, dawn_native::GetLazyClearBatchCountForTesting(device.Get()));
+    EXPECT_EQ(1u, dawn_native::GetLazyClearCountForTesting(device.Get()));
+}
+
+// Test that textures only used as output attachments are left to the render pass load op.
+TEST_F(LazyClearBatchTest, OutputAttachmentNotBatched) {
+    DummyRenderPass renderPass(device);
+
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass);
+    pass.EndPass();
+    wgpu::CommandBuffer commands = encoder.Finish();
+    device.CreateQueue().Submit(1, &commands);
+
+    EXPECT_EQ(0u, dawn_native::GetLazyClearBatchCountForTesting(device.Get()));
+}
+
+// Test that no batch is made when lazy clears are disabled.
+TEST_F(LazyClearBatchTest, NoBatchWhenToggleDisabled) {
+    dawn_native::DeviceDescriptor descriptor;
+    descriptor.forceDisabledToggles.push_back("lazy_clear_resource_on_first_use");
+    wgpu::Device noClearDevice = wgpu::Device::Acquire(adapter.CreateDevice(&descriptor));
+
+    wgpu::Texture texture = CreateSampledTexture(noClearDevice);
+    wgpu::CommandBuffer commands =
+        EncodeSampling(noClearDevice, MakeLayout(noClearDevice), {texture});
+    noClearDevice.CreateQueue().Submit(1, &commands);
+
+    EXPECT_EQ(0u, dawn_native::GetLazyClearBatchCountForTesting(noClearDevice.Get()));
+    EXPECT_FALSE(IsFullyInitialized(texture));
+}
@@ -0,0 +1,141 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/unittests/validation/ValidationTest.h"
+
+#include "utils/WGPUHelpers.h"
+
+#include <thread>
+
+class ObjectPoolTest : public ValidationTest {
+  protected:
+    void SetUp() override {
+        ValidationTest::SetUp();
+        queue = device.CreateQueue();
+    }
+
+    dawn_native::PooledObjectCounts GetAllocationCounts() {
+        return dawn_native::GetPooledAllocationCountsForTesting(device.Get());
+    }
+
+    dawn_native::PooledObjectCounts GetLiveCounts() {
+        return dawn_native::GetPooledLiveObjectCountsForTesting(device.Get());
+    }
+
+    wgpu::Queue queue;
+};
+
+// Test that the encoders and command buffers are counted while they are alive.
+TEST_F(ObjectPoolTest, EncodersAndCommandBuffersAreCounted) {
+    dawn_native::PooledObjectCounts initialAllocations = GetAllocationCounts();
+    {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::ComputePassEncoder computePass = encoder.BeginComputePass();
+        computePass.EndPass();
+
+        DummyRenderPass renderPassDesc(device);
+        wgpu::RenderPassEncoder renderPass = encoder.BeginRenderPass(&renderPassDesc);
+        renderPass.EndPass();
+
+        wgpu::CommandBuffer commands = encoder.Finish();
+
+        dawn_native::PooledObjectCounts live = GetLiveCounts();
+        EXPECT_EQ(1u, live.commandEncoders);
+        EXPECT_EQ(1u, live.computePassEncoders);
+        EXPECT_EQ(1u, live.renderPassEncoders);
+        EXPECT_EQ(1u, live.commandBuffers);
+
+        queue.Submit(1, &commands);
+    }
+
+    dawn_native::PooledObjectCounts live = GetLiveCounts();
+    EXPECT_EQ(0u, live.commandEncoders);
+    EXPECT_EQ(0u, live.computePassEncoders);
+    EXPECT_EQ(0u, live.renderPassEncoders);
+    EXPECT_EQ(0u, live.commandBuffers);
+
+    dawn_native::PooledObjectCounts allocations = GetAllocationCounts();
+    EXPECT_EQ(initialAllocations.commandEncoders + 1, allocations.commandEncoders);
+    EXPECT_EQ(initialAllocations.computePassEncoders + 1, allocations.computePassEncoders);
+    EXPECT_EQ(initialAllocations.renderPassEncoders + 1, allocations.renderPassEncoders);
+    EXPECT_EQ(initialAllocations.commandBuffers + 1, allocations.commandBuffers);
+}
+
+// Test that texture views are counted while they are alive.
+TEST_F(ObjectPoolTest, TextureViewsAreCounted) {
+    wgpu::TextureDescriptor descriptor;
+    descriptor.size = {4, 4, 1};
+    descriptor.format = wgpu::TextureFormat::RGBA8Unorm;
+    descriptor.usage = wgpu::TextureUsage::Sampled;
+    wgpu::Texture texture = device.CreateTexture(&descriptor);
+
+    uint64_t initialLiveCount = GetLiveCounts().textureViews;
+    {
+        wgpu::TextureView view1 = texture.CreateView();
+        wgpu::TextureView view2 = texture.CreateView();
+        EXPECT_EQ(initialLiveCount + 2, GetLiveCounts().textureViews);
+    }
+    EXPECT_EQ(initialLiveCount, GetLiveCounts().textureViews);
+}
+
+// Test that bind groups are counted while they are alive.
+TEST_F(ObjectPoolTest, BindGroupsAreCounted) {
+    wgpu::BindGroupLayout layout = utils::MakeBindGroupLayout(
+        device, {{0, wgpu::ShaderStage::Fragment, wgpu::BindingType::Sampler}});
+    wgpu::SamplerDescriptor samplerDesc = utils::GetDefaultSamplerDescriptor();
+    wgpu::Sampler sampler = device.CreateSampler(&samplerDesc);
+
+    uint64_t initialLiveCount = GetLiveCounts().bindGroups;
+    {
+        wgpu::BindGroup bindGroup = utils::MakeBindGroup(device, layout, {{0, sampler}});
+        EXPECT_EQ(initialLiveCount + 1, GetLiveCounts().bindGroups);
+    }
+    EXPECT_EQ(initialLiveCount, GetLiveCounts().bindGroups);
+}
+
+// Test that the memory of released objects is reused for the next objects of the same type.
+TEST_F(ObjectPoolTest, ReleasedObjectsAreReused) {
+    WGPUCommandEncoder released = device.CreateCommandEncoder().Get();
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    EXPECT_EQ(released, encoder.Get());
+}
+
+// Test that error pass encoders are allocated from the pools too.
+TEST_F(ObjectPoolTest, ErrorPassEncodersArePooled) {
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    {
+        wgpu::RenderPassDescriptor renderPassDesc = {};
+        wgpu::RenderPassEncoder renderPass = encoder.BeginRenderPass(&renderPassDesc);
+        EXPECT_EQ(1u, GetLiveCounts().renderPassEncoders);
+    }
+    EXPECT_EQ(0u, GetLiveCounts().renderPassEncoders);
+    ASSERT_DEVICE_ERROR(encoder.Finish());
+}
+
+// Test that pooled objects may be released on another thread than the one that created them.
+TEST_F(ObjectPoolTest, ReleaseOnOtherThread) {
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::CommandBuffer commands = encoder.Finish();
+    EXPECT_EQ(1u, GetLiveCounts().commandBuffers);
+
+    std::thread thread([&]() {
+        encoder = nullptr;
+        commands = nullptr;
+    });
+    thread.join();
+
+    dawn_native::PooledObjectCounts live = GetLiveCounts();
+    EXPECT_EQ(0u, live.commandEncoders);
+    EXPECT_EQ(0u, live.commandBuffers);
+}
@@ -0,0 +1,373 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/unittests/validation/ValidationTest.h"
+
+#include "dawn_native/Commands.h"
+#include "dawn_native/null/DeviceNull.h"
+#include "utils/ComboRenderPipelineDescriptor.h"
+#include "utils/WGPUHelpers.h"
+
+#include <sstream>
+
+namespace {
+
+    // The objects used by the test, created on a given device.
+    struct TestObjects {
+        wgpu::RenderPipeline pipelineA;
+        wgpu::RenderPipeline pipelineB;
+        wgpu::BindGroup bindGroup;
+        wgpu::Buffer vertexBuffer;
+        wgpu::Buffer indexBuffer;
+
+        // Returns a name for a dawn_native object that is the same across devices.
+        std::string NameOf(const void* object) const {
+            if (object == pipelineA.Get()) {
+                return "pipelineA";
+            }
+            if (object == pipelineB.Get()) {
+                return "pipelineB";
+            }
+            if (object == bindGroup.Get()) {
+                return "bindGroup";
+            }
+            if (object == vertexBuffer.Get()) {
+                return "vertexBuffer";
+            }
+            if (object == indexBuffer.Get()) {
+                return "indexBuffer";
+            }
+            return object == nullptr ? "null" : "unknown";
+        }
+    };
+
+    // The state a backend sees when replaying the commands of a render pass.
+    struct ReplayedState {
+        const void* pipeline = nullptr;
+        const void* bindGroups[kMaxBindGroups] = {};
+        std::vector<uint32_t> dynamicOffsets[kMaxBindGroups];
+        const void* vertexBuffers[kMaxVertexBuffers] = {};
+        uint64_t vertexBufferOffsets[kMaxVertexBuffers] = {};
+        const void* indexBuffer = nullptr;
+        uint64_t indexBufferOffset = 0;
+        std::string fixedFunctionState[4];
+
+        std::string Describe(const TestObjects& objects) const {
+            std::ostringstream stream;
+            stream << objects.NameOf(pipeline);
+            for (uint32_t i = 0; i < kMaxBindGroups; ++i) {
+                stream << " group" << i << "=" << objects.NameOf(bindGroups[i]);
+                for (uint32_t offset : dynamicOffsets[i]) {
+                    stream << "+" << offset;
+                }
+            }
+            for (uint32_t i = 0; i < kMaxVertexBuffers; ++i) {
+                if (vertexBuffers[i] != nullptr) {
+                    stream << " vertex" << i << "=" << objects.NameOf(vertexBuffers[i]) << "+"
+                           << vertexBufferOffsets[i];
+                }
+            }
+            stream << " index=" << objects.NameOf(indexBuffer) << "+" << indexBufferOffset;
+            for (const std::string& state : fixedFunctionState) {
+                stream << " " << state;
+            }
+            return stream.str();
+        }
+    };
+
+    // Replays the commands of |commandBuffer| like a backend would and returns a description of
+    // the state at each draw.
+    std::vector<std::string> ReplayDraws(const wgpu::CommandBuffer& commandBuffer,
+                                         const TestObjects& objects) {
+        using namespace dawn_native;
+
+        CommandIterator* commands =
+            reinterpret_cast<null::CommandBuffer*>(commandBuffer.Get())->GetCommandsForTesting();
+        commands->Reset();
+
+        std::vector<std::string> draws;
+        ReplayedState state;
+
+        Command type;
+        while (commands->NextCommandId(&type)) {
+            switch (type) {
+                case Command::SetRenderPipeline: {
+                    SetRenderPipelineCmd* cmd = commands->NextCommand<SetRenderPipelineCmd>();
+                    state.pipeline = cmd->pipeline.Get();
+                    break;
+                }
+
+                case Command::SetBindGroup: {
+                    SetBindGroupCmd* cmd = commands->NextCommand<SetBindGroupCmd>();
+                    state.bindGroups[cmd->index] = cmd->group.Get();
+                    state.dynamicOffsets[cmd->index].clear();
+                    if (cmd->dynamicOffsetCount > 0) {
+                        uint32_t* offsets = commands->NextData<uint32_t>(cmd->dynamicOffsetCount);
+                        state.dynamicOffsets[cmd->index].assign(
+                            offsets, offsets + cmd->dynamicOffsetCount);
+                    }
+                    break;
+                }
+
+                case Command::SetVertexBuffer: {
+                    SetVertexBufferCmd* cmd = commands->NextCommand<SetVertexBufferCmd>();
+                    state.vertexBuffers[cmd->slot] = cmd->buffer.Get();
+                    state.vertexBufferOffsets[cmd->slot] = cmd->offset;
+                    break;
+                }
+
+                case Command::SetIndexBuffer: {
+                    SetIndexBufferCmd* cmd = commands->NextCommand<SetIndexBufferCmd>();
+                    state.indexBuffer = cmd->buffer.Get();
+                    state.indexBufferOffset = cmd->offset;
+                    break;
+                }
+
+                case Command::SetStencilReference: {
+                    SetStencilReferenceCmd* cmd = commands->NextCommand<SetStencilReferenceCmd>();
+                    state.fixedFunctionState[0] = "stencil=" + std::to_string(cmd->reference);
+                    break;
+                }
+
+                case Command::SetBlendColor: {
+                    SetBlendColorCmd* cmd = commands->NextCommand<SetBlendColorCmd>();
+                    std::ostringstream stream;
+                    stream << "blend=" << cmd->color.r << "," << cmd->color.g << ","
+                           << cmd->color.b << "," << cmd->color.a;
+                    state.fixedFunctionState[1] = stream.str();
+                    break;
+                }
+
+                case Command::SetViewport: {
+                    SetViewportCmd* cmd = commands->NextCommand<SetViewportCmd>();
+                    std::ostringstream stream;
+                    stream << "viewport=" << cmd->x << "," << cmd->y << "," << cmd->width << ","
+                           << cmd->height << "," << cmd->minDepth << "," << cmd->maxDepth;
+                    state.fixedFunctionState[2] = stream.str();
+                    break;
+                }
+
+                case Command::SetScissorRect: {
+                    SetScissorRectCmd* cmd = commands->NextCommand<SetScissorRectCmd>();
+                    std::ostringstream stream;
+                    stream << "scissor=" << cmd->x << "," << cmd->y << "," << cmd->width << ","
+                           << cmd->height;
+                    state.fixedFunctionState[3] = stream.str();
+                    break;
+                }
+
+                case Command::ExecuteBundles: {
+                    ExecuteBundlesCmd* cmd = commands->NextCommand<ExecuteBundlesCmd>();
+                    commands->NextData<Ref<RenderBundleBase>>(cmd->count);
+                    state = ReplayedState();
+                    break;
+                }
+
+                case Command::Draw: {
+                    commands->NextCommand<DrawCmd>();
+                    draws.push_back(state.Describe(objects));
+                    break;
+                }
+
+                default:
+                    SkipCommand(commands, type);
+                    break;
+            }
+        }
+        commands->Reset();
+
+        return draws;
+    }
+
+}  // anonymous namespace
+
+class RedundantCommandElisionTest : public ValidationTest {
+  protected:
+    void SetUp() override {
+        ValidationTest::SetUp();
+
+        dawn_native::DeviceDescriptor descriptor;
+        descriptor.forceEnabledToggles.push_back("elide_redundant_commands");
+        mElidingDevice = wgpu::Device::Acquire(adapter.CreateDevice(&descriptor));
+    }
+
+    TestObjects CreateObjects(const wgpu::Device& device) {
+        TestObjects objects;
+
+        wgpu::BindGroupLayout bgl = utils::MakeBindGroupLayout(
+            device, {{0, wgpu::ShaderStage::Fragment, wgpu::BindingType::UniformBuffer, true}});
+
+        wgpu::ShaderModule vsModule =
+            utils::CreateShaderModule(device, utils::SingleShaderStage::Vertex, R"(
+                #version 450
+                layout(location = 0) in vec4 pos;
+                void main() {
+                    gl_Position = pos;
+                })");
+        wgpu::ShaderModule fsModule =
+            utils::CreateShaderModule(device, utils::SingleShaderStage::Fragment, R"(
+                #version 450
+                layout(set = 0, binding = 0) uniform Uniforms {
+                    vec4 color;
+                };
+                layout(location = 0) out vec4 fragColor;
+                void main() {
+                    fragColor = color;
+                })");
+
+        utils::ComboRenderPipelineDescriptor descriptor(device);
+        descriptor.layout = utils::MakeBasicPipelineLayout(device, &bgl);
+        descriptor.vertexStage.module = vsModule;
+        descriptor.cFragmentStage.module = fsModule;
+        descriptor.cVertexState.vertexBufferCount = 1;
+        descriptor.cVertexState.cVertexBuffers[0].arrayStride = 4 * sizeof(float);
+        descriptor.cVertexState.cVertexBuffers[0].attributeCount = 1;
+        descriptor.cVertexState.cAttributes[0].format = wgpu::VertexFormat::Float4;
+        objects.pipelineA = device.CreateRenderPipeline(&descriptor);
+
+        descriptor.primitiveTopology = wgpu::PrimitiveTopology::LineList;
+        objects.pipelineB = device.CreateRenderPipeline(&descriptor);
+
+        wgpu::BufferDescriptor bufferDesc;
+        bufferDesc.size = 512;
+        bufferDesc.usage = wgpu::BufferUsage::Uniform;
+        wgpu::Buffer uniformBuffer = device.CreateBuffer(&bufferDesc);
+        objects.bindGroup = utils::MakeBindGroup(device, bgl, {{0, uniformBuffer, 0, 16}});
+
+        bufferDesc.size = 64;
+        bufferDesc.usage = wgpu::BufferUsage::Vertex;
+        objects.vertexBuffer = device.CreateBuffer(&bufferDesc);
+
+        bufferDesc.usage = wgpu::BufferUsage::Index;
+        objects.indexBuffer = device.CreateBuffer(&bufferDesc);
+
+        return objects;
+    }
+
+    // Encodes a render pass with redundant commands and returns the number of redundant ones.
+    size_t EncodeRenderPass(wgpu::RenderPassEncoder pass, const TestObjects& objects) {
+        constexpr uint32_t kOffset0 = 0;
+        constexpr uint32_t kOffset256 = 256;
+        const wgpu::Color kBlendColor = {0.0, 0.25, 0.5, 1.0};
+
+        pass.SetPipeline(objects.pipelineA);
+        pass.SetPipeline(objects.pipelineA);
+        pass.SetBindGroup(0, objects.bindGroup, 1, &kOffset0);
+        pass.SetBindGroup(0, objects.bindGroup, 1, &kOffset0);
+        pass.SetVertexBuffer(0, objects.vertexBuffer, 0);
+        pass.SetVertexBuffer(0, objects.vertexBuffer, 0);
+        pass.SetIndexBuffer(objects.indexBuffer, 0);
+        pass.SetIndexBuffer(objects.indexBuffer, 0);
+        pass.SetScissorRect(0, 0, 1, 1);
+        pass.SetScissorRect(0, 0, 1, 1);
+        pass.SetViewport(0, 0, 1, 1, 0, 1);
+        pass.SetViewport(0, 0, 1, 1, 0, 1);
+        pass.SetBlendColor(&kBlendColor);
+        pass.SetBlendColor(&kBlendColor);
+        pass.SetStencilReference(1);
+        pass.SetStencilReference(1);
+        pass.Draw(3);
+
+        // Changing values are never elided.
+        pass.SetBindGroup(0, objects.bindGroup, 1, &kOffset256);
+        pass.SetVertexBuffer(0, objects.vertexBuffer, 16);
+        pass.SetScissorRect(0, 0, 2, 2);
+        pass.Draw(3);
+
+        // Bind groups and vertex buffers persist across pipeline changes.
+        pass.SetPipeline(objects.pipelineB);
+        pass.SetBindGroup(0, objects.bindGroup, 1, &kOffset256);
+        pass.SetVertexBuffer(0, objects.vertexBuffer, 16);
+        pass.Draw(3);
+
+        // Executing render bundles resets the state so nothing after it is redundant.
+        pass.ExecuteBundles(0, nullptr);
+        pass.SetPipeline(objects.pipelineB);
+        pass.SetBindGroup(0, objects.bindGroup, 1, &kOffset256);
+        pass.SetVertexBuffer(0, objects.vertexBuffer, 16);
+        pass.Draw(3);
+
+        pass.EndPass();
+
+        return 10;
+    }
+
+    wgpu::Device mElidingDevice;
+};
+
+// Test that redundant commands are dropped and that backends see the same state at each draw as
+// without elision.
+TEST_F(RedundantCommandElisionTest, RenderPassStateIsIdentical) {
+    std::vector<std::string> expectedDraws;
+    {
+        TestObjects objects = CreateObjects(device);
+        DummyRenderPass renderPass(device);
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        EncodeRenderPass(encoder.BeginRenderPass(&renderPass), objects);
+        expectedDraws = ReplayDraws(encoder.Finish(), objects);
+        EXPECT_EQ(0u, dawn_native::GetElidedCommandCountForTesting(device.Get()));
+    }
+
+    TestObjects objects = CreateObjects(mElidingDevice);
+    DummyRenderPass renderPass(mElidingDevice);
+    wgpu::CommandEncoder encoder = mElidingDevice.CreateCommandEncoder();
+    size_t redundantCount = EncodeRenderPass(encoder.BeginRenderPass(&renderPass), objects);
+    std::vector<std::string> draws = ReplayDraws(encoder.Finish(), objects);
+
+    EXPECT_EQ(redundantCount, dawn_native::GetElidedCommandCountForTesting(mElidingDevice.Get()));
+    ASSERT_EQ(expectedDraws.size(), 4u);
+    EXPECT_EQ(expectedDraws, draws);
+}
+
+// Test that each pass starts with no state so that its first commands are never elided.
+TEST_F(RedundantCommandElisionTest, StateIsPerPass) {
+    TestObjects objects = CreateObjects(mElidingDevice);
+    DummyRenderPass renderPass(mElidingDevice);
+    wgpu::CommandEncoder encoder = mElidingDevice.CreateCommandEncoder();
+    for (uint32_t i = 0; i < 2; ++i) {
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass);
+        pass.SetPipeline(objects.pipelineA);
+        pass.SetVertexBuffer(0, objects.vertexBuffer, 0);
+        pass.EndPass();
+    }
+    encoder.Finish();
+
+    EXPECT_EQ(0u, dawn_native::GetElidedCommandCountForTesting(mElidingDevice.Get()));
+}
+
+// Test that redundant compute pass commands are dropped too.
+TEST_F(RedundantCommandElisionTest, ComputePass) {
+    wgpu::ShaderModule csModule =
+        utils::CreateShaderModule(mElidingDevice, utils::SingleShaderStage::Compute, R"(
+            #version 450
+            void main() {
+            })");
+
+    wgpu::ComputePipelineDescriptor descriptor;
+    descriptor.layout = utils::MakeBasicPipelineLayout(mElidingDevice, nullptr);
+    descriptor.computeStage.module = csModule;
+    descriptor.computeStage.entryPoint = "main";
+    wgpu::ComputePipeline pipeline = mElidingDevice.CreateComputePipeline(&descriptor);
+
+    wgpu::CommandEncoder encoder = mElidingDevice.CreateCommandEncoder();
+    wgpu::ComputePassEncoder pass = encoder.BeginComputePass();
+    pass.SetPipeline(pipeline);
+    pass.Dispatch(1);
+    pass.SetPipeline(pipeline);
+    pass.Dispatch(1);
+    pass.EndPass();
+    encoder.Finish();
+
+    EXPECT_EQ(1u, dawn_native::GetElidedCommandCountForTesting(mElidingDevice.Get()));
+}
@@ -0,0 +1,112 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/unittests/validation/ValidationTest.h"
+
+#include "utils/WGPUHelpers.h"
+
+class ReusableCommandBufferTest : public ValidationTest {
+  protected:
+    void SetUp() override {
+        ValidationTest::SetUp();
+        queue = device.CreateQueue();
+    }
+
+    wgpu::Buffer CreateBuffer(wgpu::BufferUsage usage) {
+        wgpu::BufferDescriptor descriptor;
+        descriptor.size = 4;
+        descriptor.usage = usage;
+        return device.CreateBuffer(&descriptor);
+    }
+
+    wgpu::CommandBuffer EncodeCopy(const wgpu::Buffer& source,
+                                   const wgpu::Buffer& destination,
+                                   bool reusable) {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        encoder.CopyBufferToBuffer(source, 0, destination, 0, 4);
+
+        wgpu::CommandBufferDescriptor descriptor;
+        descriptor.reusable = reusable;
+        return encoder.Finish(&descriptor);
+    }
+
+    wgpu::CommandBuffer EncodeRenderPass(const utils::BasicRenderPass& renderPass,
+                                         bool reusable) {
+        utils::ComboRenderPassDescriptor descriptor({renderPass.color.CreateView()});
+        descriptor.cColorAttachments[0].loadOp = wgpu::LoadOp::Load;
+
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&descriptor);
+        pass.EndPass();
+
+        wgpu::CommandBufferDescriptor commandBufferDescriptor;
+        commandBufferDescriptor.reusable = reusable;
+        return encoder.Finish(&commandBufferDescriptor);
+    }
+
+    wgpu::Queue queue;
+};
+
+// Test that a reusable command buffer can be submitted many times, alone or with others.
+TEST_F(ReusableCommandBufferTest, SubmitManyTimes) {
+    wgpu::Buffer source = CreateBuffer(wgpu::BufferUsage::CopySrc);
+    wgpu::Buffer destination = CreateBuffer(wgpu::BufferUsage::CopyDst);
+    wgpu::CommandBuffer commands = EncodeCopy(source, destination, true);
+
+    queue.Submit(1, &commands);
+    queue.Submit(1, &commands);
+
+    wgpu::CommandBuffer twice[2] = {commands, commands};
+    queue.Submit(2, twice);
+}
+
+// Test that the per-submit validation is still done when a reusable command buffer is submitted
+// again.
+TEST_F(ReusableCommandBufferTest, ResubmitIsValidatedAgain) {
+    wgpu::Buffer source = CreateBuffer(wgpu::BufferUsage::CopySrc);
+    wgpu::Buffer destination = CreateBuffer(wgpu::BufferUsage::CopyDst);
+    wgpu::CommandBuffer commands = EncodeCopy(source, destination, true);
+
+    queue.Submit(1, &commands);
+
+    destination.Destroy();
+    ASSERT_DEVICE_ERROR(queue.Submit(1, &commands));
+}
+
+// Test that output attachments of reusable command buffers are cleared before the submit so that
+// their load op doesn't need to be changed, and that they are only cleared once.
+TEST_F(ReusableCommandBufferTest, OutputAttachmentsClearedAtSubmit) {
+    utils::BasicRenderPass renderPass = utils::CreateBasicRenderPass(device, 1, 1);
+    wgpu::CommandBuffer commands = EncodeRenderPass(renderPass, true);
+
+    queue.Submit(1, &commands);
+    EXPECT_EQ(1u, dawn_native::GetLazyClearBatchCountForTesting(device.Get()));
+    EXPECT_EQ(1u, dawn_native::GetLazyClearCountForTesting(device.Get()));
+    EXPECT_TRUE(
+        dawn_native::IsTextureSubresourceInitialized(renderPass.color.Get(), 0, 1, 0, 1));
+
+    queue.Submit(1, &commands);
+    EXPECT_EQ(1u, dawn_native::GetLazyClearBatchCountForTesting(device.Get()));
+    EXPECT_EQ(1u, dawn_native::GetLazyClearCountForTesting(device.Get()));
+}
+
+// Test that output attachments of command buffers that aren't reusable are left to the render
+// pass load op.
+TEST_F(ReusableCommandBufferTest, OutputAttachmentsNotClearedWhenNotReusable) {
+    utils::BasicRenderPass renderPass = utils::CreateBasicRenderPass(device, 1, 1);
+    wgpu::CommandBuffer commands = EncodeRenderPass(renderPass, false);
+
+    queue.Submit(1, &commands);
+    EXPECT_EQ(0u, dawn_native::GetLazyClearBatchCountForTesting(device.Get()));
+}
@@ -19,6 +19,8 @@
 #include "utils/WGPUHelpers.h"
 
 #include <sstream>
+#include <string>
+#include <vector>
 
 class ShaderModuleValidationTest : public ValidationTest {
 };
@@ -108,3 +110,254 @@ TEST_F(ShaderModuleValidationTest, FragmentOutputLocationExceedsMaxColorAttachme
     ASSERT_DEVICE_ERROR(utils::CreateShaderModule(device, utils::SingleShaderStage::Fragment,
                                                   stream.str().c_str()));
 }
+
+// Test that creating a module with the same code as an alive module returns the same module.
+TEST_F(ShaderModuleValidationTest, SameCodeReturnsCachedModule) {
+    const char* source = R"(#version 450
+              void main() {
+              })";
+
+    wgpu::ShaderModule module1 =
+        utils::CreateShaderModule(device, utils::SingleShaderStage::Compute, source);
+    wgpu::ShaderModule module2 =
+        utils::CreateShaderModule(device, utils::SingleShaderStage::Compute, source);
+    EXPECT_EQ(module1.Get(), module2.Get());
+}
+
+// Test that modules can be created again after being released without validating their SPIR-V
+// again, and that only the code of valid modules is remembered as valid.
+TEST_F(ShaderModuleValidationTest, CreateAgainAfterRelease) {
+    const char* validSource = R"(#version 450
+              void main() {
+              })";
+    size_t validationCount = dawn_native::GetSpirvValidationCountForTesting(device.Get());
+    utils::CreateShaderModule(device, utils::SingleShaderStage::Compute, validSource);
+    EXPECT_EQ(validationCount + 1, dawn_native::GetSpirvValidationCountForTesting(device.Get()));
+    utils::CreateShaderModule(device, utils::SingleShaderStage::Compute, validSource);
+    EXPECT_EQ(validationCount + 1, dawn_native::GetSpirvValidationCountForTesting(device.Get()));
+
+    std::ostringstream invalidSource;
+    invalidSource << R"(#version 450
+              layout(location = )"
+                  << kMaxColorAttachments << R"() out vec4 fragColor;
+              void main() {
+                  fragColor = vec4(0.0, 1.0, 0.0, 1.0);
+              })";
+    // The SPIR-V of this module is valid but the module is rejected after reflection, so its
+    // code is validated again every time.
+    ASSERT_DEVICE_ERROR(utils::CreateShaderModule(device, utils::SingleShaderStage::Fragment,
+                                                  invalidSource.str().c_str()));
+    EXPECT_EQ(validationCount + 2, dawn_native::GetSpirvValidationCountForTesting(device.Get()));
+    ASSERT_DEVICE_ERROR(utils::CreateShaderModule(device, utils::SingleShaderStage::Fragment,
+                                                  invalidSource.str().c_str()));
+    EXPECT_EQ(validationCount + 3, dawn_native::GetSpirvValidationCountForTesting(device.Get()));
+}
+
+class ShaderModuleBatchCreationTest : public ValidationTest {
+  protected:
+    std::vector<wgpu::ShaderModule> CreateShaderModules(
+        const std::vector<wgpu::ShaderModuleDescriptor>& descriptors) {
+        return CreateShaderModules(device, descriptors);
+    }
+
+    std::vector<wgpu::ShaderModule> CreateShaderModules(
+        const wgpu::Device& targetDevice,
+        const std::vector<wgpu::ShaderModuleDescriptor>& descriptors) {
+        std::vector<WGPUShaderModule> cModules = dawn_native::CreateShaderModules(
+            targetDevice.Get(), static_cast<uint32_t>(descriptors.size()),
+            reinterpret_cast<const WGPUShaderModuleDescriptor*>(descriptors.data()));
+
+        std::vector<wgpu::ShaderModule> modules;
+        for (WGPUShaderModule cModule : cModules) {
+            modules.push_back(wgpu::ShaderModule::Acquire(cModule));
+        }
+        return modules;
+    }
+
+    wgpu::ShaderModuleDescriptor MakeDescriptor(const std::vector<uint32_t>& code) {
+        wgpu::ShaderModuleDescriptor descriptor;
+        descriptor.code = code.data();
+        descriptor.codeSize = static_cast<uint32_t>(code.size());
+        return descriptor;
+    }
+
+    std::string PopErrorScopeMessage() {
+        std::string message;
+        device.PopErrorScope(
+            [](WGPUErrorType type, const char* message, void* userdata) {
+                EXPECT_EQ(WGPUErrorType_Validation, type);
+                *static_cast<std::string*>(userdata) = message;
+            },
+            &message);
+        return message;
+    }
+};
+
+// Test that the modules are returned in the order of the descriptors and are shared with the
+// modules created one by one.
+TEST_F(ShaderModuleBatchCreationTest, ModulesInOrder) {
+    std::vector<uint32_t> code1 = utils::CompileGLSLToSpirv(utils::SingleShaderStage::Compute, R"(
+        #version 450
+        void main() {
+        })");
+    std::vector<uint32_t> code2 = utils::CompileGLSLToSpirv(utils::SingleShaderStage::Fragment, R"(
+        #version 450
+        layout(location = 0) out vec4 fragColor;
+        void main() {
+            fragColor = vec4(0.0);
+        })");
+
+    wgpu::ShaderModuleDescriptor descriptor1 = MakeDescriptor(code1);
+    wgpu::ShaderModuleDescriptor descriptor2 = MakeDescriptor(code2);
+    wgpu::ShaderModule existingModule2 = device.CreateShaderModule(&descriptor2);
+
+    std::vector<wgpu::ShaderModule> modules =
+        CreateShaderModules({descriptor1, descriptor2, descriptor1});
+    ASSERT_EQ(3u, modules.size());
+    EXPECT_EQ(modules[0].Get(), modules[2].Get());
+    EXPECT_EQ(existingModule2.Get(), modules[1].Get());
+    EXPECT_NE(modules[0].Get(), modules[1].Get());
+
+    wgpu::ShaderModule module1 = device.CreateShaderModule(&descriptor1);
+    EXPECT_EQ(modules[0].Get(), module1.Get());
+}
+
+// Test that errors are reported in the order of the descriptors, whatever stage of the creation
+// produces them.
+TEST_F(ShaderModuleBatchCreationTest, ErrorsInOrder) {
+    std::vector<uint32_t> validCode =
+        utils::CompileGLSLToSpirv(utils::SingleShaderStage::Compute, R"(
+        #version 450
+        void main() {
+        })");
+    std::vector<uint32_t> invalidCode = {0xDEADBEEF};
+
+    wgpu::ShaderModuleDescriptor validDescriptor = MakeDescriptor(validCode);
+    wgpu::ShaderModuleDescriptor invalidSpirvDescriptor = MakeDescriptor(invalidCode);
+    wgpu::ChainedStruct chain;
+    wgpu::ShaderModuleDescriptor invalidChainDescriptor = MakeDescriptor(validCode);
+    invalidChainDescriptor.nextInChain = &chain;
+
+    // Error scopes keep the first error.
+    device.PushErrorScope(wgpu::ErrorFilter::Validation);
+    std::vector<wgpu::ShaderModule> modules = CreateShaderModules(
+        {validDescriptor, invalidSpirvDescriptor, invalidChainDescriptor, invalidSpirvDescriptor});
+    EXPECT_NE(std::string::npos, PopErrorScopeMessage().find("SPIRV Validation failure"));
+    ASSERT_EQ(4u, modules.size());
+
+    device.PushErrorScope(wgpu::ErrorFilter::Validation);
+    modules = CreateShaderModules({invalidChainDescriptor, invalidSpirvDescriptor});
+    EXPECT_NE(std::string::npos, PopErrorScopeMessage().find("nextInChain"));
+
+    // Each descriptor with invalid code gets its own error.
+    uint32_t errorCount = 0;
+    device.SetUncapturedErrorCallback(
+        [](WGPUErrorType, const char*, void* userdata) { ++*static_cast<uint32_t*>(userdata); },
+        &errorCount);
+    CreateShaderModules({invalidSpirvDescriptor, validDescriptor, invalidSpirvDescriptor});
+    EXPECT_EQ(2u, errorCount);
+}
+
+// Test that the modules created on worker threads are referenced and released on the calling
+// thread of devices using non-atomic refcounts.
+TEST_F(ShaderModuleBatchCreationTest, NonAtomicRefcounts) {
+    dawn_native::DeviceDescriptor deviceDescriptor;
+    deviceDescriptor.forceEnabledToggles.push_back("use_non_atomic_refcounts");
+    wgpu::Device nonAtomicDevice = wgpu::Device::Acquire(adapter.CreateDevice(&deviceDescriptor));
+
+    std::vector<std::vector<uint32_t>> codes;
+    for (uint32_t i = 0; i < 8; ++i) {
+        std::string source = R"(
+            #version 450
+            layout(std430, set = 0, binding = 0) buffer Data { uint value; } data;
+            void main() {
+                data.value = )" + std::to_string(i) +
+                             R"(u;
+            })";
+        codes.push_back(
+            utils::CompileGLSLToSpirv(utils::SingleShaderStage::Compute, source.c_str()));
+    }
+
+    std::vector<wgpu::ShaderModuleDescriptor> descriptors;
+    for (const std::vector<uint32_t>& code : codes) {
+        descriptors.push_back(MakeDescriptor(code));
+    }
+    descriptors.push_back(descriptors[0]);
+
+    std::vector<wgpu::ShaderModule> modules = CreateShaderModules(nonAtomicDevice, descriptors);
+    ASSERT_EQ(descriptors.size(), modules.size());
+    EXPECT_EQ(modules[0].Get(), modules.back().Get());
+
+    // Finding the modules in the cache and using them in pipelines references them.
+    for (size_t i = 0; i < codes.size(); ++i) {
+        wgpu::ShaderModule module = nonAtomicDevice.CreateShaderModule(&descriptors[i]);
+        EXPECT_EQ(modules[i].Get(), module.Get());
+
+        wgpu::ComputePipelineDescriptor pipelineDescriptor;
+        pipelineDescriptor.computeStage.module = module;
+        pipelineDescriptor.computeStage.entryPoint = "main";
+        nonAtomicDevice.CreateComputePipeline(&pipelineDescriptor);
+    }
+
+    // The last references are released on this thread.
+    modules.clear();
+}
+
+class ShaderModuleLayoutCompatibilityTest : public ValidationTest {
+  protected:
+    wgpu::ComputePipeline CreatePipeline(const wgpu::ShaderModule& module,
+                                         std::vector<wgpu::BindGroupLayout> bindGroupLayouts) {
+        wgpu::PipelineLayoutDescriptor pipelineLayoutDesc;
+        pipelineLayoutDesc.bindGroupLayoutCount = static_cast<uint32_t>(bindGroupLayouts.size());
+        pipelineLayoutDesc.bindGroupLayouts = bindGroupLayouts.data();
+
+        wgpu::ComputePipelineDescriptor descriptor;
+        descriptor.layout = device.CreatePipelineLayout(&pipelineLayoutDesc);
+        descriptor.computeStage.module = module;
+        descriptor.computeStage.entryPoint = "main";
+        return device.CreateComputePipeline(&descriptor);
+    }
+
+    wgpu::BindGroupLayout MakeLayout(wgpu::BindingType type) {
+        return utils::MakeBindGroupLayout(device, {{0, wgpu::ShaderStage::Compute, type}});
+    }
+};
+
+// Test that the compatibility of a module with a layout isn't reused for another layout
+// allocated after the first one is released.
+TEST_F(ShaderModuleLayoutCompatibilityTest, ReleasedLayouts) {
+    wgpu::ShaderModule module = utils::CreateShaderModule(device, utils::SingleShaderStage::Compute,
+                                                          R"(#version 450
+              layout(set = 0, binding = 0) uniform Uniforms {
+                  vec4 value;
+              } uniforms;
+              void main() {
+              })");
+
+    for (uint32_t i = 0; i < 10; ++i) {
+        CreatePipeline(module, {MakeLayout(wgpu::BindingType::UniformBuffer)});
+        ASSERT_DEVICE_ERROR(CreatePipeline(module, {MakeLayout(wgpu::BindingType::Sampler)}));
+    }
+}
+
+// Test that the compatibility of a module with a layout used for one group isn't reused when the
+// layout is used for another group.
+TEST_F(ShaderModuleLayoutCompatibilityTest, SameLayoutInDifferentGroups) {
+    wgpu::ShaderModule module = utils::CreateShaderModule(device, utils::SingleShaderStage::Compute,
+                                                          R"(#version 450
+              layout(set = 0, binding = 0) uniform Uniforms {
+                  vec4 value;
+              } uniforms;
+              layout(set = 1, binding = 0) uniform sampler samp;
+              void main() {
+              })");
+
+    wgpu::BindGroupLayout uniformLayout = MakeLayout(wgpu::BindingType::UniformBuffer);
+    wgpu::BindGroupLayout samplerLayout = MakeLayout(wgpu::BindingType::Sampler);
+
+    CreatePipeline(module, {uniformLayout, samplerLayout});
+    ASSERT_DEVICE_ERROR(CreatePipeline(module, {uniformLayout, uniformLayout}));
+    ASSERT_DEVICE_ERROR(CreatePipeline(module, {samplerLayout, samplerLayout}));
+    ASSERT_DEVICE_ERROR(CreatePipeline(module, {uniformLayout}));
+    CreatePipeline(module, {uniformLayout, samplerLayout});
+}
@@ -0,0 +1,226 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/unittests/validation/ValidationTest.h"
+
+class SubmitCoalescingTest : public ValidationTest {
+  protected:
+    void SetUp() override {
+        ValidationTest::SetUp();
+
+        dawn_native::DeviceDescriptor descriptor;
+        descriptor.forceEnabledToggles.push_back("coalesce_queue_submits");
+        coalescingDevice = wgpu::Device::Acquire(adapter.CreateDevice(&descriptor));
+        coalescingDevice.SetUncapturedErrorCallback(OnDeviceError, this);
+        queue = coalescingDevice.CreateQueue();
+
+        source = CreateBuffer(wgpu::BufferUsage::CopySrc);
+        destination = CreateBuffer(wgpu::BufferUsage::CopyDst);
+    }
+
+    void TearDown() override {
+        EXPECT_EQ(0u, mErrorCount);
+        ValidationTest::TearDown();
+    }
+
+    wgpu::Buffer CreateBuffer(wgpu::BufferUsage usage) {
+        wgpu::BufferDescriptor descriptor;
+        descriptor.size = 4;
+        descriptor.usage = usage;
+        return coalescingDevice.CreateBuffer(&descriptor);
+    }
+
+    wgpu::CommandBuffer EncodeCopy() {
+        wgpu::CommandEncoder encoder = coalescingDevice.CreateCommandEncoder();
+        encoder.CopyBufferToBuffer(source, 0, destination, 0, 4);
+        return encoder.Finish();
+    }
+
+    void SubmitCopy(const wgpu::Queue& submitQueue) {
+        wgpu::CommandBuffer commands = EncodeCopy();
+        submitQueue.Submit(1, &commands);
+    }
+
+    size_t GetPendingCount() {
+        return dawn_native::GetPendingCommandBufferCountForTesting(coalescingDevice.Get());
+    }
+
+    wgpu::Device coalescingDevice;
+    wgpu::Queue queue;
+    wgpu::Buffer source;
+    wgpu::Buffer destination;
+
+    size_t mErrorCount = 0;
+
+  private:
+    static void OnDeviceError(WGPUErrorType type, const char* message, void* userdata) {
+        static_cast<SubmitCoalescingTest*>(userdata)->mErrorCount++;
+    }
+};
+
+// Test that submits are not coalesced unless the toggle is enabled.
+TEST_F(SubmitCoalescingTest, DisabledByDefault) {
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::CommandBuffer commands = encoder.Finish();
+    device.CreateQueue().Submit(1, &commands);
+
+    EXPECT_EQ(0u, dawn_native::GetPendingCommandBufferCountForTesting(device.Get()));
+}
+
+// Test that submits are accumulated until the device is ticked.
+TEST_F(SubmitCoalescingTest, FlushedOnTick) {
+    SubmitCopy(queue);
+    SubmitCopy(queue);
+
+    wgpu::CommandBuffer commands[2] = {EncodeCopy(), EncodeCopy()};
+    queue.Submit(2, commands);
+    EXPECT_EQ(4u, GetPendingCount());
+
+    coalescingDevice.Tick();
+    EXPECT_EQ(0u, GetPendingCount());
+}
+
+// Test that a fence signaled after coalesced submits flushes them and only completes after them.
+TEST_F(SubmitCoalescingTest, FlushedOnSignal) {
+    wgpu::FenceDescriptor descriptor;
+    descriptor.initialValue = 0;
+    wgpu::Fence fence = queue.CreateFence(&descriptor);
+
+    SubmitCopy(queue);
+    queue.Signal(fence, 1);
+    EXPECT_EQ(0u, GetPendingCount());
+    EXPECT_EQ(0u, fence.GetCompletedValue());
+
+    coalescingDevice.Tick();
+    EXPECT_EQ(1u, fence.GetCompletedValue());
+}
+
+// Test that mapping a buffer flushes the coalesced submits before the map request.
+TEST_F(SubmitCoalescingTest, FlushedOnMap) {
+    wgpu::Buffer mappable = CreateBuffer(wgpu::BufferUsage::MapWrite);
+
+    SubmitCopy(queue);
+
+    bool mapped = false;
+    mappable.MapWriteAsync(
+        [](WGPUBufferMapAsyncStatus status, void*, uint64_t, void* userdata) {
+            EXPECT_EQ(WGPUBufferMapAsyncStatus_Success, status);
+            *static_cast<bool*>(userdata) = true;
+        },
+        &mapped);
+    EXPECT_EQ(0u, GetPendingCount());
+
+    coalescingDevice.Tick();
+    EXPECT_TRUE(mapped);
+}
+
+// Test that writing or destroying a resource flushes the coalesced submits that might use it.
+TEST_F(SubmitCoalescingTest, FlushedOnWriteAndDestroy) {
+    wgpu::BufferDescriptor descriptor;
+    descriptor.size = 4;
+    descriptor.usage = wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::CopyDst;
+    source = coalescingDevice.CreateBuffer(&descriptor);
+
+    SubmitCopy(queue);
+    uint32_t data = 42;
+    source.SetSubData(0, sizeof(data), &data);
+    EXPECT_EQ(0u, GetPendingCount());
+
+    SubmitCopy(queue);
+    destination.Destroy();
+    EXPECT_EQ(0u, GetPendingCount());
+
+    wgpu::TextureDescriptor textureDescriptor;
+    textureDescriptor.size = {1, 1, 1};
+    textureDescriptor.format = wgpu::TextureFormat::RGBA8Unorm;
+    textureDescriptor.usage = wgpu::TextureUsage::Sampled;
+    wgpu::Texture texture = coalescingDevice.CreateTexture(&textureDescriptor);
+
+    destination = CreateBuffer(wgpu::BufferUsage::CopyDst);
+    SubmitCopy(queue);
+    texture.Destroy();
+    EXPECT_EQ(0u, GetPendingCount());
+}
+
+// Test that reaching the maximum number of pending command buffers flushes them.
+TEST_F(SubmitCoalescingTest, FlushedOnThreshold) {
+    constexpr size_t kMaxPending = 64;
+    for (size_t i = 0; i < kMaxPending - 1; ++i) {
+        SubmitCopy(queue);
+    }
+    EXPECT_EQ(kMaxPending - 1, GetPendingCount());
+
+    SubmitCopy(queue);
+    EXPECT_EQ(0u, GetPendingCount());
+}
+
+// Test that submits on another queue object flush the ones of the previous queue first.
+TEST_F(SubmitCoalescingTest, OtherQueueFlushes) {
+    wgpu::Queue otherQueue = coalescingDevice.CreateQueue();
+
+    SubmitCopy(queue);
+    SubmitCopy(queue);
+    SubmitCopy(otherQueue);
+    EXPECT_EQ(1u, GetPendingCount());
+}
+
+// Test that submits in another error scope flush the ones of the previous scope first, so that
+// errors of the deferred work are reported in the scope of the submits.
+TEST_F(SubmitCoalescingTest, OtherErrorScopeFlushes) {
+    SubmitCopy(queue);
+    SubmitCopy(queue);
+
+    coalescingDevice.PushErrorScope(wgpu::ErrorFilter::Validation);
+    SubmitCopy(queue);
+    EXPECT_EQ(1u, GetPendingCount());
+    SubmitCopy(queue);
+    EXPECT_EQ(2u, GetPendingCount());
+
+    bool popped = false;
+    coalescingDevice.PopErrorScope(
+        [](WGPUErrorType type, const char*, void* userdata) {
+            EXPECT_EQ(WGPUErrorType_NoError, type);
+            *static_cast<bool*>(userdata) = true;
+        },
+        &popped);
+    SubmitCopy(queue);
+    EXPECT_EQ(1u, GetPendingCount());
+
+    // The scope is kept alive until the coalesced submits made in it complete.
+    EXPECT_FALSE(popped);
+    coalescingDevice.Tick();
+    EXPECT_TRUE(popped);
+}
+
+// Test that submits are still validated immediately and invalid ones aren't coalesced.
+TEST_F(SubmitCoalescingTest, ValidatedAtSubmit) {
+    wgpu::CommandBuffer commands = EncodeCopy();
+    destination.Destroy();
+
+    queue.Submit(1, &commands);
+    EXPECT_EQ(1u, mErrorCount);
+    EXPECT_EQ(0u, GetPendingCount());
+    mErrorCount = 0;
+}
+
+// Test that destroying the device with pending submits discards them.
+TEST_F(SubmitCoalescingTest, DeviceDestroyedWithPendingSubmits) {
+    SubmitCopy(queue);
+    EXPECT_EQ(1u, GetPendingCount());
+
+    queue = nullptr;
+    source = nullptr;
+    destination = nullptr;
+    coalescingDevice = nullptr;
+}
@@ -0,0 +1,130 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/unittests/validation/ValidationTest.h"
+
+#include "dawn_native/null/DeviceNull.h"
+
+class WaitValidationTest : public ValidationTest {
+  protected:
+    void SetUp() override {
+        ValidationTest::SetUp();
+        queue = device.CreateQueue();
+    }
+
+    wgpu::Fence CreateFence(uint64_t initialValue = 0) {
+        wgpu::FenceDescriptor descriptor;
+        descriptor.initialValue = initialValue;
+        return queue.CreateFence(&descriptor);
+    }
+
+    wgpu::Queue queue;
+};
+
+// Test that waiting for a signaled value completes the fence without ticking the device.
+TEST_F(WaitValidationTest, WaitForSignaledValue) {
+    wgpu::Fence fence = CreateFence();
+    queue.Signal(fence, 2);
+
+    EXPECT_TRUE(dawn_native::WaitForFence(fence.Get(), 2, dawn_native::kWaitTimeoutInfinite));
+    EXPECT_EQ(2u, fence.GetCompletedValue());
+}
+
+// Test that the fence's OnCompletion callbacks are called by the wait.
+TEST_F(WaitValidationTest, WaitCallsOnCompletion) {
+    wgpu::Fence fence = CreateFence();
+    queue.Signal(fence, 1);
+
+    bool called = false;
+    fence.OnCompletion(
+        1,
+        [](WGPUFenceCompletionStatus status, void* userdata) {
+            EXPECT_EQ(WGPUFenceCompletionStatus_Success, status);
+            *static_cast<bool*>(userdata) = true;
+        },
+        &called);
+
+    EXPECT_TRUE(dawn_native::WaitForFence(fence.Get(), 1, dawn_native::kWaitTimeoutInfinite));
+    EXPECT_TRUE(called);
+}
+
+// Test that waiting for an already completed value returns immediately, even with a zero timeout.
+TEST_F(WaitValidationTest, WaitForCompletedValue) {
+    wgpu::Fence fence = CreateFence(3);
+    EXPECT_TRUE(dawn_native::WaitForFence(fence.Get(), 0, 0));
+    EXPECT_TRUE(dawn_native::WaitForFence(fence.Get(), 3, 0));
+}
+
+// Test that it is an error to wait for a value that wasn't signaled.
+TEST_F(WaitValidationTest, WaitForUnsignaledValueIsError) {
+    wgpu::Fence fence = CreateFence();
+    queue.Signal(fence, 1);
+
+    bool completed = true;
+    ASSERT_DEVICE_ERROR(completed = dawn_native::WaitForFence(fence.Get(), 2, 0));
+    EXPECT_FALSE(completed);
+}
+
+// Test that waiting for buffer mapping calls the map callbacks without ticking the device.
+TEST_F(WaitValidationTest, WaitForBufferMapping) {
+    wgpu::BufferDescriptor descriptor;
+    descriptor.size = 4;
+    descriptor.usage = wgpu::BufferUsage::MapRead;
+    wgpu::Buffer buffer = device.CreateBuffer(&descriptor);
+
+    bool called = false;
+    buffer.MapReadAsync(
+        [](WGPUBufferMapAsyncStatus status, const void* data, uint64_t, void* userdata) {
+            EXPECT_EQ(WGPUBufferMapAsyncStatus_Success, status);
+            EXPECT_NE(nullptr, data);
+            *static_cast<bool*>(userdata) = true;
+        },
+        &called);
+
+    EXPECT_TRUE(dawn_native::WaitForBufferMapping(device.Get(), dawn_native::kWaitTimeoutInfinite));
+    EXPECT_TRUE(called);
+
+    // There are no more pending map requests so the next wait completes immediately.
+    EXPECT_TRUE(dawn_native::WaitForBufferMapping(device.Get(), 0));
+}
+
+// Test that a wait with a finite timeout expires when the device has nothing to submit to make
+// progress.
+TEST_F(WaitValidationTest, WaitForBufferMappingTimesOutWithoutProgress) {
+    dawn_native::null::Device* nullDevice =
+        reinterpret_cast<dawn_native::null::Device*>(device.Get());
+
+    wgpu::BufferDescriptor descriptor;
+    descriptor.size = 4;
+    descriptor.usage = wgpu::BufferUsage::MapRead;
+    wgpu::Buffer buffer = device.CreateBuffer(&descriptor);
+
+    bool called = false;
+    buffer.MapReadAsync(
+        [](WGPUBufferMapAsyncStatus status, const void*, uint64_t, void* userdata) {
+            EXPECT_EQ(WGPUBufferMapAsyncStatus_Success, status);
+            *static_cast<bool*>(userdata) = true;
+        },
+        &called);
+
+    // The completed serial catches up with the last submitted one, but the serial of the map
+    // request is never submitted.
+    nullDevice->SetSubmitsPausedForTesting(true);
+    EXPECT_FALSE(dawn_native::WaitForBufferMapping(device.Get(), 1000 * 1000));
+    EXPECT_FALSE(called);
+
+    nullDevice->SetSubmitsPausedForTesting(false);
+    EXPECT_TRUE(dawn_native::WaitForBufferMapping(device.Get(), dawn_native::kWaitTimeoutInfinite));
+    EXPECT_TRUE(called);
+}
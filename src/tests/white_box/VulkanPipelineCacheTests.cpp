@@ -0,0 +1,94 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/DawnTest.h"
+
+#include "dawn_native/vulkan/DeviceVk.h"
+#include "dawn_native/vulkan/PipelineCacheVk.h"
+#include "tests/InMemoryCachingPlatform.h"
+#include "utils/WGPUHelpers.h"
+
+#include <memory>
+
+namespace {
+
+    class VulkanPipelineCacheTests : public DawnTest {
+      protected:
+        std::unique_ptr<dawn_platform::Platform> CreateTestPlatform() override {
+            auto platform = std::make_unique<InMemoryCachingPlatform>();
+            mCache = platform->GetCache();
+            return std::move(platform);
+        }
+
+        void TestSetUp() override {
+            // The tests look at the backend objects of the devices.
+            DAWN_SKIP_TEST_IF(UsesWire());
+        }
+
+        dawn_native::vulkan::PipelineCache* GetPipelineCache(const wgpu::Device& device) {
+            return reinterpret_cast<dawn_native::vulkan::Device*>(device.Get())
+                ->GetPipelineCache();
+        }
+
+        wgpu::ComputePipeline CreatePipeline(const wgpu::Device& device) {
+            wgpu::ShaderModule module =
+                utils::CreateShaderModule(device, utils::SingleShaderStage::Compute, R"(
+                #version 450
+                layout(std430, set = 0, binding = 0) buffer Data { uint value; } data;
+                void main() {
+                    data.value = 42u;
+                })");
+
+            wgpu::ComputePipelineDescriptor descriptor;
+            descriptor.computeStage.module = module;
+            descriptor.computeStage.entryPoint = "main";
+            return device.CreateComputePipeline(&descriptor);
+        }
+
+        InMemoryCache* mCache = nullptr;
+    };
+
+}  // anonymous namespace
+
+// Test that the pipeline cache is stored in the blob store and used by the next devices.
+TEST_P(VulkanPipelineCacheTests, StoredAndLoaded) {
+    EXPECT_FALSE(GetPipelineCache(device)->WasLoadedForTesting());
+
+    CreatePipeline(device);
+    GetPipelineCache(device)->Store();
+    EXPECT_EQ(1u, mCache->GetStoreCount());
+
+    // The cache isn't stored again when no pipeline was created since the last store.
+    GetPipelineCache(device)->Store();
+    EXPECT_EQ(1u, mCache->GetStoreCount());
+
+    wgpu::Device otherDevice = wgpu::Device::Acquire(GetAdapter().CreateDevice());
+    EXPECT_TRUE(GetPipelineCache(otherDevice)->WasLoadedForTesting());
+    EXPECT_EQ(1u, mCache->GetHitCount());
+    EXPECT_NE(nullptr, CreatePipeline(otherDevice).Get());
+}
+
+// Test that data in the blob store that isn't a pipeline cache of the device is ignored.
+TEST_P(VulkanPipelineCacheTests, InvalidDataIgnored) {
+    CreatePipeline(device);
+    GetPipelineCache(device)->Store();
+    EXPECT_EQ(1u, mCache->GetStoreCount());
+    mCache->ClobberValues();
+
+    wgpu::Device otherDevice = wgpu::Device::Acquire(GetAdapter().CreateDevice());
+    EXPECT_FALSE(GetPipelineCache(otherDevice)->WasLoadedForTesting());
+    EXPECT_NE(nullptr, CreatePipeline(otherDevice).Get());
+}
+
+DAWN_INSTANTIATE_TEST(VulkanPipelineCacheTests, VulkanBackend());
@@ -19,6 +19,7 @@
 
 #include <array>
 #include <initializer_list>
+#include <vector>
 
 #include "common/Constants.h"
 
@@ -33,6 +34,10 @@ namespace utils {
                                           const char* source);
     wgpu::ShaderModule CreateShaderModuleFromASM(const wgpu::Device& device, const char* source);
 
+    // Compiles the GLSL source to SPIR-V, for tests that create the same module many times and
+    // don't want to measure the compilation. Returns an empty vector on failure.
+    std::vector<uint32_t> CompileGLSLToSpirv(SingleShaderStage stage, const char* source);
+
     wgpu::Buffer CreateBufferFromData(const wgpu::Device& device,
                                       const void* data,
                                       uint64_t size,